@@ -133,6 +133,20 @@ public:
         return m_lambda;
     }
 
+    //! Set the starting point for the next call to equilibrate().
+    /*!
+     * If #options.contin is set, the next call to equilibrate() starts from
+     * temperature *T* (unless the temperature is one of the fixed properties)
+     * and the dimensionless element potentials *lambda_RT*, skipping the
+     * estimation of the initial moles and element potentials. The guess is
+     * used only once.
+     *
+     * @param T starting temperature [K]
+     * @param lambda_RT dimensionless element potentials \f$ \lambda_m/RT \f$.
+     *     Length nElements().
+     */
+    void setInitialGuess(doublereal T, const vector_fp& lambda_RT);
+
     /**
      * Options controlling how the calculation is carried out.
      * @see EquilOptions
@@ -311,6 +325,13 @@ protected:
 
     std::vector<size_t> m_orderVectorElements;
     std::vector<size_t> m_orderVectorSpecies;
+
+    //! Starting temperature set by setInitialGuess()
+    doublereal m_guessT;
+
+    //! Starting dimensionless element potentials set by setInitialGuess().
+    //! Empty if no guess has been provided.
+    vector_fp m_guessLambda;
 };
 
 extern int ChemEquil_print_lvl;
@@ -0,0 +1,202 @@
+/**
+ *  @file EquilCache.h
+ *  Equilibrium calculations for sequences of nearby states (see \ref equil
+ *  and class \link Cantera::EquilCache EquilCache\endlink).
+ */
+
+#ifndef CT_EQUILCACHE_H
+#define CT_EQUILCACHE_H
+
+#include "ChemEquil.h"
+
+namespace Cantera
+{
+
+//! Equilibrium solver for many closely related single-phase problems.
+/*!
+ * EquilCache is intended for applications such as CFD post-processing, where
+ * the equilibrium state is needed for a large number of cells whose
+ * thermodynamic states and elemental compositions differ only slightly from
+ * their neighbours. For each converged problem, the cache stores the
+ * specified properties, the elemental composition, and the solution (the
+ * temperature, the element potentials and the mole fractions). A new problem
+ * is started from the nearest stored solution, which bypasses the estimation
+ * of the initial moles and element potentials in ChemEquil and usually
+ * converges in a few Newton iterations. If the warm-started solve fails, the
+ * problem is solved from scratch with ChemEquil, and then with the VCS solver.
+ *
+ * Optionally, the stored solutions can also be used directly, in the manner
+ * of an in-situ adaptive table. Each entry has a region of accuracy, which is
+ * a box in the space of the specified properties and element mole fractions
+ * whose half-widths are initially retrieveRadius(). Queries falling inside
+ * this region are answered by setting the stored composition and then the
+ * specified properties, without an equilibrium solve. When a query falling
+ * outside the region is solved directly, the solution is compared to the
+ * stored composition of the nearest entry; if no mole fraction differs by
+ * more than retrieveTolerance(), the region is grown to include the query
+ * point. Since the region is grown one direction at a time, the error for
+ * retrieved states is only approximately bounded by the tolerance. Retrieval
+ * is disabled by default.
+ *
+ * The distance between two problems is measured as the sum of the absolute
+ * differences in the element mole fractions, plus the relative difference in
+ * each of the specified properties. Enthalpies and internal energies are
+ * scaled by \f$ RT/\overline{W} \f$, and entropies by \f$ R/\overline{W} \f$,
+ * evaluated at the stored solution.
+ *
+ * Example usage:
+ * @code
+ *     EquilCache cache;
+ *     for (size_t j = 0; j < nCells; j++) {
+ *         gas.setState_TPY(T[j], P[j], &Y[j*nsp]);
+ *         cache.equilibrate(gas, "HP");
+ *         ...
+ *     }
+ * @endcode
+ *
+ * @ingroup equil
+ */
+class EquilCache
+{
+public:
+    //! Constructor
+    //! @param maxEntries maximum number of solutions stored. When the cache
+    //!     is full, the least recently used solution is replaced.
+    EquilCache(size_t maxEntries=200);
+
+    virtual ~EquilCache() {}
+
+    //! Equilibrate a phase, holding the elemental composition and the two
+    //! properties specified by *XY* fixed at the values found within the
+    //! ThermoPhase object *s*.
+    /*!
+     * @param s  phase object to be equilibrated
+     * @param XY property pair to hold constant, e.g. "TP" or "HP"
+     * @param loglevel Specify amount of debug logging (0 to disable)
+     */
+    void equilibrate(thermo_t& s, const std::string& XY, int loglevel=0);
+
+    //! Remove all stored solutions
+    void clear();
+
+    //! Number of stored solutions
+    size_t nEntries() const {
+        return m_entries.size();
+    }
+
+    //! Set the largest distance to a stored solution for which a warm start
+    //! will be attempted. Default: 0.5
+    void setWarmStartDistance(double dist) {
+        m_warmDist = dist;
+    }
+
+    //! Enable retrieval of stored solutions without an equilibrium solve.
+    /*!
+     * @param radius Initial half-width of the region of accuracy of each
+     *     stored solution. A value of 0.0 means that the regions are
+     *     established only by growing them.
+     * @param tol Largest absolute error in any mole fraction that is accepted
+     *     when growing the region of accuracy. A value of 0.0 (the default)
+     *     disables retrieval.
+     */
+    void setRetrieveTolerance(double radius, double tol) {
+        m_retrieveRadius = radius;
+        m_retrieveTol = tol;
+    }
+
+    double retrieveRadius() const {
+        return m_retrieveRadius;
+    }
+
+    double retrieveTolerance() const {
+        return m_retrieveTol;
+    }
+
+    //! Number of problems answered from a stored solution
+    size_t nRetrieved() const {
+        return m_nRetrieved;
+    }
+
+    //! Number of problems solved starting from a stored solution
+    size_t nWarmStarts() const {
+        return m_nWarm;
+    }
+
+    //! Number of problems solved without a stored starting point, including
+    //! those where a warm start was attempted and failed.
+    size_t nColdStarts() const {
+        return m_nCold;
+    }
+
+    /**
+     * Options passed to the ChemEquil solver. The defaults for the relative
+     * tolerance and the maximum number of iterations match those used by
+     * ThermoPhase::equilibrate().
+     */
+    EquilOpt options;
+
+protected:
+    //! A stored equilibrium solution
+    struct Entry {
+        double v1; //!< first specified property (mass basis)
+        double v2; //!< second specified property (pressure or density)
+        double scale1; //!< scale for differences in *v1*
+        //! half-widths of the region of accuracy in each of the specified
+        //! properties and element mole fractions
+        vector_fp radius;
+        size_t lastUsed; //!< value of #m_clock when last used
+        double T; //!< equilibrium temperature
+        vector_fp elemFracs; //!< element mole fractions
+        vector_fp lambda_RT; //!< dimensionless element potentials
+        vector_fp X; //!< equilibrium mole fractions
+    };
+
+    //! Get the values of the properties specified by *XY* from *s*
+    void getProperties(thermo_t& s, int XY, double& v1, double& v2) const;
+
+    //! Distance between the current problem and the entry *e*
+    double distance(const Entry& e, double v1, double v2) const;
+
+    //! True if the current problem is inside the region of accuracy of *e*
+    bool inRegion(const Entry& e, double v1, double v2) const;
+
+    //! Set *s* to the stored composition of *e* and the specified properties
+    void retrieve(thermo_t& s, const Entry& e, int XY, double v1, double v2);
+
+    //! Store the current (equilibrium) state of *s*, replacing the least
+    //! recently used entry if the cache is full.
+    void addEntry(thermo_t& s, double v1, double v2, const vector_fp& lambda);
+
+    //! The solver used for warm-started and cold-started solves
+    std::unique_ptr<ChemEquil> m_solver;
+
+    std::vector<Entry> m_entries;
+    size_t m_maxEntries;
+
+    //! Property pair of the stored solutions
+    int m_XY;
+
+    //! Counter incremented on each call to equilibrate()
+    size_t m_clock;
+
+    double m_warmDist;
+    double m_retrieveRadius;
+    double m_retrieveTol;
+
+    size_t m_nRetrieved;
+    size_t m_nWarm;
+    size_t m_nCold;
+
+    size_t m_kk; //!< number of species in the phase
+    size_t m_mm; //!< number of elements in the phase
+
+    //! Element mole fractions of the current problem. Length #m_mm.
+    vector_fp m_elemFracs;
+
+    //! Work array of length #m_kk
+    vector_fp m_work;
+};
+
+}
+
+#endif
@@ -47,6 +47,22 @@ public:
     virtual void getEquilibriumConstants(doublereal* kc);
     virtual void getFwdRateConstants(doublereal* kfwd);
 
+    //! @}
+    //! @name Species Production Rates
+    //! @{
+
+    //! Derivatives of the species net production rates with respect to the
+    //! species concentrations.
+    /*!
+     * The derivatives of the mass-action concentration products and of the
+     * enhanced third-body concentrations are evaluated analytically. For
+     * falloff reactions, the derivative of the falloff function with respect
+     * to the reduced pressure is evaluated by finite differences. The rates
+     * of P-log and Chebyshev reactions are treated as independent of the
+     * species concentrations.
+     */
+    virtual void getNetProductionRates_ddC(doublereal* ddC);
+
     //! @}
     //! @name Reaction Mechanism Setup Routines
     //! @{
@@ -107,6 +123,22 @@ protected:
 
     void processFalloffReactions();
 
+    //! Set up #m_rxnOrders and #m_rxnStoich, which are used by
+    //! getNetProductionRates_ddC()
+    void buildDerivativeData();
+
+    //! Species indices and reaction orders for the concentration products of
+    //! each reaction. `m_rxnOrders[2*i]` holds the terms for the forward
+    //! direction of reaction *i*, and `m_rxnOrders[2*i+1]` the terms for the
+    //! reverse direction.
+    std::vector<std::vector<std::pair<size_t, double>>> m_rxnOrders;
+
+    //! Species indices and net stoichiometric coefficients for each reaction
+    std::vector<std::vector<std::pair<size_t, double>>> m_rxnStoich;
+
+    //! Work arrays used by getNetProductionRates_ddC()
+    vector_fp m_kfwd, m_eff, m_prWork;
+
     void addThreeBodyReaction(ThreeBodyReaction& r);
     void addFalloffReaction(FalloffReaction& r);
     void addPlogReaction(PlogReaction& r);
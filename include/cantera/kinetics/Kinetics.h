@@ -569,6 +569,18 @@ public:
      */
     virtual void getNetProductionRates(doublereal* wdot);
 
+    /**
+     * Derivatives of the species net production rates with respect to the
+     * species concentrations [1/s], at constant temperature. The derivative
+     * of the net production rate of species *k* with respect to the
+     * concentration of species *m* is returned in `ddC[k + m*nTotalSpecies()]`.
+     *
+     * @param ddC   Output array of derivatives. Length: m_kk * m_kk.
+     */
+    virtual void getNetProductionRates_ddC(doublereal* ddC) {
+        throw NotImplementedError("Kinetics::getNetProductionRates_ddC");
+    }
+
     //! @}
     //! @name Reaction Mechanism Informational Query Routines
     //! @{
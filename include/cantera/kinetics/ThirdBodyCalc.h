@@ -49,6 +49,22 @@ public:
         return m_reaction_index.size();
     }
 
+    //! Index of the *i*-th third-body reaction within the full reaction array
+    size_t reactionIndex(size_t i) const {
+        return m_reaction_index[i];
+    }
+
+    //! Get the third-body efficiency of each species in the *i*-th
+    //! third-body reaction, which is the derivative of the enhanced
+    //! third-body concentration with respect to the concentration of that
+    //! species.
+    void getEfficiencies(size_t i, double* eff, size_t nsp) const {
+        std::fill(eff, eff + nsp, m_default[i]);
+        for (size_t j = 0; j < m_species[i].size(); j++) {
+            eff[m_species[i][j]] += m_eff[i][j];
+        }
+    }
+
 protected:
     //! Indices of third-body reactions within the full reaction array
     std::vector<size_t> m_reaction_index;
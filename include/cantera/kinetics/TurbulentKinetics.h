@@ -25,6 +25,12 @@ public:
         return cTurbulentKinetics;
     }
 
+    virtual Kinetics* duplMyselfAsKinetics(const std::vector<thermo_t*> & tpVector) const {
+        TurbulentKinetics* tK = new TurbulentKinetics(*this);
+        tK->assignShallowPointers(tpVector);
+        return tK;
+    }
+
     void setTprime(double Tprime) {
         m_Tprime = Tprime;
     }
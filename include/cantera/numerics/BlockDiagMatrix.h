@@ -0,0 +1,219 @@
+/**
+ *  @file BlockDiagMatrix.h
+ *   Declarations for the class BlockDiagMatrix
+ *   which is a child class of GeneralMatrix for block diagonal matrices
+ *   handled by solvers
+ *    (see class \ref numerics and \link Cantera::BlockDiagMatrix BlockDiagMatrix\endlink).
+ */
+
+#ifndef CT_BLOCKDIAGMATRIX_H
+#define CT_BLOCKDIAGMATRIX_H
+
+#include "GeneralMatrix.h"
+
+namespace Cantera
+{
+
+//! A class for block diagonal matrices with blocks of varying size.
+/*!
+ * The rows and columns of the matrix are divided into consecutive blocks,
+ * where block *i* has size \f$ n_i \f$, and the only nonzero elements are
+ * those in the diagonal blocks. Each block is stored as a dense,
+ * column-major \f$ n_i \times n_i \f$ array, and is factored separately with
+ * LAPACK DGETRF. Elements outside of the diagonal blocks may be assigned,
+ * but are discarded. This makes it possible to fill the matrix with the same
+ * code used to fill a matrix with a wider structure, such as a
+ * BlockTridiagMatrix, and use it as a block-Jacobi preconditioner.
+ *
+ * As with BandMatrix, both the original data and the LU factorization are
+ * stored.
+ */
+class BlockDiagMatrix : public GeneralMatrix
+{
+public:
+    //! Base Constructor
+    /*!
+     * Create an \c 0 by \c 0 matrix.
+     */
+    BlockDiagMatrix();
+
+    //! Creates a block diagonal matrix and sets all elements to \c v
+    /*!
+     * @param blockSizes  size of each block. All block sizes must be
+     *                    greater than zero.
+     * @param v           initial value of all matrix components.
+     */
+    BlockDiagMatrix(const std::vector<size_t>& blockSizes, doublereal v = 0.0);
+
+    //! Resize the matrix problem
+    /*!
+     * All data is lost
+     *
+     * @param blockSizes  size of each block. All block sizes must be
+     *                    greater than zero.
+     * @param v           initial value of all matrix components.
+     */
+    void resize(const std::vector<size_t>& blockSizes, doublereal v = 0.0);
+
+    //! Number of blocks
+    size_t nBlocks() const {
+        return m_bsize.size();
+    }
+
+    //! Size of block *i*
+    size_t blockSize(size_t i) const {
+        return m_bsize[i];
+    }
+
+    //! Index of the first row and column of block *i*
+    size_t blockStart(size_t i) const {
+        return m_bstart[i];
+    }
+
+    //! Replace zero pivots found while factoring the matrix.
+    /*!
+     * If *regularize* is true, an exactly zero pivot in the LU factorization
+     * of a diagonal block is replaced by one, so that a factorization is
+     * available even if some of the blocks are singular. The factorization is
+     * then that of a matrix which differs from this one by a unit element
+     * for each zero pivot, which is acceptable when the matrix is only used
+     * as a preconditioner. The default is false.
+     */
+    void setRegularize(bool regularize) {
+        m_regularize = regularize;
+    }
+
+    virtual doublereal& operator()(size_t i, size_t j);
+    virtual doublereal operator()(size_t i, size_t j) const;
+
+    //! Return a changeable reference to element (i,j).
+    /*!
+     * Since this method may alter the element value, it may need to be
+     * refactored, so the flag m_factored is set to false. If (i,j) is
+     * outside of the diagonal blocks, a reference to a dummy element is
+     * returned.
+     *
+     * @param i  row
+     * @param j  column
+     * @returns a reference to the value of the matrix entry
+     */
+    doublereal& value(size_t i, size_t j);
+
+    //! Return the value of element (i,j).
+    /*!
+     * This method does not alter the array.
+     * @param i  row
+     * @param j  column
+     * @returns the value of the matrix entry
+     */
+    doublereal value(size_t i, size_t j) const;
+
+    virtual size_t nRows() const;
+
+    //! Return the size and structure of the matrix
+    /*!
+     * @param iStruct OUTPUT Pointer to a vector of ints that describe the
+     *     structure of the matrix.
+     *
+     *         istruct[0] = number of blocks
+     * @returns the number of rows and columns in the matrix.
+     */
+    virtual size_t nRowsAndStruct(size_t* const iStruct = 0) const;
+
+    virtual void mult(const doublereal* b, doublereal* prod) const;
+    virtual void leftMult(const doublereal* const b, doublereal* const prod) const;
+
+    //! Perform an LU decomposition of each block
+    /*!
+     * @return Return a success flag. 0 indicates a success. A positive
+     *     value *i* indicates that the *i*-th diagonal element of the
+     *     upper triangular factor (counting from 1) is exactly zero, in
+     *     which case the matrix is singular. See setRegularize().
+     */
+    virtual int factor();
+
+    //! Solve the matrix problem Ax = b
+    /*!
+     * @param b  INPUT RHS of the problem
+     * @param x  OUTPUT solution to the problem
+     * @return a success flag. 0 indicates a success; ~0 indicates some error
+     *     occurred, see factor()
+     */
+    int solve(const doublereal* const b, doublereal* const x);
+
+    //! Solve the matrix problem Ax = b
+    /*!
+     * @param b     INPUT RHS of the problem
+     *              OUTPUT solution to the problem
+     * @param nrhs  Number of right hand sides to solve
+     * @param ldb   Leading dimension of `b`. Default is nRows()
+     * @returns a success flag. 0 indicates a success; ~0 indicates some error
+     *     occurred, see factor()
+     */
+    virtual int solve(doublereal* b, size_t nrhs=1, size_t ldb=0);
+
+    //! Returns an iterator for the start of the block storage data
+    virtual vector_fp::iterator begin();
+
+    //! Returns a const iterator for the start of the block storage data
+    virtual vector_fp::const_iterator begin() const;
+
+    virtual void zero();
+
+    //! Not implemented
+    virtual doublereal rcond(doublereal a1norm);
+
+    //! Returns the factor algorithm used.  This method will always return 0
+    //! (LU) for block diagonal matrices.
+    virtual int factorAlgorithm() const;
+
+    //! Returns the one norm of the matrix
+    virtual doublereal oneNorm() const;
+
+    virtual GeneralMatrix* duplMyselfAsGeneralMatrix() const;
+
+    //! Not implemented, since the columns are not stored contiguously
+    virtual doublereal* ptrColumn(size_t j);
+
+    //! Not implemented, since the columns are not stored contiguously
+    virtual doublereal* const* colPts();
+
+    virtual size_t checkRows(doublereal& valueSmall) const;
+    virtual size_t checkColumns(doublereal& valueSmall) const;
+
+protected:
+    //! Matrix data. Block *i* starts at `data[m_loc[i]]`.
+    vector_fp data;
+
+    //! Factorized data, with the same layout as #data
+    vector_fp ludata;
+
+    //! Number of rows and columns of the matrix
+    size_t m_n;
+
+    //! Size of each block
+    std::vector<size_t> m_bsize;
+
+    //! Index of the first row of each block
+    std::vector<size_t> m_bstart;
+
+    //! Block containing each row
+    std::vector<size_t> m_rowBlock;
+
+    //! Location of each block in #data and #ludata
+    std::vector<size_t> m_loc;
+
+    //! value of zero
+    doublereal m_zero;
+
+    //! Replace zero pivots by one. See setRegularize().
+    bool m_regularize;
+
+    //! Pivot vector. The pivots for block *i* start at `m_ipiv[m_bstart[i]]`
+    //! and are relative to the first row of the block.
+    vector_int m_ipiv;
+};
+
+}
+
+#endif
@@ -0,0 +1,248 @@
+/**
+ *  @file BlockTridiagMatrix.h
+ *   Declarations for the class BlockTridiagMatrix
+ *   which is a child class of GeneralMatrix for block tridiagonal matrices
+ *   handled by solvers
+ *    (see class \ref numerics and \link Cantera::BlockTridiagMatrix BlockTridiagMatrix\endlink).
+ */
+
+#ifndef CT_BLOCKTRIDIAGMATRIX_H
+#define CT_BLOCKTRIDIAGMATRIX_H
+
+#include "GeneralMatrix.h"
+
+namespace Cantera
+{
+
+//! A class for block tridiagonal matrices with blocks of varying size.
+/*!
+ * The rows and columns of the matrix are divided into consecutive blocks,
+ * where block *i* has size \f$ n_i \f$. The only nonzero elements are those in
+ * the diagonal blocks and in the blocks coupling block *i* to blocks *i* - 1
+ * and *i* + 1. The elements of each block row are stored as a dense,
+ * column-major \f$ n_i \times (n_{i-1} + n_i + n_{i+1}) \f$ array. This is
+ * the structure of the Jacobian of a set of equations discretized on a
+ * one-dimensional grid with a three-point stencil, where each block holds
+ * the unknowns at one grid point. Since the block sizes may differ, the small
+ * blocks for the boundary points of a multi-domain problem are stored
+ * without padding.
+ *
+ * The matrix is factored by block LU decomposition. At each step, the
+ * diagonal block and the sub-diagonal block below it are factored together
+ * with partial pivoting (LAPACK DGETRF), and the rest of the two block rows
+ * is updated with BLAS level 3 routines. The pivoting is therefore the same
+ * as that used by the banded LU factorization for a matrix with the same
+ * nonzero structure, but the zero elements within the band are neither
+ * stored nor operated on. Pivoting fills in one additional super-diagonal
+ * block in each block row of the upper triangular factor.
+ *
+ * As with BandMatrix, both the original data and the LU factorization are
+ * stored.
+ */
+class BlockTridiagMatrix : public GeneralMatrix
+{
+public:
+    //! Base Constructor
+    /*!
+     * Create an \c 0 by \c 0 matrix.
+     */
+    BlockTridiagMatrix();
+
+    //! Creates a block tridiagonal matrix and sets all elements to \c v
+    /*!
+     * @param blockSizes  size of each block. All block sizes must be
+     *                    greater than zero.
+     * @param v           initial value of all matrix components.
+     */
+    BlockTridiagMatrix(const std::vector<size_t>& blockSizes,
+                       doublereal v = 0.0);
+
+    //! Resize the matrix problem
+    /*!
+     * All data is lost
+     *
+     * @param blockSizes  size of each block. All block sizes must be
+     *                    greater than zero.
+     * @param v           initial value of all matrix components.
+     */
+    void resize(const std::vector<size_t>& blockSizes, doublereal v = 0.0);
+
+    //! Number of blocks
+    size_t nBlocks() const {
+        return m_bsize.size();
+    }
+
+    //! Size of block *i*
+    size_t blockSize(size_t i) const {
+        return m_bsize[i];
+    }
+
+    //! Index of the first row and column of block *i*
+    size_t blockStart(size_t i) const {
+        return m_bstart[i];
+    }
+
+    virtual doublereal& operator()(size_t i, size_t j);
+    virtual doublereal operator()(size_t i, size_t j) const;
+
+    //! Return a changeable reference to element (i,j).
+    /*!
+     * Since this method may alter the element value, it may need to be
+     * refactored, so the flag m_factored is set to false. If (i,j) is
+     * outside of the nonzero blocks, a reference to a dummy element is
+     * returned.
+     *
+     * @param i  row
+     * @param j  column
+     * @returns a reference to the value of the matrix entry
+     */
+    doublereal& value(size_t i, size_t j);
+
+    //! Return the value of element (i,j).
+    /*!
+     * This method does not alter the array.
+     * @param i  row
+     * @param j  column
+     * @returns the value of the matrix entry
+     */
+    doublereal value(size_t i, size_t j) const;
+
+    virtual size_t nRows() const;
+
+    //! Return the size and structure of the matrix
+    /*!
+     * @param iStruct OUTPUT Pointer to a vector of ints that describe the
+     *     structure of the matrix.
+     *
+     *         istruct[0] = number of blocks
+     * @returns the number of rows and columns in the matrix.
+     */
+    virtual size_t nRowsAndStruct(size_t* const iStruct = 0) const;
+
+    virtual void mult(const doublereal* b, doublereal* prod) const;
+    virtual void leftMult(const doublereal* const b, doublereal* const prod) const;
+
+    //! Perform a block LU decomposition
+    /*!
+     * @return Return a success flag. 0 indicates a success. A positive
+     *     value *i* indicates that the *i*-th diagonal element of the
+     *     upper triangular factor (counting from 1) is exactly zero, in
+     *     which case the matrix is singular.
+     */
+    virtual int factor();
+
+    //! Solve the matrix problem Ax = b
+    /*!
+     * @param b  INPUT RHS of the problem
+     * @param x  OUTPUT solution to the problem
+     * @return a success flag. 0 indicates a success; ~0 indicates some error
+     *     occurred, see factor()
+     */
+    int solve(const doublereal* const b, doublereal* const x);
+
+    //! Solve the matrix problem Ax = b
+    /*!
+     * @param b     INPUT RHS of the problem
+     *              OUTPUT solution to the problem
+     * @param nrhs  Number of right hand sides to solve
+     * @param ldb   Leading dimension of `b`. Default is nRows()
+     * @returns a success flag. 0 indicates a success; ~0 indicates some error
+     *     occurred, see factor()
+     */
+    virtual int solve(doublereal* b, size_t nrhs=1, size_t ldb=0);
+
+    //! Returns an iterator for the start of the block row storage data
+    virtual vector_fp::iterator begin();
+
+    //! Returns a const iterator for the start of the block row storage data
+    virtual vector_fp::const_iterator begin() const;
+
+    virtual void zero();
+
+    //! Not implemented
+    virtual doublereal rcond(doublereal a1norm);
+
+    //! Returns the factor algorithm used.  This method will always return 0
+    //! (LU) for block tridiagonal matrices.
+    virtual int factorAlgorithm() const;
+
+    //! Returns the one norm of the matrix
+    virtual doublereal oneNorm() const;
+
+    virtual GeneralMatrix* duplMyselfAsGeneralMatrix() const;
+
+    //! Not implemented, since the columns are not stored contiguously
+    virtual doublereal* ptrColumn(size_t j);
+
+    //! Not implemented, since the columns are not stored contiguously
+    virtual doublereal* const* colPts();
+
+    virtual size_t checkRows(doublereal& valueSmall) const;
+    virtual size_t checkColumns(doublereal& valueSmall) const;
+
+protected:
+    //! Index of the first column of the nonzero part of row *i*
+    size_t firstColumn(size_t i) const {
+        size_t b = m_rowBlock[i];
+        return (b == 0) ? 0 : m_bstart[b-1];
+    }
+
+    //! Index one past the last column of the nonzero part of row *i*
+    size_t lastColumn(size_t i) const {
+        size_t b = m_rowBlock[i];
+        return (b + 2 < m_bstart.size()) ? m_bstart[b+2] : m_n;
+    }
+
+    //! Size of block *i*, or zero if *i* is not a valid block index
+    size_t bsize(size_t i) const {
+        return (i < m_bsize.size()) ? m_bsize[i] : 0;
+    }
+
+    //! Matrix data. Block row *i* starts at `data[m_loc[i]]`.
+    vector_fp data;
+
+    //! Factorized data. For each block *i*, the \f$ (n_i + n_{i+1}) \times
+    //! n_i \f$ LU factorization of the diagonal block and the block below it,
+    //! starting at `ludata[m_luLoc[i]]`.
+    vector_fp ludata;
+
+    //! Off-diagonal blocks of the upper triangular factor. For each block
+    //! *i*, the \f$ n_i \times (n_{i+1} + n_{i+2}) \f$ array starting at
+    //! `udata[m_uLoc[i]]`.
+    vector_fp udata;
+
+    //! Work array used by factor()
+    vector_fp m_work;
+
+    //! Number of rows and columns of the matrix
+    size_t m_n;
+
+    //! Size of each block
+    std::vector<size_t> m_bsize;
+
+    //! Index of the first row of each block
+    std::vector<size_t> m_bstart;
+
+    //! Block containing each row
+    std::vector<size_t> m_rowBlock;
+
+    //! Location of each block row in #data
+    std::vector<size_t> m_loc;
+
+    //! Location of the factorization of each block in #ludata
+    std::vector<size_t> m_luLoc;
+
+    //! Location of the upper triangular blocks for each block in #udata
+    std::vector<size_t> m_uLoc;
+
+    //! value of zero
+    doublereal m_zero;
+
+    //! Pivot vector. The pivots for block *i* start at `m_ipiv[m_bstart[i]]`
+    //! and are relative to the first row of the block.
+    vector_int m_ipiv;
+};
+
+}
+
+#endif
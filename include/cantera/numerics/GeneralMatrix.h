@@ -29,6 +29,8 @@ public:
      *  @param matType  Matrix type
      *       0 full
      *       1 banded
+     *       2 block tridiagonal
+     *       3 block diagonal
      */
     GeneralMatrix(int matType);
 
@@ -211,6 +213,7 @@ public:
     /*!
      *      0 Square
      *      1 Banded
+     *      2 Block tridiagonal
      */
     int matrixType_;
 
@@ -12,6 +12,7 @@
 #ifndef LAPACK_FTN_TRAILING_UNDERSCORE
 
 #define _DGEMV_   dgemv
+#define _DGEMM_   dgemm
 #define _DGETRF_  dgetrf
 #define _DGETRS_  dgetrs
 #define _DGETRI_  dgetri
@@ -26,6 +27,7 @@
 #define _DGEQRF_  dgeqrf
 #define _DORMQR_  dormqr
 #define _DTRTRS_  dtrtrs
+#define _DTRSM_   dtrsm
 #define _DTRCON_  dtrcon
 #define _DPOTRF_  dpotrf
 #define _DPOTRS_  dpotrs
@@ -33,6 +35,7 @@
 #else
 
 #define _DGEMV_   dgemv_
+#define _DGEMM_   dgemm_
 #define _DGETRF_  dgetrf_
 #define _DGETRS_  dgetrs_
 #define _DGETRI_  dgetri_
@@ -47,6 +50,7 @@
 #define _DGEQRF_  dgeqrf_
 #define _DORMQR_  dormqr_
 #define _DTRTRS_  dtrtrs_
+#define _DTRSM_   dtrsm_
 #define _DTRCON_  dtrcon_
 #define _DPOTRF_  dpotrf_
 #define _DPOTRS_  dpotrs_
@@ -82,6 +86,20 @@ extern "C" {
                 const integer* incY);
 #endif
 
+#ifdef LAPACK_FTN_STRING_LEN_AT_END
+    int _DGEMM_(const char* transA, const char* transB, const integer* m,
+                const integer* n, const integer* k, const doublereal* alpha,
+                const doublereal* a, const integer* lda, const doublereal* b,
+                const integer* ldb, const doublereal* beta, doublereal* c,
+                const integer* ldc, ftnlen trsizeA, ftnlen trsizeB);
+#else
+    int _DGEMM_(const char* transA, ftnlen trsizeA, const char* transB,
+                ftnlen trsizeB, const integer* m, const integer* n,
+                const integer* k, const doublereal* alpha, const doublereal* a,
+                const integer* lda, const doublereal* b, const integer* ldb,
+                const doublereal* beta, doublereal* c, const integer* ldc);
+#endif
+
     int _DGETRF_(const integer* m, const integer* n,
                  doublereal* a, integer* lda, integer* ipiv,
                  integer* info);
@@ -152,6 +170,18 @@ extern "C" {
 #endif
 
 
+#ifdef LAPACK_FTN_STRING_LEN_AT_END
+    int _DTRSM_(const char* side, const char* uplo, const char* trans, const char* diag,
+                const integer* m, const integer* n, const doublereal* alpha,
+                const doublereal* a, const integer* lda, doublereal* b, const integer* ldb,
+                ftnlen sisize, ftnlen upsize, ftnlen trsize, ftnlen disize);
+#else
+    int _DTRSM_(const char* side, ftnlen sisize, const char* uplo, ftnlen upsize,
+                const char* trans, ftnlen trsize, const char* diag, ftnlen disize,
+                const integer* m, const integer* n, const doublereal* alpha,
+                const doublereal* a, const integer* lda, doublereal* b, const integer* ldb);
+#endif
+
 #ifdef LAPACK_FTN_STRING_LEN_AT_END
     int _DTRCON_(const char* norm, const char* uplo, const char* diag, const integer* n,
                  doublereal* a, const integer* lda, const doublereal* rcond,
@@ -230,6 +260,29 @@ inline void ct_dgemv(ctlapack::storage_t storage,
 #endif
 }
 
+inline void ct_dgemm(ctlapack::transpose_t transA, ctlapack::transpose_t transB,
+                     size_t m, size_t n, size_t k, doublereal alpha,
+                     const doublereal* a, size_t lda, const doublereal* b,
+                     size_t ldb, doublereal beta, doublereal* c, size_t ldc)
+{
+    char trA = no_yes[transA];
+    char trB = no_yes[transB];
+    integer f_m = static_cast<integer>(m);
+    integer f_n = static_cast<integer>(n);
+    integer f_k = static_cast<integer>(k);
+    integer f_lda = static_cast<integer>(lda);
+    integer f_ldb = static_cast<integer>(ldb);
+    integer f_ldc = static_cast<integer>(ldc);
+    ftnlen trsize = 1;
+#ifdef LAPACK_FTN_STRING_LEN_AT_END
+    _DGEMM_(&trA, &trB, &f_m, &f_n, &f_k, &alpha, a, &f_lda, b, &f_ldb,
+            &beta, c, &f_ldc, trsize, trsize);
+#else
+    _DGEMM_(&trA, trsize, &trB, trsize, &f_m, &f_n, &f_k, &alpha, a, &f_lda,
+            b, &f_ldb, &beta, c, &f_ldc);
+#endif
+}
+
 inline void ct_dgbsv(int n, int kl, int ku, int nrhs,
                      doublereal* a, int lda, integer* ipiv, doublereal* b, int ldb,
                      int& info)
@@ -398,6 +451,32 @@ inline void ct_dtrtrs(ctlapack::upperlower_t uplot, ctlapack::transpose_t trans,
     info = f_info;
 }
 
+inline void ct_dtrsm(ctlapack::side_t rlside, ctlapack::upperlower_t uplot,
+                     ctlapack::transpose_t trans, const char* diag, size_t m,
+                     size_t n, doublereal alpha, const doublereal* a, size_t lda,
+                     doublereal* b, size_t ldb)
+{
+    char side = left_right[rlside];
+    char uplo = upper_lower[uplot];
+    char tr = no_yes[trans];
+    char dd = 'N';
+    if (diag) {
+        dd = diag[0];
+    }
+    integer f_m = static_cast<integer>(m);
+    integer f_n = static_cast<integer>(n);
+    integer f_lda = static_cast<integer>(lda);
+    integer f_ldb = static_cast<integer>(ldb);
+    ftnlen trsize = 1;
+#ifdef LAPACK_FTN_STRING_LEN_AT_END
+    _DTRSM_(&side, &uplo, &tr, &dd, &f_m, &f_n, &alpha, a, &f_lda, b, &f_ldb,
+            trsize, trsize, trsize, trsize);
+#else
+    _DTRSM_(&side, trsize, &uplo, trsize, &tr, trsize, &dd, trsize, &f_m, &f_n,
+            &alpha, a, &f_lda, b, &f_ldb);
+#endif
+}
+
 /*!
  *  @param work   Must be dimensioned equal to greater than 3N
  *  @param iwork  Must be dimensioned equal to or greater than N
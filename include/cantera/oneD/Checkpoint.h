@@ -0,0 +1,134 @@
+//! @file Checkpoint.h Binary storage of one-dimensional solutions
+
+#ifndef CT_CHECKPOINT_H
+#define CT_CHECKPOINT_H
+
+#include "cantera/base/ct_defs.h"
+
+#include <cstdint>
+
+namespace Cantera
+{
+
+//! The grid and solution of one domain stored in a checkpoint file.
+//! The arrays point into the memory of the CheckpointFile they were read
+//! from, or to the data of the solution being written.
+struct CheckpointDomain
+{
+    CheckpointDomain() : type(0), nComponents(0), nPoints(0), grid(0),
+        values(0) {}
+
+    //! Name of the domain
+    std::string id;
+
+    //! Type of the domain, as returned by Domain1D::domainType()
+    int type;
+
+    size_t nComponents;
+    size_t nPoints;
+
+    //! Names of the solution components
+    std::vector<std::string> componentNames;
+
+    //! Named scalar properties of the domain, e.g. the pressure
+    std::map<std::string, double> parameters;
+
+    //! The grid, of length #nPoints
+    const double* grid;
+
+    //! The solution, stored in the same order as in the solution vector of
+    //! class OneDim, i.e. all components at the first grid point, followed by
+    //! all components at the second grid point, etc.
+    const double* values;
+};
+
+//! A solution stored in a checkpoint file
+struct CheckpointSolution
+{
+    CheckpointSolution() : mechanismHash(0) {}
+
+    std::string id;
+    std::string description;
+    std::string timestamp;
+
+    //! Hash of the species and reactions of the mechanism used to compute
+    //! the solution, used to detect when a solution is restored with a
+    //! different mechanism.
+    uint64_t mechanismHash;
+
+    std::vector<CheckpointDomain> domains;
+};
+
+/**
+ * A file containing one or more named solutions in a compact binary format,
+ * as an alternative to the XML format written by OneDim::save. The file is
+ * mapped into memory when it is opened, and the grids and solutions are
+ * accessed directly from the mapped data, without parsing or copying.
+ *
+ * The file starts with an 8-byte identifier, `CT1DCKPT`, followed by the
+ * format version as a 64-bit integer. This is followed by one record for each
+ * solution. Each record starts with its length in bytes, followed by the id,
+ * description and timestamp of the solution, the mechanism hash, and the
+ * number of domains. For each domain, the record contains the id, the type,
+ * the number of components, grid points and parameters, the component names,
+ * the parameters as name-value pairs, the grid, and the solution. Integers
+ * are stored as 64-bit unsigned integers, and floating point values as
+ * 64-bit doubles, both little-endian. Strings are stored as their length
+ * followed by their characters. All fields are padded to multiples of 8
+ * bytes, so that the arrays in a mapped file are correctly aligned.
+ *
+ * @ingroup onedim
+ */
+class CheckpointFile
+{
+public:
+    //! Open and map the file *fname*.
+    explicit CheckpointFile(const std::string& fname);
+    virtual ~CheckpointFile();
+    CheckpointFile(const CheckpointFile&) = delete;
+    CheckpointFile& operator=(const CheckpointFile&) = delete;
+
+    //! Ids of the solutions in the file, in the order they were written
+    std::vector<std::string> ids() const;
+
+    //! Return true if the file contains a solution with the given id
+    bool hasSolution(const std::string& id) const;
+
+    //! Return the solution with the given id
+    const CheckpointSolution& solution(const std::string& id) const;
+
+    //! Write *soln* to the file *fname*. If the file exists, the solution is
+    //! appended, and the file is restored to its previous length if writing
+    //! fails. A solution with the same id as an existing one replaces it; in
+    //! that case, the file is rewritten and replaced only after the new
+    //! contents have been written completely. An existing file which is not a
+    //! checkpoint file is not overwritten.
+    static void write(const std::string& fname,
+                      const CheckpointSolution& soln);
+
+    //! Return true if *fname* is a checkpoint file
+    static bool isCheckpointFile(const std::string& fname);
+
+protected:
+    //! Read the records of the mapped file
+    void parse();
+
+    //! The mapped data
+    const char* m_data;
+
+    //! Size of the mapped data
+    size_t m_size;
+
+    //! Copy of the file contents on systems where memory mapping is not
+    //! available
+    std::vector<char> m_buffer;
+
+    std::vector<CheckpointSolution> m_solutions;
+
+    //! Offset and length of each record
+    std::vector<std::pair<size_t, size_t> > m_records;
+};
+
+}
+
+#endif
@@ -330,6 +330,51 @@ public:
     virtual void eval(size_t j, doublereal* x, doublereal* r,
                       integer* mask, doublereal rdt=0.0);
 
+    //! Evaluate the residual function at all points, as part of a Jacobian
+    //! evaluation in which several grid points are perturbed at once.
+    /*!
+     * The residual must be computed with the same approximations used by
+     * eval() when *j* != npos, i.e. the steady-state residual, with any
+     * properties which are held fixed while evaluating the Jacobian left
+     * unchanged. The default implementation calls eval() with `j = npos`
+     * and `rdt = 0`, which is appropriate for domains which do not use such
+     * approximations.
+     *
+     *  @param[in] x  State vector
+     *  @param[out] r  residual vector
+     *  @param[out] mask  Boolean mask indicating whether each solution
+     *      component has a time derivative (1) or not (0).
+     */
+    virtual void evalPerturbed(doublereal* x, doublereal* r, integer* mask) {
+        eval(npos, x, r, mask, 0.0);
+    }
+
+    //! Called by MultiJac before the Jacobian is evaluated by finite
+    //! differences.
+    /*!
+     * Domains which compute part of the Jacobian analytically may use this to
+     * leave the corresponding terms out of the perturbed residuals. The base
+     * class method does nothing.
+     *
+     *  @param[in] x  State vector
+     */
+    virtual void startJacobian(doublereal* x) {}
+
+    //! Called by MultiJac after the Jacobian is evaluated by finite
+    //! differences, to add any terms which are computed analytically. The
+    //! base class method does nothing.
+    /*!
+     *  @param[in] x  State vector
+     *  @param jac  The Jacobian, to which the analytic terms are added
+     */
+    virtual void finishJacobian(doublereal* x, MultiJac& jac) {}
+
+    //! Called by MultiJac instead of finishJacobian() if evaluating a
+    //! perturbed residual throws an exception. Domains which changed their
+    //! residual evaluation in startJacobian() should restore it here. The
+    //! base class method does nothing.
+    virtual void abortJacobian() {}
+
     virtual doublereal residual(doublereal* x, size_t n, size_t j) {
         throw CanteraError("Domain1D::residual","residual function must be overloaded in derived class "+id());
     }
@@ -118,7 +118,8 @@ protected:
 class Inlet1D : public Bdry1D
 {
 public:
-    Inlet1D() : Bdry1D(), m_V0(0.0), m_nsp(0), m_flow(0) {
+    Inlet1D() : Bdry1D(), m_V0(0.0), m_tke(0.0), m_ed(0.0), m_nsp(0),
+        m_flow(0) {
         m_type = cInletType;
         m_xstr = "";
     }
@@ -134,6 +135,30 @@ public:
         return m_V0;
     }
 
+    /// Set the turbulent kinetic energy [m^2/s^2]. Used as the boundary
+    /// condition when the k-epsilon equations are enabled in the flow.
+    void setTKE(doublereal tke) {
+        m_tke = tke;
+        needJacUpdate();
+    }
+
+    /// turbulent kinetic energy [m^2/s^2]
+    doublereal TKE() const {
+        return m_tke;
+    }
+
+    /// Set the turbulent dissipation rate [m^2/s^3]. Used as the boundary
+    /// condition when the k-epsilon equations are enabled in the flow.
+    void setED(doublereal ed) {
+        m_ed = ed;
+        needJacUpdate();
+    }
+
+    /// turbulent dissipation rate [m^2/s^3]
+    doublereal ED() const {
+        return m_ed;
+    }
+
     virtual void showSolution(const doublereal* x) {
         writelog("    Mass Flux:   {:10.4g} kg/m^2/s \n", m_mdot);
         writelog("    Temperature: {:10.4g} K \n", m_temp);
@@ -174,6 +199,7 @@ public:
 protected:
     int m_ilr;
     doublereal m_V0;
+    doublereal m_tke, m_ed;
     size_t m_nsp;
     vector_fp m_yin;
     std::string m_xstr;
@@ -8,6 +8,8 @@
 #define CT_MULTIJAC_H
 
 #include "cantera/numerics/BandMatrix.h"
+#include "cantera/numerics/BlockTridiagMatrix.h"
+#include "cantera/numerics/BlockDiagMatrix.h"
 #include "OneDim.h"
 
 namespace Cantera
@@ -18,9 +20,17 @@ namespace Cantera
  * residual function supplied by an instance of class OneDim. The residual
  * function may consist of several linked 1D domains, with different variables
  * in each domain.
+ *
+ * The Jacobian is stored either as a BandMatrix, with a bandwidth large
+ * enough to hold the coupling between the unknowns at neighboring grid
+ * points, or as a BlockTridiagMatrix with one block for each grid point. See
+ * setBlockSolver(). If the Newton iteration uses a Krylov solver, only the
+ * diagonal blocks are stored, as a BlockDiagMatrix, for use as a
+ * preconditioner. See setKrylovSolver(). The GeneralMatrix methods of this
+ * class act on the matrix holding the Jacobian.
  * @ingroup onedim
  */
-class MultiJac : public BandMatrix
+class MultiJac : public GeneralMatrix
 {
 public:
     MultiJac(OneDim& r);
@@ -33,6 +43,113 @@ public:
      */
     void eval(doublereal* x0, doublereal* resid0, double rdt);
 
+    //! Set the number of colors used to evaluate the Jacobian.
+    /*!
+     * If *ncolors* is zero, each column of the Jacobian is evaluated
+     * separately, by perturbing one unknown and evaluating the residual at
+     * the grid points within its domain of influence. Otherwise, the grid
+     * points are divided into *ncolors* groups, where point *j* belongs to
+     * group `j % ncolors`, and each component is perturbed at all points in
+     * a group at once. Since the residual at each point depends only on the
+     * solution at that point and its neighbors, the columns for all of the
+     * perturbed points can be recovered from a single evaluation of the
+     * residual at all points.
+     */
+    void setColors(size_t ncolors) {
+        m_ncolors = ncolors;
+    }
+
+    //! Number of colors used to evaluate the Jacobian
+    size_t colors() const {
+        return m_ncolors;
+    }
+
+    //! Select the storage and factorization of the Jacobian.
+    /*!
+     * If *block* is true, the Jacobian is stored as a BlockTridiagMatrix,
+     * with one block for the unknowns at each grid point, and factored by
+     * block LU decomposition. Otherwise, the Jacobian is stored as a
+     * BandMatrix and factored with the LAPACK banded LU routines, which also
+     * store and operate on the zero elements within the band. The block
+     * storage requires less memory and fewer operations to factor the
+     * Jacobian, especially when the number of components is large. Changing
+     * the storage discards the current Jacobian.
+     */
+    void setBlockSolver(bool block);
+
+    //! True if the Jacobian is stored as a BlockTridiagMatrix, unless
+    //! krylovSolver() is also true
+    bool blockSolver() const {
+        return m_block;
+    }
+
+    //! Store only the diagonal blocks of the Jacobian.
+    /*!
+     * If *krylov* is true, only the blocks coupling the unknowns at each grid
+     * point to each other are stored, as a BlockDiagMatrix, and solve()
+     * applies the block-Jacobi preconditioner used by the Krylov solver of
+     * MultiNewton. Zero pivots of singular diagonal blocks are replaced by
+     * one. This takes precedence over setBlockSolver(). Changing the storage
+     * discards the current Jacobian.
+     */
+    void setKrylovSolver(bool krylov);
+
+    //! True if only the diagonal blocks of the Jacobian are stored
+    bool krylovSolver() const {
+        return m_krylov;
+    }
+
+    //! The matrix holding the Jacobian
+    GeneralMatrix& matrix() {
+        return *m_mat;
+    }
+
+    //! Return a changeable reference to element (i,j) of the Jacobian
+    doublereal& value(size_t i, size_t j) {
+        return (*m_mat)(i,j);
+    }
+
+    //! Return the value of element (i,j) of the Jacobian
+    doublereal value(size_t i, size_t j) const {
+        return static_cast<const GeneralMatrix&>(*m_mat)(i,j);
+    }
+
+    //! Solve the linear system Ax = b using the current Jacobian, which is
+    //! factored first if necessary.
+    /*!
+     * @param b  INPUT RHS of the problem
+     * @param x  OUTPUT solution to the problem
+     * @return a success flag. 0 indicates a success. A positive value *i*
+     *     indicates that the matrix is singular, with the *i*-th diagonal
+     *     element of the upper triangular factor (counting from 1) equal to
+     *     zero.
+     */
+    int solve(const doublereal* const b, doublereal* const x);
+
+    virtual int solve(doublereal* b, size_t nrhs=1, size_t ldb=0);
+    virtual int factor();
+    virtual bool factored() const;
+    virtual void clearFactorFlag();
+    virtual void zero();
+    virtual doublereal& operator()(size_t i, size_t j);
+    virtual doublereal operator()(size_t i, size_t j) const;
+    virtual void mult(const doublereal* b, doublereal* prod) const;
+    virtual void leftMult(const doublereal* const b, doublereal* const prod) const;
+    virtual doublereal rcond(doublereal a1norm);
+    virtual int factorAlgorithm() const;
+    virtual doublereal oneNorm() const;
+    virtual size_t nRows() const;
+    virtual size_t nRowsAndStruct(size_t* const iStruct = 0) const;
+    virtual vector_fp::iterator begin();
+    virtual vector_fp::const_iterator begin() const;
+    virtual doublereal* ptrColumn(size_t j);
+    virtual doublereal* const* colPts();
+    virtual size_t checkRows(doublereal& valueSmall) const;
+    virtual size_t checkColumns(doublereal& valueSmall) const;
+
+    //! Returns a copy of the matrix holding the Jacobian
+    virtual GeneralMatrix* duplMyselfAsGeneralMatrix() const;
+
     //! Elapsed CPU time spent computing the Jacobian.
     doublereal elapsedTime() const {
         return m_elapsed;
@@ -67,6 +184,12 @@ public:
     void incrementDiagonal(int j, doublereal d);
 
 protected:
+    //! Evaluate the Jacobian one column at a time
+    void evalColumns(doublereal* x0, doublereal* resid0, double rdt);
+
+    //! Evaluate the Jacobian by perturbing several grid points at once
+    void evalColored(doublereal* x0, doublereal* resid0);
+
     //! Residual evaluator for this Jacobian
     /*!
      * This is a pointer to the residual evaluator. This object isn't owned by
@@ -74,6 +197,19 @@ protected:
      */
     OneDim* m_resid;
 
+    //! The matrix holding the Jacobian
+    std::unique_ptr<GeneralMatrix> m_mat;
+
+    //! Create the matrix used to store the Jacobian
+    void updateStorage();
+
+    //! Use a BlockTridiagMatrix, unless #m_krylov is set. See
+    //! setBlockSolver().
+    bool m_block;
+
+    //! True if #m_mat is a BlockDiagMatrix. See setKrylovSolver().
+    bool m_krylov;
+
     vector_fp m_r1;
     doublereal m_rtol, m_atol;
     doublereal m_elapsed;
@@ -83,6 +219,16 @@ protected:
     int m_age;
     size_t m_size;
     size_t m_points;
+
+    //! Number of colors used to evaluate the Jacobian. See setColors().
+    size_t m_ncolors;
+
+    //! Unperturbed values of the unknowns at each grid point, used by
+    //! evalColored()
+    vector_fp m_xsave;
+
+    //! Perturbations of the unknowns at each grid point, used by evalColored()
+    vector_fp m_dx;
 };
 }
 
@@ -68,15 +68,152 @@ public:
         m_maxAge = maxJacAge;
     }
 
+    //! Set the options for the Krylov solver.
+    /*!
+     * @param maxIters  Maximum number of GMRES iterations before restarting,
+     *     which is the number of basis vectors that are stored. Each
+     *     iteration requires one evaluation of the residual.
+     * @param rtol  Relative tolerance. The iteration stops when the weighted
+     *     norm of the preconditioned residual is reduced by this factor.
+     * @param maxRestarts  Maximum number of restarts for each Newton step
+     * @see solveKrylov
+     */
+    void setKrylovOptions(size_t maxIters = 50, doublereal rtol = 1.0e-4,
+                          size_t maxRestarts = 10);
+
+    //! Update the Jacobian with the information from each accepted step.
+    /*!
+     * If *maxUpdates* is greater than zero, each accepted Newton step and the
+     * corresponding change in the residual are used to apply a rank-one
+     * secant update to the inverse of the current Jacobian, as described in
+     * addBroydenUpdate(). The updates are applied after each solution with
+     * the factored Jacobian, so the Jacobian does not need to be refactored.
+     * When the Jacobian reaches its maximum age and updates have been
+     * applied to it, its evaluation is deferred for another #m_maxAge steps,
+     * until *maxUpdates* updates have been stored. The updates are
+     * discarded whenever the Jacobian is evaluated, and at the start of each
+     * call to solve(). Broyden updates are not used with the Krylov solver.
+     * The default is 0 (disabled).
+     */
+    void setBroydenUpdates(size_t maxUpdates) {
+        m_maxBroyden = maxUpdates;
+    }
+
+    //! Maximum number of Broyden updates. See setBroydenUpdates().
+    size_t broydenUpdates() const {
+        return m_maxBroyden;
+    }
+
+    //! Number of Broyden updates applied since the last call to
+    //! clearStats().
+    size_t nBroydenUpdates() const {
+        return m_nBroyden;
+    }
+
+    //! Number of Jacobian evaluations that were deferred because of Broyden
+    //! updates since the last call to clearStats().
+    size_t nJacobiansAvoided() const {
+        return m_nAvoided;
+    }
+
+    //! Reset the counters of Broyden updates and avoided Jacobian evaluations
+    void clearStats() {
+        m_nBroyden = 0;
+        m_nAvoided = 0;
+    }
+
     /// Change the problem size.
     void resize(size_t points);
 
 protected:
+    //! Solve for the undamped Newton step with a Jacobian-free Krylov method.
+    /*!
+     * The linear system is solved by GMRES, where the products of the
+     * Jacobian with the Krylov vectors are approximated by differences of
+     * the residual function, and the system is preconditioned on the left
+     * using the diagonal blocks stored by `jac` (see
+     * MultiJac::setKrylovSolver). The inner products are weighted by the
+     * error weights used by norm2(), so that the tolerance applies to the
+     * step in the same norm used to test the convergence of the Newton
+     * iteration. If the tolerance is not reached within the maximum number
+     * of iterations and restarts, #m_krylovFailed is set and the step is
+     * not used.
+     *
+     * @param x  Current solution
+     * @param b  On entry, the negative of the residual at `x`. On return,
+     *     the undamped Newton step.
+     * @param r  Residual function
+     * @param jac  Preconditioner
+     * @param loglevel  Controls amount of diagnostic output
+     * @returns 0 on success, or the error code returned by the
+     *     preconditioner
+     */
+    int solveKrylov(const doublereal* x, doublereal* b, OneDim& r,
+                    MultiJac& jac, int loglevel);
+
+    //! Add a Broyden update for an accepted damped step.
+    /*!
+     * With \f$ H = J^{-1} \f$, the step \f$ s = x_1 - x_0 \f$ and the change
+     * in the residual \f$ y = F(x_1) - F(x_0) \f$, the update is
+     * \f[
+     *     H' = H + \frac{(s - H y) q^T}{q^T H y}, \qquad q = W^{-2} s
+     * \f]
+     * where \f$ W \f$ is the diagonal matrix of error weights. This
+     * satisfies the secant condition \f$ H' y = s \f$ and leaves \f$ H \f$
+     * unchanged for vectors orthogonal to \f$ q \f$. It is neither the
+     * "good" Broyden update, which uses \f$ q = H^T s \f$ and would need a
+     * solve with the transposed Jacobian, nor the "bad" one, which uses
+     * \f$ q = y \f$.
+     *
+     * @param x0  Solution at the start of the step
+     * @param step0  Undamped step at `x0`
+     * @param x1  Solution after taking the damped step
+     * @param step1  Undamped step at `x1`. On return, this is updated to
+     *     the step computed with the updated Jacobian.
+     * @param r  Residual function
+     */
+    void addBroydenUpdate(const doublereal* x0, const doublereal* step0,
+                          const doublereal* x1, doublereal* step1, OneDim& r);
+
+    //! Apply the stored Broyden updates to a step computed with the factored
+    //! Jacobian
+    void applyBroydenUpdates(doublereal* step) const;
+
     //! Work arrays of size #m_n used in solve().
     vector_fp m_x, m_stp, m_stp1;
 
     int m_maxAge;
 
+    //! Maximum number of GMRES iterations. See setKrylovOptions().
+    size_t m_krylovIters;
+
+    //! Relative tolerance for GMRES. See setKrylovOptions().
+    doublereal m_krylovTol;
+
+    //! Maximum number of GMRES restarts. See setKrylovOptions().
+    size_t m_krylovRestarts;
+
+    //! True if the last call to solveKrylov() did not converge
+    bool m_krylovFailed;
+
+    //! Work arrays used by solveKrylov(): the Krylov basis, the error
+    //! weights, the residual at the current solution, the perturbed
+    //! solution and residual, and the scaled step.
+    vector_fp m_basis, m_ewt, m_f0, m_xp, m_fp, m_y;
+
+    //! Maximum number of Broyden updates. See setBroydenUpdates().
+    size_t m_maxBroyden;
+
+    //! Broyden updates to the inverse Jacobian, which is replaced by
+    //! \f$ (I + p_k q_k^T) \cdots (I + p_0 q_0^T) J^{-1} \f$, where the
+    //! vectors \f$ p_k \f$ are stored in #m_broydenP and the vectors
+    //! \f$ q_k \f$ in #m_broydenQ.
+    std::vector<vector_fp> m_broydenP, m_broydenQ;
+
+    //! Counters for the statistics returned by nBroydenUpdates() and
+    //! nJacobiansAvoided()
+    size_t m_nBroyden, m_nAvoided;
+
     //! number of variables
     size_t m_n;
 
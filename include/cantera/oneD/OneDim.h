@@ -7,6 +7,7 @@
 
 #include "Domain1D.h"
 #include "MultiJac.h"
+#include "ThreadPool.h"
 
 namespace Cantera
 {
@@ -169,6 +170,15 @@ public:
     void eval(size_t j, double* x, double* r, doublereal rdt=-1.0,
               int count = 1);
 
+    //! Evaluate the steady-state residual function at all points, with the
+    //! approximations used when evaluating the Jacobian. Used by MultiJac to
+    //! evaluate the Jacobian with several grid points perturbed at once.
+    /*!
+     * @param x  State vector
+     * @param r  On return, contains the residual vector
+     */
+    void evalPerturbed(double* x, double* r);
+
     //! Return a pointer to the domain global point *i* belongs to.
     /*!
      * The domains are scanned right-to-left, and the first one with starting
@@ -184,9 +194,10 @@ public:
     }
 
     /*!
-     * Take time steps using Backward Euler.
+     * Take time steps using Backward Euler, or, if enabled with
+     * setAdaptiveTimeStepping(), using the adaptive BDF2 method.
      *
-     * @param nsteps number of steps
+     * @param nsteps number of steps. Not used with adaptive time stepping.
      * @param dt initial step size
      * @param x current solution vector
      * @param r solution vector after time stepping
@@ -218,6 +229,40 @@ public:
     void setTimeStepFactor(doublereal tfactor) {
         m_tfactor = tfactor;
     }
+
+    //! Use adaptive, error-controlled time stepping in timeStep().
+    /*!
+     * If *adaptive* is true, timeStep() integrates with the variable step,
+     * second order backward differentiation formula (BDF2), starting with a
+     * Backward Euler step. The local error of each step is estimated by
+     * comparison with a quadratic extrapolation of the previous solutions,
+     * and measured in the norm used by the Newton solver with the transient
+     * tolerances of each domain. Steps where this exceeds *errtol* are
+     * rejected and repeated with a smaller step size, which does not require
+     * a new Jacobian. Since only the steady-state solution is of interest,
+     * the default allows errors much larger than the transient tolerances.
+     * After each accepted step, the step size is scaled by the ratio of the
+     * steady-state residual norms (see ssnorm()) before and after the step,
+     * within the limit set by the error estimate. Rather than after a fixed
+     * number of steps, time stepping stops so that the steady-state problem
+     * can be attempted again as soon as the steady-state residual norm is
+     * less than *ssreduction* times its value before the first step, or
+     * after *maxsteps* steps.
+     *
+     * @param adaptive  Enable adaptive time stepping
+     * @param errtol  Tolerance for the estimated local error of each step
+     * @param ssreduction  Factor by which the steady-state residual must be
+     *     reduced before time stepping stops
+     * @param maxsteps  Maximum number of steps taken by each call to
+     *     timeStep()
+     */
+    void setAdaptiveTimeStepping(bool adaptive, double errtol=1.0e5,
+                                 double ssreduction=0.1, int maxsteps=100);
+
+    //! True if adaptive time stepping is used. See setAdaptiveTimeStepping().
+    bool adaptiveTimeStepping() const {
+        return m_ts_adaptive;
+    }
     void setJacAge(int ss_age, int ts_age=-1) {
         m_ss_jac_age = ss_age;
         if (ts_age > 0) {
@@ -227,6 +272,100 @@ public:
         }
     }
 
+    //! Set the number of colors used to evaluate the Jacobian.
+    /*!
+     * If *ncolors* is zero (the default), the Jacobian is evaluated one
+     * column at a time. Otherwise, each component is perturbed at every
+     * *ncolors*-th grid point simultaneously, which requires `ncolors*nv`
+     * evaluations of the residual at all points rather than one evaluation
+     * of the residual at three points for every unknown. This is valid for
+     * residual functions where the residual at each grid point only depends
+     * on the solution at that point and its neighbors, which requires
+     * *ncolors* >= 3.
+     *
+     * @see MultiJac::setColors
+     */
+    void setJacobianColors(size_t ncolors);
+
+    //! Number of colors used to evaluate the Jacobian. See setJacobianColors().
+    size_t jacobianColors() const {
+        return m_jac_colors;
+    }
+
+    //! Select the linear solver used by the Newton iteration.
+    /*!
+     * If *block* is true, the Jacobian is stored as a block tridiagonal
+     * matrix with one block for each grid point, and factored by block LU
+     * decomposition. Otherwise (the default), it is stored as a banded matrix
+     * with bandwidth bandwidth(), and factored with LAPACK.
+     *
+     * @see MultiJac::setBlockSolver
+     */
+    void setBlockSolver(bool block);
+
+    //! True if the block tridiagonal solver is used. See setBlockSolver().
+    bool blockSolver() const {
+        return m_jac_block;
+    }
+
+    //! Use a Jacobian-free Newton-Krylov method to compute the Newton steps.
+    /*!
+     * If *krylov* is true, each Newton step is computed by GMRES using
+     * difference approximations to the products of the Jacobian with the
+     * Krylov vectors, so the full Jacobian is never stored. The iteration
+     * is preconditioned with the diagonal blocks of the Jacobian for each
+     * grid point, which are refreshed according to the same Jacobian age
+     * limits as the full Jacobian. This requires much less memory than the
+     * direct solvers, but since the preconditioner does not couple
+     * neighboring points, the number of iterations grows with the number of
+     * grid points. This option takes precedence over setBlockSolver().
+     *
+     * @see MultiJac::setKrylovSolver, MultiNewton::setKrylovOptions
+     */
+    void setKrylovSolver(bool krylov);
+
+    //! True if the Jacobian-free Krylov solver is used. See
+    //! setKrylovSolver().
+    bool krylovSolver() const {
+        return m_jac_krylov;
+    }
+
+    //! Use Broyden updates to extend the life of each Jacobian.
+    /*!
+     * If *maxUpdates* is greater than zero, each accepted Newton step is
+     * used to update the factored Jacobian, and evaluations of the Jacobian
+     * are deferred while the number of updates is less than *maxUpdates*.
+     * The number of updates and avoided evaluations are reported by
+     * writeStats().
+     *
+     * @see MultiNewton::setBroydenUpdates
+     */
+    void setBroydenUpdates(size_t maxUpdates);
+
+    //! Set the number of threads used to evaluate the residual function.
+    /*!
+     * If *nThreads* is greater than 1, domains may divide the evaluation of
+     * the residual at their grid points among the threads of a ThreadPool.
+     * In StFlow, each thread uses its own copies of the phase and kinetics
+     * objects to evaluate the thermodynamic properties and production
+     * rates. Only evaluations at many grid points at once are divided
+     * among the threads, so the Jacobian is only evaluated in parallel if
+     * colored evaluation is enabled with setJacobianColors(). The default
+     * is 1, i.e. serial evaluation.
+     */
+    void setNumThreads(size_t nThreads);
+
+    //! Number of threads used to evaluate the residual function
+    size_t numThreads() const {
+        return m_pool ? m_pool->size() : 1;
+    }
+
+    //! The thread pool used to evaluate the residual function, or a null
+    //! pointer if the residual is evaluated serially.
+    ThreadPool* threadPool() {
+        return m_pool.get();
+    }
+
     /**
      * Save statistics on function and Jacobian evaluation, and reset the
      * counters. Statistics are saved only if the number of Jacobian
@@ -237,6 +376,10 @@ public:
      * - CPU time spent evaluating Jacobians
      * - number of non-Jacobian function evaluations
      * - CPU time spent evaluating functions
+     * - number of Broyden updates
+     * - number of Jacobian evaluations avoided by Broyden updates
+     *
+     * Nothing is saved while #m_holdStats is set.
      */
     void saveStats();
 
@@ -253,6 +396,10 @@ public:
 protected:
     void evalSSJacobian(doublereal* x, doublereal* xnew);
 
+    //! Take time steps using the adaptive BDF2 method. See timeStep() and
+    //! setAdaptiveTimeStepping().
+    double adaptiveTimeStep(double dt, double* x, double* r, int loglevel);
+
     doublereal m_tmin; //!< minimum timestep size
     doublereal m_tmax; //!< maximum timestep size
 
@@ -279,9 +426,39 @@ protected:
     // options
     int m_ss_jac_age, m_ts_jac_age;
 
+    //! Number of colors used to evaluate the Jacobian
+    size_t m_jac_colors;
+
+    //! Use the block tridiagonal solver. See setBlockSolver().
+    bool m_jac_block;
+
+    //! Use the Jacobian-free Krylov solver. See setKrylovSolver().
+    bool m_jac_krylov;
+
+    //! Use adaptive BDF2 time stepping. See setAdaptiveTimeStepping().
+    bool m_ts_adaptive;
+
+    //! Tolerance for the estimated local error of each adaptive time step
+    double m_ts_errtol;
+
+    //! Reduction of the steady-state residual norm at which adaptive time
+    //! stepping stops
+    double m_ts_ssreduction;
+
+    //! Maximum number of adaptive time steps taken by timeStep()
+    int m_ts_maxsteps;
+
+    //! Threads used to evaluate the residual function
+    std::unique_ptr<ThreadPool> m_pool;
+
     //! Function called at the start of every call to #eval.
     Func1* m_interrupt;
 
+    //! If true, saveStats() does nothing. Used to keep temporary changes to
+    //! the problem, which call Domain1D::needJacUpdate(), from each adding a
+    //! row of statistics.
+    bool m_holdStats;
+
 private:
     // statistics
     int m_nevals;
@@ -291,6 +468,8 @@ private:
     vector_fp m_jacElapsed;
     vector_int m_funcEvals;
     vector_fp m_funcElapsed;
+    std::vector<size_t> m_broydenUpdates;
+    std::vector<size_t> m_jacAvoided;
 };
 
 }
@@ -10,6 +10,8 @@
 namespace Cantera
 {
 
+struct CheckpointSolution;
+
 /**
  * One-dimensional simulations. Class Sim1D extends class OneDim by storing
  * the solution vector, and by adding a hybrid Newton/time-stepping solver.
@@ -88,6 +90,19 @@ public:
 
     //@}
 
+    //! Save the current solution to a file.
+    /*!
+     * If the name of the file ends in `.bin`, the solution is saved in the
+     * binary format of class CheckpointFile, which stores the grid and
+     * solution of each domain, but not settings such as the tolerances or
+     * the enabled equations. Otherwise, it is saved in XML format. In either
+     * case, a solution with the same id already present in the file is
+     * replaced.
+     * @param fname  Name of the file
+     * @param id  Name of the solution within the file
+     * @param desc  Description of the solution
+     * @param loglevel  Controls the amount of diagnostic output.
+     */
     void save(const std::string& fname, const std::string& id,
               const std::string& desc, int loglevel=1);
 
@@ -106,6 +121,88 @@ public:
 
     void solve(int loglevel = 0, bool refine_grid = true);
 
+    //! Solve the problem for a sequence of values of a parameter.
+    /*!
+     * For each of the values in *path* in turn, the parameter is applied to
+     * the domains by calling `setParameter->eval(value)`, and the problem is
+     * solved with solve(). The initial estimate of each solution is a
+     * first-order (secant) extrapolation from the solutions at the two
+     * previous values, if they were obtained on the same grid, or otherwise
+     * the previous solution. The grid and the Jacobian of the previous
+     * solution are retained. If no solution is found, the previous solution
+     * is restored and the step in the parameter is halved, up to
+     * *maxHalvings* times, before the continuation is stopped. Failure with
+     * the smallest step often indicates a turning point in the solution
+     * branch, such as the extinction point of a strained flame, which can be
+     * followed with arcLengthContinuation().
+     *
+     * @param setParameter  Function which applies a value of the parameter,
+     *     for example by setting the mass flow rate or temperature of an
+     *     inlet, the turbulence inputs of the flow domain, or the pressure.
+     *     The value returned by the function is ignored.
+     * @param path  Values of the parameter. The current solution is the
+     *     initial estimate for the first value.
+     * @param loglevel  Controls the amount of diagnostic output.
+     * @param refine_grid  If true, the grid is refined for each solution.
+     * @param fname  If not empty, each converged solution is saved to this
+     *     file as soon as it is obtained, with the ids `<id>_0`, `<id>_1`,
+     *     etc. The value of the parameter is saved in the description.
+     * @param id  Prefix for the ids of the saved solutions.
+     * @param maxHalvings  Maximum number of times the step in the parameter
+     *     is halved before the continuation is stopped.
+     * @returns  The values of the parameter, including any intermediate
+     *     values introduced by halving the step, for which solutions were
+     *     obtained. On return, the solution and the parameter correspond to
+     *     the last of these values.
+     */
+    vector_fp continuation(Func1* setParameter, const vector_fp& path,
+                           int loglevel=0, bool refine_grid=true,
+                           const std::string& fname="",
+                           const std::string& id="continuation",
+                           size_t maxHalvings=4);
+
+    //! Follow a solution branch with pseudo-arclength continuation.
+    /*!
+     * The current solution must be converged for the value *p0* of the
+     * parameter. A first step to `p0 + dp` is taken with solve(). Each
+     * subsequent step is predicted along the secant through the two previous
+     * solutions, and corrected with Newton iterations on the steady-state
+     * problem augmented with the parameter as an unknown and the constraint
+     * that the step has a prescribed arclength, measured in the error-weighted
+     * norm used by the Newton solver. The augmented linear systems are solved
+     * by block elimination with the factored Jacobian, so that the branch can
+     * be followed through turning points where the Jacobian of the
+     * steady-state problem alone becomes singular. The grid is fixed during
+     * the continuation. The arclength is increased after steps which converge
+     * quickly, and halved after steps which fail to converge. A turning point
+     * is recorded whenever the direction of change in the parameter reverses;
+     * see turningPoints(). The Krylov solver is not supported.
+     *
+     * @param setParameter  Function which applies a value of the parameter.
+     *     See continuation().
+     * @param p0  Value of the parameter for the current solution
+     * @param dp  Step in the parameter for the first step. Its sign sets the
+     *     initial direction along the branch.
+     * @param nSteps  Number of steps to take
+     * @param loglevel  Controls the amount of diagnostic output.
+     * @param fname  If not empty, each converged solution is saved to this
+     *     file, as for continuation().
+     * @param id  Prefix for the ids of the saved solutions.
+     * @returns  The values of the parameter along the branch, beginning with
+     *     *p0*. On return, the solution and the parameter correspond to the
+     *     last of these values.
+     */
+    vector_fp arcLengthContinuation(Func1* setParameter, double p0, double dp,
+                                    size_t nSteps, int loglevel=0,
+                                    const std::string& fname="",
+                                    const std::string& id="arclength");
+
+    //! Approximate values of the parameter at the turning points found by
+    //! the last call to arcLengthContinuation().
+    const vector_fp& turningPoints() const {
+        return m_turningPoints;
+    }
+
     void eval(doublereal rdt=-1.0, int count = 1) {
         OneDim::eval(npos, m_x.data(), m_xnew.data(), rdt, count);
     }
@@ -113,6 +210,18 @@ public:
     /// Refine the grid in all domains.
     int refine(int loglevel=0);
 
+    //! Remove grid points which are not needed to satisfy the refinement
+    //! criteria, in all domains where the `prune` criterion is positive and
+    //! no new points are needed. See Refiner::setCriteria. This is done by
+    //! solve() once the grid no longer needs refinement, so that the grid
+    //! does not keep points which are no longer needed after the solution
+    //! has changed, e.g. during continuation.
+    /*!
+     * @param loglevel  Controls the amount of diagnostic output.
+     * @returns  The number of points removed
+     */
+    int coarsen(int loglevel=0);
+
     //! Add node for fixed temperature point of freely propagating flame
     int setFixedTemperature(doublereal t);
 
@@ -134,7 +243,18 @@ public:
     void setGridMin(int dom, double gridmin);
 
     //! Initialize the solution with a previously-saved solution.
-    void restore(const std::string& fname, const std::string& id, int loglevel=2);
+    /*!
+     * The file may be either an XML file or a binary checkpoint file written
+     * by save(), which is recognized from its contents.
+     * @param fname  Name of the file
+     * @param id  Name of the solution within the file
+     * @param loglevel  Controls the amount of diagnostic output.
+     * @param keep_grid  If true, the saved solution is interpolated onto the
+     *     current grid of each domain. Otherwise, the grid is replaced with
+     *     the saved grid.
+     */
+    void restore(const std::string& fname, const std::string& id,
+                 int loglevel=2, bool keep_grid=false);
 
     void getInitialSoln();
 
@@ -164,6 +284,9 @@ protected:
     //! solution
     vector_int m_steps;
 
+    //! Turning points found by arcLengthContinuation()
+    vector_fp m_turningPoints;
+
 private:
     /// Calls method _finalize in each domain.
     void finalize();
@@ -173,6 +296,35 @@ private:
      * @return 0 if successful, -1 on failure
      */
     int newtonSolve(int loglevel);
+
+    //! Replace the grid of each domain and the solution vector with a state
+    //! saved during continuation, and return to steady-state mode.
+    void setGridAndSolution(const std::vector<vector_fp>& grids,
+                            const vector_fp& x);
+
+    //! Limit each component of `x` to the bounds of its domain.
+    void clipToBounds(vector_fp& x);
+
+    //! Describe the current solution for saving as a checkpoint. The
+    //! returned object refers to the solution vector and to *grids*, which
+    //! is set to the grid of each domain.
+    CheckpointSolution checkpoint(const std::string& id,
+                                  const std::string& desc,
+                                  std::vector<vector_fp>& grids);
+
+    //! Set the solution and grid from a saved solution. Components are
+    //! matched by name, and missing components are set to zero.
+    /*!
+     * @param soln  The saved solution
+     * @param keep_grid  If true, interpolate the saved solution onto the
+     *     current grid. Otherwise, use the saved grid.
+     * @param loglevel  Controls the amount of diagnostic output.
+     */
+    void restoreSolution(const CheckpointSolution& soln, bool keep_grid,
+                         int loglevel);
+
+    //! Hash of the species and reactions of each flow domain
+    uint64_t mechanismHash();
 };
 
 }
@@ -13,6 +13,8 @@
 #include "cantera/kinetics/Kinetics.h"
 #include "cantera/kinetics/RxnRates.h"
 
+#include <functional>
+
 namespace Cantera
 {
 
@@ -26,7 +28,9 @@ const size_t c_offset_V = 1; // strain rate
 const size_t c_offset_T = 2; // temperature
 const size_t c_offset_L = 3; // (1/r)dP/dr
 const size_t c_offset_TT = 4;   //Temperature Fluctuations
-const size_t c_offset_Y = 5;    // mass fractions
+const size_t c_offset_K = 5;    // turbulent kinetic energy
+const size_t c_offset_E = 6;    // turbulent dissipation rate
+const size_t c_offset_Y = 7;    // mass fractions
 
 // Transport option flags
 const int c_Mixav_Transport = 0;
@@ -75,11 +79,15 @@ public:
 	 */
 	void setThermo(IdealGasPhase& th) {
 		m_thermo = &th;
+		m_threadThermo.clear();
+		m_threadKin.clear();
 	}
 
 	//! Set the kinetics manager. The kinetics manager must
 	void setKinetics(Kinetics& kin) {
 		m_kin = &kin;
+		m_threadThermo.clear();
+		m_threadKin.clear();
 	}
 
 	//! set the transport manager
@@ -106,19 +114,39 @@ public:
 		return Tprime();
 	}
 
-	//! Set the Turbulent Kinetic Energy
+	//! Set a uniform Turbulent Kinetic Energy [m^2/s^2]
 	void setTKE(doublereal TKE) {
-		m_TKE = TKE;
+		m_zTKE.assign(1, 0.0);
+		m_TKEprof.assign(1, TKE);
+		updateTurbulenceProfiles();
 	}
 
-	//! The current Turbulent Kinetic Energy
-	doublereal TKE() const {
-		return m_TKE;
+	//! Set the profile of the Turbulent Kinetic Energy [m^2/s^2]. The
+	//! profile is interpolated onto the grid, and again whenever the grid
+	//! is changed.
+	//! @param zfixed  relative positions from 0 to 1
+	//! @param TKE  values at the positions in zfixed
+	void setTKEProfile(const vector_fp& zfixed, const vector_fp& TKE);
+
+	//! The Turbulent Kinetic Energy at point j
+	doublereal TKE(size_t j) const {
+		return m_TKE[j];
 	}
 
-	//! Set the turbulent dissipation 
+	//! Set a uniform turbulent dissipation rate [m^2/s^3]
 	void setED(doublereal ED) {
-		m_ED = ED;
+		m_zED.assign(1, 0.0);
+		m_EDprof.assign(1, ED);
+		updateTurbulenceProfiles();
+	}
+
+	//! Set the profile of the turbulent dissipation rate [m^2/s^3]. See
+	//! setTKEProfile().
+	void setEDProfile(const vector_fp& zfixed, const vector_fp& ED);
+
+	//! The turbulent dissipation rate at point j
+	doublereal ED(size_t j) const {
+		return m_ED[j];
 	}
 
 	// Getter for Turbulent Viscosity
@@ -132,17 +160,14 @@ public:
 	doublereal setTT_Out(size_t j) const {
 		return TT_Out[j];
 	}
-	   
-	//! The current turbulent dissipation
-    doublereal ED() const {
-        return m_ED;
-    }
 
     //! Write the initial solution estimate into array x.
     virtual void _getInitialSoln(doublereal* x) {
         for (size_t j = 0; j < m_points; j++) {
             T(x,j) = m_thermo->temperature();
 			TT(x, j) = m_thermo->temperature();
+			K(x, j) = m_TKE[j];
+			Eps(x, j) = m_ED[j];
             m_thermo->getMassFractions(&Y(x, 0, j));
         }
     }
@@ -237,6 +262,52 @@ public:
         return m_do_radiation;
     }
 
+    //! Turn the analytic chemical source term Jacobian on / off.
+    /*!
+     *  When enabled, the derivatives of the species production rates with
+     *  respect to the species mass fractions are computed from the
+     *  derivatives provided by the kinetics manager, and the derivatives with
+     *  respect to the temperature and the temperature fluctuation with one
+     *  additional evaluation of the production rates each. The rest of the
+     *  Jacobian is evaluated by finite differences with the production rates
+     *  held fixed, which avoids evaluating them for each perturbation. The
+     *  kinetics manager must implement Kinetics::getNetProductionRates_ddC().
+     */
+    void enableChemicalJacobian(bool chemJac) {
+        m_do_chemJac = chemJac;
+        needJacUpdate();
+    }
+
+    //! Returns `true` if the analytic chemical source term Jacobian is enabled
+    bool chemicalJacobianEnabled() const {
+        return m_do_chemJac;
+    }
+
+    //! Turn the k-epsilon equations on / off.
+    /*!
+     *  When enabled, the turbulent kinetic energy and dissipation rate are
+     *  solved for with the standard k-epsilon model, using the values set on
+     *  the inlets as boundary conditions. When disabled (the default), they
+     *  are held to the profiles set with setTKE() / setTKEProfile() and
+     *  setED() / setEDProfile().
+     */
+    void solveTurbulence(bool doTurbulence) {
+        if (doTurbulence != m_do_turbulence) {
+            m_do_turbulence = doTurbulence;
+            if (!doTurbulence) {
+                updateTurbulenceProfiles();
+            }
+            needJacUpdate();
+        }
+        m_refiner->setActive(c_offset_K, doTurbulence);
+        m_refiner->setActive(c_offset_E, doTurbulence);
+    }
+
+    //! Returns `true` if the k-epsilon equations are enabled
+    bool turbulenceEnabled() const {
+        return m_do_turbulence;
+    }
+
     //! Set the emissivities for the boundary values
     /*!
      * Reads the emissivities for the left and right boundary values in the
@@ -300,6 +371,10 @@ public:
     //! Set the gas object state to be consistent with the solution at point j.
     void setGas(const doublereal* x, size_t j);
 
+    //! Set the state of the gas object used by thread `thread` to be
+    //! consistent with the solution at point j.
+    void setGas(const doublereal* x, size_t j, size_t thread);
+
     //! Set the gas state to be consistent with the solution at the midpoint
     //! between j and j + 1.
     void setGasAtMidpoint(const doublereal* x, size_t j);
@@ -325,6 +400,12 @@ public:
     virtual void eval(size_t j, doublereal* x, doublereal* r,
                       integer* mask, doublereal rdt);
 
+    virtual void evalPerturbed(doublereal* x, doublereal* r, integer* mask);
+
+    virtual void startJacobian(doublereal* x);
+    virtual void finishJacobian(doublereal* x, MultiJac& jac);
+    virtual void abortJacobian();
+
     //! Evaluate all residual components at the right boundary.
     virtual void evalRightBoundary(doublereal* x, doublereal* res,
                                    integer* diag, doublereal rdt) = 0;
@@ -334,6 +415,49 @@ public:
     virtual void evalContinuity(size_t j, doublereal* x, doublereal* r,
                                 integer* diag, doublereal rdt) = 0;
 
+    //! Evaluate the residual function at grid points *jmin* through *jmax*.
+    /*!
+     * @param x  local part of the state vector
+     * @param rsd  local part of the residual vector
+     * @param diag  local part of the time derivative mask
+     * @param rdt  Reciprocal of the timestep
+     * @param jmin, jmax  range of grid points to evaluate
+     * @param updateTrans  update the transport properties. These are held
+     *     fixed when evaluating the Jacobian.
+     * @param fixedRad  use the radiative fluxes from the boundaries computed
+     *     in the last evaluation, rather than the current boundary
+     *     temperatures
+     */
+    void evalPoints(doublereal* x, doublereal* rsd, integer* diag,
+                    doublereal rdt, size_t jmin, size_t jmax,
+                    bool updateTrans, bool fixedRad);
+
+    //! Evaluate all residual components at grid point `j`, using the phase
+    //! and kinetics objects of thread `thread`.
+    void evalPoint(size_t j, doublereal* x, doublereal* rsd, integer* diag,
+                   doublereal rdt, size_t thread);
+
+    //! Evaluate the derivatives of the chemical source terms in the species
+    //! and energy equations at the interior grid point `j`, using the phase
+    //! and kinetics objects of thread `thread`.
+    /*!
+     * @param x  local part of the state vector
+     * @param j  grid point
+     * @param thread  thread index
+     * @param jac  Output array of size (#m_nsp + 1) * (#m_nsp + 2) containing
+     *     the derivatives of the residuals of the species equations and the
+     *     energy equation (rows) with respect to the species mass fractions,
+     *     temperature, and the temperature fluctuation (columns), in
+     *     column-major order
+     */
+    void evalChemicalJacobian(doublereal* x, size_t j, size_t thread,
+                              doublereal* jac);
+
+    //! Evaluate the residuals of the k-epsilon equations at the interior grid
+    //! point j.
+    void evalTurbulence(size_t j, doublereal* x, doublereal* rsd,
+                        integer* diag, doublereal rdt);
+
 protected:
     doublereal component(const doublereal* x, size_t i, size_t j) const {
         return x[index(i,j)];
@@ -351,25 +475,42 @@ protected:
         return m_wdot(k,j);
     }
 
-    //! Write the net production rates at point `j` into array `m_wdot`
-    void getWdot(doublereal* x, size_t j) {
-        setGas(x,j);
-        m_kin->getNetProductionRates(&m_wdot(0,j));
+    //! Write the net production rates at point `j` into array `m_wdot`, using
+    //! the phase and kinetics objects of thread `thread`
+    void getWdot(doublereal* x, size_t j, size_t thread=0) {
+        setGas(x, j, thread);
+        threadKinetics(thread).getNetProductionRates(&m_wdot(0,j));
     }
 
     /**
      * Update the thermodynamic properties from point j0 to point j1
      * (inclusive), based on solution x.
      */
-    void updateThermo(const doublereal* x, size_t j0, size_t j1) {
-        for (size_t j = j0; j <= j1; j++) {
-            setGas(x,j);
-            m_rho[j] = m_thermo->density();
-            m_wtm[j] = m_thermo->meanMolecularWeight();
-            m_cp[j] = m_thermo->cp_mass();
-        }
+    void updateThermo(const doublereal* x, size_t j0, size_t j1);
+
+    //! The phase object used by thread `thread` of the container's
+    //! ThreadPool. Thread 0 uses #m_thermo.
+    IdealGasPhase& threadThermo(size_t thread) {
+        return thread ? *m_threadThermo[thread-1] : *m_thermo;
+    }
+
+    //! The kinetics object used by thread `thread` of the container's
+    //! ThreadPool. Thread 0 uses #m_kin.
+    Kinetics& threadKinetics(size_t thread) {
+        return thread ? *m_threadKin[thread-1] : *m_kin;
     }
 
+    //! Call `f(j, thread)` for each grid point `j` from `j0` to `j1 - 1`.
+    /*!
+     * If the container has a ThreadPool and there are enough points, the
+     * points are divided among its threads, and *thread* is the index of the
+     * thread making the call. Otherwise, *thread* is always 0. *f* may use
+     * threadThermo() and threadKinetics() and may write the properties of
+     * point `j`, but must not modify any other shared data.
+     */
+    void forEachPoint(size_t j0, size_t j1,
+                      const std::function<void(size_t, size_t)>& f);
+
     //--------------------------------
     // central-differenced derivatives
     //--------------------------------
@@ -406,6 +547,30 @@ protected:
     doublereal TT_prev(size_t j) const {
         return prevSoln(c_offset_TT, j);
     }
+
+    doublereal K(const doublereal* x, size_t j) const {
+        return x[index(c_offset_K, j)];
+    }
+
+    doublereal& K(doublereal* x, size_t j) {
+        return x[index(c_offset_K, j)];
+    }
+
+    doublereal K_prev(size_t j) const {
+        return prevSoln(c_offset_K, j);
+    }
+
+    doublereal Eps(const doublereal* x, size_t j) const {
+        return x[index(c_offset_E, j)];
+    }
+
+    doublereal& Eps(doublereal* x, size_t j) {
+        return x[index(c_offset_E, j)];
+    }
+
+    doublereal Eps_prev(size_t j) const {
+        return prevSoln(c_offset_E, j);
+    }
 	
 	doublereal rho_u(const doublereal* x, size_t j) const {
         return m_rho[j]*x[index(c_offset_U, j)];
@@ -464,6 +629,16 @@ protected:
         size_t jloc = (u(x,j) > 0.0 ? j : j + 1);
         return (T(x,jloc) - T(x,jloc-1))/m_dz[jloc-1];
     }
+
+    doublereal dKdz(const doublereal* x, size_t j) const {
+        size_t jloc = (u(x,j) > 0.0 ? j : j + 1);
+        return (K(x,jloc) - K(x,jloc-1))/m_dz[jloc-1];
+    }
+
+    doublereal dEpsdz(const doublereal* x, size_t j) const {
+        size_t jloc = (u(x,j) > 0.0 ? j : j + 1);
+        return (Eps(x,jloc) - Eps(x,jloc-1))/m_dz[jloc-1];
+    }
 	doublereal dudz(const doublereal* x, size_t j) const {
 		size_t jloc = (u(x, j) > 0.0 ? j : j + 1);
 		return (u(x, jloc) - u(x, jloc - 1)) / (m_z[j] - m_z[j - 1]);
@@ -483,13 +658,24 @@ protected:
     }
 
 	doublereal divHeatFlux(const doublereal* x, size_t j) const {
-		doublereal c1 = ((m_tcon[j-1])+(((m_cp[j-1]*m_rho[j-1]*m_TKE*m_TKE*0.09)/(0.85*m_ED))))*(T(x,j) - T(x,j-1));
-		doublereal c2 = ((m_tcon[j])+(((m_cp[j]*m_rho[j]*m_TKE*m_TKE*0.09)/(0.85*m_ED))))*(T(x,j+1) - T(x,j));
+		doublereal c1 = (m_tcon[j-1] + m_tconTurb[j-1])*(T(x,j) - T(x,j-1));
+		doublereal c2 = (m_tcon[j] + m_tconTurb[j])*(T(x,j+1) - T(x,j));
 		//doublereal c1 = ((m_tcon[j-1]))*(T(x,j) - T(x,j-1));
 		//doublereal c2 = ((m_tcon[j]))*(T(x,j+1) - T(x,j));      
 		return -2.0*(c2/(z(j+1) - z(j)) - c1/(z(j) - z(j-1)))/(z(j+1) - z(j-1));
     }
 
+    //! Divergence of the diffusive flux of component `n` (k or epsilon), for
+    //! an effective viscosity of \f$ \mu + \mu_t / \sigma \f$.
+    doublereal divTurbFlux(const doublereal* x, size_t n, doublereal sigma,
+                           size_t j) const {
+        doublereal mu1 = m_visc[j-1] + 0.5*(viscTurb[j-1] + viscTurb[j])/sigma;
+        doublereal mu2 = m_visc[j] + 0.5*(viscTurb[j] + viscTurb[j+1])/sigma;
+        doublereal c1 = mu1*(x[index(n,j)] - x[index(n,j-1)]);
+        doublereal c2 = mu2*(x[index(n,j+1)] - x[index(n,j)]);
+        return -2.0*(c2/(z(j+1) - z(j)) - c1/(z(j) - z(j-1)))/(z(j+1) - z(j-1));
+    }
+
 	doublereal divFlux_TT(const doublereal* x, size_t j) const {
 		
         size_t jloc = (u(x,j) > 0.0 ? j : j + 1);
@@ -537,6 +723,9 @@ protected:
     //! Update the diffusive mass fluxes.
     void updateDiffFluxes(const doublereal* x, size_t j0, size_t j1);
 
+    //! Interpolate the TKE and epsilon profiles onto the current grid
+    void updateTurbulenceProfiles();
+
     //---------------------------------------------------------
     //             member data
     //---------------------------------------------------------
@@ -554,19 +743,37 @@ protected:
     vector_fp m_wt;
     vector_fp m_cp;
 
-	//Epsilon
-	doublereal m_ED;
-	//Turbulent Kinetic Energy
-	doublereal m_TKE;
+	//Epsilon and Turbulent Kinetic Energy at each grid point
+	vector_fp m_ED;
+	vector_fp m_TKE;
+
+	// Profiles of epsilon and TKE set by the user, as (relative position,
+	// value) pairs
+	vector_fp m_zED;
+	vector_fp m_EDprof;
+	vector_fp m_zTKE;
+	vector_fp m_TKEprof;
+
+	// Turbulent viscosity at each grid point
 	vector_fp viscTurb;
 	vector_fp TT_Out;
 
+	// Turbulent thermal conductivity and eddy diffusivity at the midpoints
+	vector_fp m_tconTurb;
+	vector_fp m_diffTurb;
+
     // transport properties
     vector_fp m_visc;
     vector_fp m_tcon;
     vector_fp m_diff;
     vector_fp m_multidiff;
     Array2D m_dthermal;
+
+    // temperature, pressure and mole fractions at the midpoints, used to
+    // evaluate the mixture-averaged transport properties
+    vector_fp m_tmid;
+    vector_fp m_pmid;
+    vector_fp m_xmid;
     Array2D m_flux;
 
     // production rates
@@ -577,6 +784,12 @@ protected:
     IdealGasPhase* m_thermo;
     Kinetics* m_kin;
     Transport* m_trans;
+
+    //! Copies of #m_thermo and #m_kin used by threads 1, 2, ... of the
+    //! container's ThreadPool. Created when first needed, and discarded when
+    //! the phase or kinetics objects may have been changed.
+    std::vector<std::unique_ptr<IdealGasPhase>> m_threadThermo;
+    std::vector<std::unique_ptr<Kinetics>> m_threadKin;
 	Arrhenius* m_arrh;
 
     MultiJac* m_jac;
@@ -599,10 +812,30 @@ protected:
     //! flag for the radiative heat loss
     bool m_do_radiation;
 
+    //! flag for solving the k-epsilon equations
+    bool m_do_turbulence;
+
+    //! flag for the analytic chemical source term Jacobian
+    bool m_do_chemJac;
+
+    //! `true` while a Jacobian is being evaluated with the production rates
+    //! held fixed, i.e. between startJacobian() and finishJacobian()
+    bool m_frozenWdot;
+
+    //! Derivatives of the chemical source terms computed by
+    //! evalChemicalJacobian() for each grid point
+    Array2D m_chemJac;
+
+    //! Work arrays for evalChemicalJacobian(), for each thread
+    std::vector<vector_fp> m_chemWork;
+
     //! radiative heat loss vector
 
     vector_fp m_qdotRadiation;
 
+    //! radiative fluxes emitted by the left and right boundaries
+    doublereal m_boundaryRad[2];
+
 
     // fixed T and Y values
 
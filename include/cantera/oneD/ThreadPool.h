@@ -0,0 +1,88 @@
+//! @file ThreadPool.h
+
+#ifndef CT_THREADPOOL_H
+#define CT_THREADPOOL_H
+
+#include "cantera/base/ct_defs.h"
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace Cantera
+{
+
+/**
+ * A fixed set of worker threads used to evaluate loops over grid points in
+ * parallel. Used by class OneDim.
+ *
+ * The worker threads are started by the constructor and wait until work is
+ * submitted with parallelFor(). The thread calling parallelFor() takes part
+ * in the work, so a pool of size *n* starts *n* - 1 additional threads.
+ * @ingroup onedim
+ */
+class ThreadPool
+{
+public:
+    //! Constructor
+    //! @param nThreads Total number of threads, including the calling thread
+    explicit ThreadPool(size_t nThreads);
+    virtual ~ThreadPool();
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    //! Total number of threads, including the calling thread
+    size_t size() const {
+        return m_threads.size() + 1;
+    }
+
+    //! Divide the range [*begin*, *end*) into size() contiguous blocks, and
+    //! call `f(i0, i1, thread)` for each non-empty block [*i0*, *i1*), where
+    //! *thread* is in the range [0, size()). The first block is evaluated by
+    //! the calling thread. Returns once all of the blocks have been
+    //! evaluated. If any call to *f* throws an exception, the first such
+    //! exception is rethrown in the calling thread.
+    void parallelFor(size_t begin, size_t end,
+                     const std::function<void(size_t, size_t, size_t)>& f);
+
+protected:
+    //! Main loop of the worker thread with index *thread*
+    void work(size_t thread);
+
+    //! Evaluate the block of the current range assigned to *thread*
+    void runBlock(size_t thread);
+
+    std::vector<std::thread> m_threads;
+    std::mutex m_mutex;
+
+    //! Signals the worker threads that new work is available
+    std::condition_variable m_start;
+
+    //! Signals the calling thread that all blocks have been evaluated
+    std::condition_variable m_done;
+
+    //! The function being evaluated
+    const std::function<void(size_t, size_t, size_t)>* m_func;
+
+    size_t m_begin; //!< Start of the current range
+    size_t m_end; //!< End of the current range
+    size_t m_blockSize; //!< Number of elements in each block
+
+    //! Incremented each time work is submitted
+    size_t m_generation;
+
+    //! Number of worker threads which have not finished the current work
+    size_t m_pending;
+
+    //! Set by the destructor to stop the worker threads
+    bool m_stop;
+
+    //! First exception thrown while evaluating the current work
+    std::exception_ptr m_error;
+};
+
+}
+
+#endif
@@ -24,9 +24,13 @@ public:
      *      component between adjacent grid points
      *  @param curve Maximum fractional change in the derivative of each
      *      solution component between adjacent grid points.
-     *  @param prune Threshold for removing unnecessary grid points. `prune`
-     *      should be smaller than both `slope` and `curve`. Set `prune <= 0`
-     *      to disable pruning.
+     *  @param prune Threshold for removing unnecessary grid points. A point
+     *      is removed if, without it, the changes in value and slope of each
+     *      solution component between adjacent grid points would still be
+     *      smaller than the fractions `prune` of their ranges. `prune` must be
+     *      smaller than both `slope` and `curve`; the margin between them
+     *      prevents removed points from being inserted again by the next
+     *      refinement. Set `prune <= 0` to disable pruning.
      */
     void setCriteria(doublereal ratio = 10.0,
                      doublereal slope = 0.8,
@@ -53,6 +57,9 @@ public:
         return m_gridmin;
     }
 
+    //! Determine where points should be inserted in or removed from the
+    //! grid. Points are marked for removal only if no new points are needed.
+    //! @returns the number of new points needed
     int analyze(size_t n, const doublereal* z, const doublereal* x);
     int getNewGrid(int n, const doublereal* z, int nn, doublereal* znew);
     int nNewPoints() {
@@ -62,6 +69,14 @@ public:
     bool newPointNeeded(size_t j) {
         return m_loc.find(j) != m_loc.end();
     }
+    //! Number of points marked for removal by the last call to analyze()
+    int nRemovedPoints() {
+        int nr = 0;
+        for (const auto& k : m_keep) {
+            nr += (k.second == -1);
+        }
+        return nr;
+    }
     bool keepPoint(size_t j) {
         return (m_keep[j] != -1);
     }
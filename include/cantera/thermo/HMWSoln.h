@@ -2342,6 +2342,34 @@ private:
      */
     mutable vector_int m_CounterIJ;
 
+    //! List of the counterIJ values for the binary interactions that have at
+    //! least one nonzero Beta0, Beta1, Beta2, Cphi or Theta coefficient.
+    /*!
+     * Compiled once the Pitzer parameters are known, in
+     * compilePitzerInteractionLists_(). The temperature dependent binary
+     * coefficients are only updated for these entries; all others are zero.
+     */
+    std::vector<size_t> m_PitzerPairList;
+
+    //! List of the entries, n = m_kk*i + j, of the Lambda_nj interaction
+    //! matrix that have nonzero temperature coefficients.
+    std::vector<size_t> m_LambdaList;
+
+    //! List of the entries, n = m_kk*m_kk*i + m_kk*j + k, of m_Psi_ijk which
+    //! have nonzero coefficients and which contribute to the activity
+    //! coefficient or osmotic coefficient expressions.
+    /*!
+     * The Psi and Zeta ternary terms are evaluated by looping over this list
+     * rather than over all m_kk^3 combinations of species. See
+     * s_updatePitzer_PsiSums().
+     */
+    std::vector<size_t> m_PsiList;
+
+    //! Ternary (Psi and Zeta) contributions to the log of the activity
+    //! coefficient of each species. Length = m_kk. Work array used by
+    //! s_updatePitzer_PsiSums().
+    mutable vector_fp m_PsiSum;
+
     //! This is elambda, MEC
     mutable double elambda[17];
 
@@ -2648,6 +2676,14 @@ private:
     void calc_lambdas(double is) const;
     mutable doublereal m_last_is;
 
+    //! Temperature at which the Pitzer coefficients were last evaluated in
+    //! s_updatePitzer_CoeffWRTemp().
+    /*!
+     * The Pitzer coefficients only depend on temperature, so they don't need
+     * to be reevaluated when only the pressure or the composition changes.
+     */
+    mutable doublereal m_lastPitzerCoeffT;
+
     /**
      * Calculate etheta and etheta_prime
      *
@@ -2679,6 +2715,32 @@ private:
      */
     void counterIJ_setup() const;
 
+    //! Compile the lists of nonzero Pitzer interaction parameters
+    /*!
+     * This is called once all of the Pitzer parameters have been read in. It
+     * fills in m_PitzerPairList, m_LambdaList and m_PsiList so that the
+     * temperature updates of the coefficients and the ternary terms in the
+     * activity coefficient expressions only visit the interactions that are
+     * actually present in the parameter database.
+     */
+    void compilePitzerInteractionLists_();
+
+    //! Calculate the ternary Psi and Zeta contributions from the sparse
+    //! list of triplets
+    /*!
+     * On return, m_PsiSum[i] contains the contribution of the Psi and Zeta
+     * terms to the log of the activity coefficient of species i, or to its
+     * derivative, depending on which set of coefficients is supplied.
+     *
+     * @param psi   Psi coefficients to use. One of m_Psi_ijk, m_Psi_ijk_L,
+     *              m_Psi_ijk_LL or m_Psi_ijk_P.
+     * @param molality  Cropped molalities of the species
+     * @returns the contribution of the Psi and Zeta terms to the sum in the
+     *          osmotic coefficient expression.
+     */
+    double s_updatePitzer_PsiSums(const vector_fp& psi,
+                                  const double* molality) const;
+
     //! Calculate the cropped molalities
     /*!
      * This is an internal routine that calculates values of m_molalitiesCropped
@@ -33,6 +33,21 @@ public:
     //! Empty Base Constructor
     PureFluidPhase();
 
+    //! Constructor selecting the tabulated fast mode of the underlying
+    //! substance.
+    /*!
+     * The tables are built the first time the state is set. The computed
+     * states are the same as without tabulation, but are found faster.
+     * Tabulation can also be selected with the `tabulated="true"` attribute
+     * of the `thermo` node in the input file.
+     *
+     * @param tabulated  true to use the tabulated fast mode
+     * @param cacheFile  If not empty, the tables are read from this file if
+     *     possible, and saved to it otherwise. See
+     *     tpx::Substance::setTabulated().
+     */
+    explicit PureFluidPhase(bool tabulated, const std::string& cacheFile="");
+
     PureFluidPhase(const PureFluidPhase& right);
     PureFluidPhase& operator=(const PureFluidPhase& right);
     ThermoPhase* duplMyselfAsThermoPhase() const;
@@ -188,6 +203,12 @@ private:
 
     //! flag to turn on some printing.
     bool m_verbose;
+
+    //! Use the tabulated fast mode of the tpx substance
+    bool m_tabulated;
+
+    //! File used to cache the tables of the tpx substance
+    std::string m_tableFile;
 };
 
 }
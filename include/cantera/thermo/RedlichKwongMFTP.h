@@ -86,6 +86,32 @@ public:
 
     // @}
 
+    //! Compute properties for a sequence of states
+    /*!
+     * Each state is set with setState_TPX(), and the mass density and
+     * (optionally) the specific enthalpy and heat capacity are evaluated.
+     * Consecutive states with the same composition reuse the mixture a and b
+     * parameters, and the volume root for each state is found starting from
+     * the root for the previous state, so that sweeps over tables of states
+     * are considerably faster than setting each state from scratch. On
+     * return, the phase is left in the last state.
+     *
+     * @param nStates  Number of states
+     * @param T        Temperatures [K]. Length nStates.
+     * @param P        Pressures [Pa]. Length nStates.
+     * @param X        Mole fractions, stored contiguously for each state.
+     *     Length nStates * nSpecies(). If NULL, the current composition is
+     *     used for all states.
+     * @param rho      Output mass densities [kg/m^3]. Length nStates.
+     * @param h        Output specific enthalpies [J/kg], or NULL.
+     * @param cp       Output specific heat capacities at constant pressure
+     *     [J/kg/K], or NULL.
+     */
+    void getStateProperties(size_t nStates, const doublereal* T,
+                            const doublereal* P, const doublereal* X,
+                            doublereal* rho, doublereal* h=0,
+                            doublereal* cp=0);
+
 protected:
     /**
      * Calculate the density of the mixture using the partial molar volumes and
@@ -248,6 +274,10 @@ public:
      */
     void updateAB();
 
+    //! Update the temperature-dependent a_ij coefficients, #a_vec_Curr_, if
+    //! the temperature has changed since they were last computed.
+    void updateAij() const;
+
     //! Calculate the a and the b parameters given the temperature
     /*!
      * This function doesn't change the internal state of the object, so it is a
@@ -275,9 +305,13 @@ public:
      * Returns the number of solutions found. If it only finds the liquid
      * branch solution, it will return a -1 or a -2 instead of 1 or 2.  If it
      * returns 0, then there is an error.
+     *
+     * If *Vguess* is positive and the cubic has a single real root, the root
+     * is found by Newton iteration starting from *Vguess*, falling back to the
+     * closed-form solution if the iteration does not converge.
      */
     int NicholsSolve(double TKelvin, double pres, doublereal a, doublereal b,
-                     doublereal Vroot[3]) const;
+                     doublereal Vroot[3], doublereal Vguess=0.0) const;
 
 protected:
     //! boolean indicating whether standard mixing rules are applied
@@ -306,9 +340,23 @@ protected:
      */
     doublereal m_a_current;
 
-    vector_fp a_vec_Curr_;
+    //! Temperature-dependent a_ij coefficients. Updated by updateAij().
+    mutable vector_fp a_vec_Curr_;
     vector_fp b_vec_Curr_;
 
+    //! Temperature at which #a_vec_Curr_ was last evaluated
+    mutable doublereal m_aijTemp;
+
+    //! Mole fraction weighted sum of the constant parts of the a_ij
+    doublereal m_a0_current;
+
+    //! Mole fraction weighted sum of the temperature coefficients of the a_ij
+    doublereal m_aT_current;
+
+    //! Value of stateMFNumber() for which #m_b_current, #m_a0_current and
+    //! #m_aT_current were computed
+    int m_abStateNum;
+
     Array2D a_coeff_vec;
 
     vector_fp m_pc_Species;
@@ -13,6 +13,7 @@
 #define WATERPROPSIAPWS_H
 
 #include "WaterPropsIAPWSphi.h"
+#include "cantera/base/ct_defs.h"
 
 namespace Cantera
 {
@@ -237,6 +238,42 @@ public:
     doublereal density(doublereal temperature, doublereal pressure,
                        int phase = -1, doublereal rhoguess = -1.0);
 
+    //! Turn on or off the tabulated initial guess for density()
+    /*!
+     * When turned on, a bicubic spline surface of the density as a function
+     * of the temperature and the log of the pressure is built on the first
+     * call to density(). Each node of the table is tagged with the phase
+     * (gas, liquid or supercritical) of the stable root at that node. In
+     * density(), if the cell containing (T, P) has all four corners in the
+     * requested phase, the spline value is used as the initial guess of the
+     * Newton iteration, which then typically converges in one or two steps.
+     * If a density guess is passed to density(), it determines the requested
+     * phase: liquid above the critical density and gas below it. Cells which
+     * straddle the saturation curve or the critical temperature, and states
+     * outside of the table, fall back to the caller's guess or the normal
+     * initial guesses.
+     *
+     * The converged density is still the exact IAPWS-95 value; the table only
+     * changes the starting point of the iteration.
+     *
+     * @param on    Turn the table on (true) or off (false)
+     * @param Tmin  Minimum temperature of the table (kelvin)
+     * @param Tmax  Maximum temperature of the table (kelvin)
+     * @param Pmin  Minimum pressure of the table (Pascal)
+     * @param Pmax  Maximum pressure of the table (Pascal)
+     * @param nT    Number of temperature nodes
+     * @param nP    Number of pressure nodes
+     */
+    void setDensityTable(bool on, doublereal Tmin = 273.16,
+                         doublereal Tmax = 1273.15, doublereal Pmin = 611.0,
+                         doublereal Pmax = 1.0E8, size_t nT = 150,
+                         size_t nP = 100);
+
+    //! Returns true if the tabulated initial guess for density() is in use
+    bool densityTableEnabled() const {
+        return m_useDensityTable;
+    }
+
     //! Calculates the density given the temperature and the pressure,
     //! and a guess at the density, while not changing the internal state
     /*!
@@ -425,6 +462,20 @@ private:
     void corr1(doublereal temperature, doublereal pressure, doublereal& densLiq,
                doublereal& densGas, doublereal& pcorr);
 
+    //! Build the density table used by densityTableGuess()
+    void buildDensityTable();
+
+    //! Initial guess for the density from the tabulated spline surface
+    /*!
+     * @param temperature  temperature (kelvin)
+     * @param pressure     pressure (Pascal)
+     * @param phase        requested phase of water; -1: no requested phase
+     * @returns the interpolated density (kg m-3), or -1.0 if the table can't
+     *     supply a guess for this state and phase.
+     */
+    doublereal densityTableGuess(doublereal temperature, doublereal pressure,
+                                 int phase) const;
+
     //! pointer to the underlying object that does the calculations.
     mutable WaterPropsIAPWSphi m_phi;
 
@@ -436,6 +487,30 @@ private:
 
     //! Current state of the system
     mutable int iState;
+
+    //! Use the tabulated initial guess in density()
+    bool m_useDensityTable;
+
+    //! Temperature range of the density table (kelvin)
+    doublereal m_tabTmin, m_tabTmax;
+
+    //! Range of the log of the pressure (Pascal) in the density table
+    doublereal m_tabLnPmin, m_tabLnPmax;
+
+    //! Number of temperature and pressure nodes in the density table
+    size_t m_tabNT, m_tabNP;
+
+    //! Tabulated densities (kg m-3) at the nodes. The node for temperature
+    //! index i and pressure index j is at m_tabRho[i*m_tabNP + j]. Empty
+    //! until the table has been built.
+    vector_fp m_tabRho;
+
+    //! Derivatives of the tabulated densities wrt the scaled temperature and
+    //! log pressure coordinates, and the cross derivative, at the nodes
+    vector_fp m_tabRho_T, m_tabRho_P, m_tabRho_TP;
+
+    //! Phase of the stable root at each node; -1 if the solve failed
+    vector_int m_tabPhase;
 };
 
 }
@@ -111,10 +111,15 @@ public:
      * @param p_red       Value of the dimensionless pressure
      * @param tau         Dimensionless temperature = T_c/T
      * @param deltaGuess  Initial guess for the dimensionless density
+     * @param damped      If false, the Newton updates are neither damped nor
+     *     cropped, and the iteration gives up after a few steps. This is
+     *     meant for guesses which are already close to the solution.
      *
-     * @returns the dimensionless density.
+     * @returns the dimensionless density, or 0.0 if the iteration didn't
+     *     converge.
      */
-    doublereal dfind(doublereal p_red, doublereal tau, doublereal deltaGuess);
+    doublereal dfind(doublereal p_red, doublereal tau, doublereal deltaGuess,
+                     bool damped = true);
 
     //! Calculate the dimensionless Gibbs free energy
     doublereal gibbs_RT() const;
@@ -4,6 +4,7 @@
 
 #include "cantera/base/ctexceptions.h"
 #include <algorithm>
+#include <vector>
 
 namespace tpx
 {
@@ -216,6 +217,27 @@ public:
     //! second property.
     void Set(PropertyPair::type XY, double x0, double y0);
 
+    //! Enable or disable the tabulated fast mode.
+    /*!
+     * When enabled, tables of the saturation properties and of the
+     * single-phase density, enthalpy, entropy and internal energy on a
+     * (T, ln P) grid are built the first time they are needed. The tables
+     * supply the starting points for the iterations in update_sat(), Tsat()
+     * and Set(), which are still converged to the usual tolerances, so the
+     * computed states do not depend on whether tabulation is used.
+     *
+     * @param on         true to use the tables
+     * @param cacheFile  If not empty, the tables are read from this file when
+     *     it exists and was written for the same substance. Otherwise, the
+     *     tables are written to this file after they have been built.
+     */
+    void setTabulated(bool on, const std::string& cacheFile="");
+
+    //! True if the tabulated fast mode is enabled
+    bool tabulated() const {
+        return m_tabulated;
+    }
+
 protected:
     double T, Rho;
     double Tslast, Rhf, Rhv;
@@ -257,6 +279,43 @@ private:
     void set_v(double v0);
     void BracketSlope(double p);
     double vprop(propertyFlag::type ijob);
+
+    //! Build the tables used by the tabulated fast mode, or read them from
+    //! #m_tableFile.
+    void buildTables();
+
+    //! Read the tables from file *fname*. Returns false if the file does not
+    //! exist or was written for a different substance or grid.
+    bool readTables(const std::string& fname);
+
+    //! Write the tables to file *fname*. The tables are written to a temporary
+    //! file first, which then replaces *fname*.
+    void writeTables(const std::string& fname);
+
+    //! Interpolated saturation pressure and densities at temperature *t*.
+    //! Returns false if *t* is outside the saturation table.
+    bool satGuess(double t, double& pp, double& rhf, double& rhv) const;
+
+    //! Interpolated saturation temperature at pressure *p*. Returns false if
+    //! *p* is outside the saturation table.
+    bool TsatGuess(double p, double& t) const;
+
+    //! Set T and Rho to the interpolated single-phase state at (*t*, *p*).
+    //! *phase* is 0 for liquid, 1 for vapor, and 2 for supercritical states.
+    //! Returns false (leaving the state unchanged) if no table cell entirely
+    //! within that phase contains the point.
+    bool seedTP(double t, double p, int phase);
+
+    //! Set T and Rho to the interpolated single-phase state where property
+    //! *ifunc* has the value *val* along the isotherm (*itp* = Tgiven) or
+    //! isobar (*itp* = Pgiven) *sat*. Returns false (leaving the state
+    //! unchanged) if the value is not bracketed by the table.
+    bool seedState(int itp, double sat, propertyFlag::type ifunc, double val);
+
+    //! Tabulated value of property *ifunc* at node (*i*, *j*), without the
+    //! energy and entropy offsets.
+    double tableValue(propertyFlag::type ifunc, size_t i, size_t j) const;
+
     void set_xy(propertyFlag::type if1, propertyFlag::type if2,
                 double X, double Y,
                 double atx, double aty, double rtx, double rty);
@@ -266,6 +325,27 @@ private:
     double Pmin, Pmax;
     double dvbf, dv;
     double v_here, P_here;
+
+    //! @name Tabulated fast mode
+    //! @{
+    bool m_tabulated; //!< Use the tables
+    bool m_tableBuilt; //!< The tables have been built or read
+    std::string m_tableFile; //!< File used to cache the tables
+
+    //! Saturation table on a uniform temperature grid starting at #m_satT0
+    double m_satT0, m_satDT;
+    std::vector<double> m_satLnP, m_satRhf, m_satRhv;
+
+    //! Single-phase table on a uniform (T, ln P) grid. Values for node (i,j)
+    //! are stored at index `i*m_tabNP + j`.
+    size_t m_tabNT, m_tabNP;
+    double m_tabT0, m_tabDT, m_tabLnP0, m_tabDLnP;
+    std::vector<double> m_tabLnRho, m_tabH, m_tabS, m_tabU;
+
+    //! Phase at each node: 0 = liquid, 1 = vapor, 2 = supercritical,
+    //! -1 = not converged
+    std::vector<int> m_tabPhase;
+    //! @}
 };
 
 }
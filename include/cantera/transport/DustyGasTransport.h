@@ -12,7 +12,7 @@
 
 // Cantera includes
 #include "TransportBase.h"
-#include "cantera/numerics/DenseMatrix.h"
+#include "cantera/numerics/SquareMatrix.h"
 
 namespace Cantera
 {
@@ -112,6 +112,31 @@ public:
 
     // new methods added in this class
 
+    //! Get the molar fluxes [kmol/m^2/s] between each pair of adjacent points
+    //! of a one-dimensional mesh.
+    /*!
+     * This is equivalent to calling getMolarFluxes() for each pair of
+     * adjacent points. Since the effective binary diffusion coefficients are
+     * only recomputed when the temperature changes, processing a whole mesh
+     * in one call is particularly efficient if the mesh is isothermal.
+     *
+     * @param npts    Number of points
+     * @param states  Array of temperature, density, and mass fractions for
+     *     each point, with the values for point *j* starting at index
+     *     `j*(nSpecies()+2)`. Length `npts*(nSpecies()+2)`.
+     * @param delta   Distances between adjacent points (m). Length `npts-1`.
+     * @param fluxes  Species molar fluxes between adjacent points, with the
+     *     fluxes between points *j* and *j+1* starting at index
+     *     `j*nSpecies()`. Length `(npts-1)*nSpecies()`.
+     */
+    void getMolarFluxes(size_t npts, const double* const states,
+                        const double* const delta, double* const fluxes);
+
+    //! Number of times the H matrix has been factored
+    size_t nHMatrixFactorizations() const {
+        return m_nfactor;
+    }
+
     //! Set the porosity (dimensionless)
     /*!
      * @param porosity  Set the value of the porosity
@@ -190,9 +215,9 @@ private:
 
     //! Update concentration-dependent quantities within the object
     /*!
-     * The object keeps a value m_temp, which is the temperature at which
-     * quantities were last evaluated at. If the temperature is changed, update
-     * Booleans are set false, triggering recomputation.
+     * The mole fractions and the pressure are compared to the values at
+     * which the H matrix was last evaluated. If either has changed, the
+     * factorization of the H matrix is marked as out of date.
      */
     void updateTransport_C();
 
@@ -207,17 +232,28 @@ private:
      * \f]
      *
      * where \f$ \phi \f$ is the porosity of the media and \f$ \tau \f$ is the
-     * tortuosity of the media.
+     * tortuosity of the media. The reciprocals of these coefficients are
+     * stored at unit pressure, so that they only need to be recomputed when
+     * the temperature or the pore structure changes.
      */
     void updateBinaryDiffCoeffs();
 
     //! Update the Multicomponent diffusion coefficients that are used in the
     //! approximation
     /*!
-     * This routine updates the H matrix and then inverts it.
+     * This routine updates the factorization of the H matrix if necessary
+     * and then computes its inverse.
      */
     void updateMultiDiffCoeffs();
 
+    //! Update the LU factorization of the H matrix
+    /*!
+     * The H matrix is only evaluated and factored if the temperature, the
+     * pressure, the mole fractions, or the properties of the porous medium
+     * have changed since the last factorization.
+     */
+    void updateHMatrixFactor();
+
     //! Update the Knudsen diffusion coefficients
     /*!
      * The Knudsen diffusion coefficients are given by the following form
@@ -225,6 +261,9 @@ private:
      * \f[
      *     \mathcal{D}^{knud}_k =  \frac{2}{3} \frac{r_{pore} \phi}{\tau} \left( \frac{8 R T}{\pi W_k}  \right)^{1/2}
      * \f]
+     *
+     * The factors which do not depend on the temperature are only recomputed
+     * when the pore structure changes.
      */
     void updateKnudsenDiffCoeffs();
 
@@ -248,8 +287,9 @@ private:
      */
     vector_fp m_mw;
 
-    //! binary diffusion coefficients
-    DenseMatrix m_d;
+    //! Reciprocals of the dusty gas binary diffusion coefficients at unit
+    //! pressure. @see updateBinaryDiffCoeffs()
+    DenseMatrix m_dinv;
 
     //! mole fractions
     vector_fp m_x;
@@ -257,18 +297,31 @@ private:
     //! Knudsen diffusion coefficients. @see updateKnudsenDiffCoeffs()
     vector_fp m_dk;
 
+    //! Knudsen diffusion coefficients divided by the square root of the
+    //! temperature
+    vector_fp m_dk0;
+
     //! temperature
     doublereal m_temp;
 
+    //! pressure at which the H matrix was last evaluated
+    doublereal m_pres;
+
     //! Multicomponent diffusion coefficients. @see eval_H_matrix()
     DenseMatrix m_multidiff;
 
+    //! The H matrix, or its LU factorization. @see eval_H_matrix()
+    SquareMatrix m_hmat;
+
     //! work space of size m_nsp;
     vector_fp m_spwork;
 
     //! work space of size m_nsp;
     vector_fp m_spwork2;
 
+    //! work space of size m_nsp;
+    vector_fp m_spwork3;
+
     //! Pressure Gradient
     doublereal m_gradP;
 
@@ -278,6 +331,15 @@ private:
     //! Update-to-date variable for Binary diffusion coefficients
     bool m_bulk_ok;
 
+    //! Update-to-date variable for the factorization of the H matrix
+    bool m_hfactor_ok;
+
+    //! Update-to-date variable for the multicomponent diffusion coefficients
+    bool m_multidiff_ok;
+
+    //! Number of factorizations of the H matrix
+    size_t m_nfactor;
+
     //! Porosity
     doublereal m_porosity;
 
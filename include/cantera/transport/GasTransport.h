@@ -7,6 +7,7 @@
 
 #include "TransportBase.h"
 #include "cantera/numerics/DenseMatrix.h"
+#include <cstdint>
 
 namespace Cantera
 {
@@ -47,7 +48,9 @@ public:
     //! Get the pure-species viscosities
     virtual void getSpeciesViscosities(doublereal* const visc) {
         update_T();
-        updateViscosity_T();
+        if (!m_spvisc_ok) {
+            updateSpeciesViscosities();
+        }
         std::copy(m_visc.begin(), m_visc.end(), visc);
     }
 
@@ -109,6 +112,25 @@ public:
 
     virtual void init(thermo_t* thermo, int mode=0, int log_level=0);
 
+    //! Set the directory used to cache the polynomial fits
+    /*!
+     * Generating the fits to the collision integrals and to the species
+     * viscosities, conductivities and binary diffusion coefficients is the
+     * most expensive part of init() for large mechanisms. If a cache
+     * directory is set, the fits are written to a binary file in that
+     * directory, and are read from the file instead of being regenerated
+     * when a transport manager is initialized with the same inputs. The file
+     * name contains a hash of all the inputs to the fits: the fitting mode,
+     * the temperature limits of the phase, and the names, molecular weights,
+     * transport parameters and reference-state heat capacities of the
+     * species. An empty string (the default) disables the cache.
+     *
+     * Must be called before init().
+     */
+    void setFitCacheDirectory(const std::string& dir) {
+        m_fitCacheDir = dir;
+    }
+
 protected:
     GasTransport(ThermoPhase* thermo=0);
 
@@ -141,6 +163,10 @@ protected:
      */
     virtual void updateDiff_T();
 
+    //! Copy the binary diffusion coefficients from #m_bdiffPacked into the
+    //! matrices #m_bdiff and #m_bdiffInv, and mark them as up to date.
+    void unpackBinaryDiffCoeffs();
+
     //! @name Initialization
     //! @{
 
@@ -204,6 +230,29 @@ protected:
      */
     void fitProperties(MMCollisionInt& integrals);
 
+    //! Pack the binary diffusion coefficient fits by power of log(T) into
+    //! #m_diffcoeffsPacked, for use in updateDiff_T().
+    void packDiffCoeffs();
+
+    //! Hash of the inputs to the polynomial fits, used to identify cached fits
+    uint64_t fitCacheKey();
+
+    //! Read the polynomial fits from a cache file
+    /*!
+     * @param fname name of the cache file
+     * @param key   expected value of fitCacheKey()
+     * @returns true if the file exists and contains fits for *key*
+     */
+    bool readFitCache(const std::string& fname, uint64_t key);
+
+    //! Write the polynomial fits to a cache file
+    /*!
+     * The file is written under a temporary name and then renamed, so that
+     * processes sharing the cache directory never read a partial file.
+     * Failure to write the file is not an error.
+     */
+    void writeFitCache(const std::string& fname, uint64_t key);
+
     //! Second-order correction to the binary diffusion coefficients
     /*!
      * Calculate second-order corrections to binary diffusion coefficient pair
@@ -282,9 +331,12 @@ protected:
      */
     DenseMatrix m_wratjk;
 
-    //! Holds square roots of molecular weight ratios
+    //! Holds the molecular weight factors in the Wilke mixing rule
     /*!
-     *  `m_wratjk1(j,k)  = sqrt(1.0 + mw[k]/mw[j])        j < k`
+     *  @code
+     *  m_wratkj1(j,k)  = 1 / sqrt(8 (1.0 + mw[k]/mw[j]))   j <= k
+     *  m_wratkj1(k,j)  = mw[k]/mw[j]                       j < k
+     *  @endcode
      */
     DenseMatrix m_wratkj1;
 
@@ -334,10 +386,34 @@ protected:
      */
     std::vector<vector_fp> m_diffcoeffs;
 
+    //! Coefficients of #m_diffcoeffs, packed by power of log(T).
+    /*!
+     * m_diffcoeffsPacked(ic,n) is the coefficient of log(T)^n for species
+     * pair ic, so that each column is contiguous and the fits can be
+     * evaluated for all pairs in a single vectorizable loop.
+     */
+    Array2D m_diffcoeffsPacked;
+
+    //! Binary diffusion coefficients at the reference pressure and the current
+    //! temperature for each species pair, in the same order as #m_diffcoeffs.
+    vector_fp m_bdiffPacked;
+
     //! Matrix of binary diffusion coefficients at the reference pressure and
     //! the current temperature Size is nsp x nsp.
     DenseMatrix m_bdiff;
 
+    //! Reciprocals of the off-diagonal elements of #m_bdiff. The diagonal
+    //! elements are zero, so the sums over the other species needed for the
+    //! mixture-averaged diffusion coefficients are matrix-vector products.
+    DenseMatrix m_bdiffInv;
+
+    //! Work vector holding the products of the mole fractions and molecular
+    //! weights. Length #m_nsp.
+    vector_fp m_xmw;
+
+    //! Work vector of length #m_nsp
+    vector_fp m_dwork;
+
     //! temperature fits of the heat conduction
     /*!
      *  Dimensions are number of species (nsp) polynomial order of the collision
@@ -480,6 +556,9 @@ protected:
 
     //! Level of verbose printing during initialization
     int m_log_level;
+
+    //! Directory for cached polynomial fits. See setFitCacheDirectory().
+    std::string m_fitCacheDir;
 };
 
 } // namespace Cantera
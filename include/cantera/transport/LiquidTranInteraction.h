@@ -127,7 +127,7 @@ public:
         throw NotImplementedError("LiquidTranInteraction::getMixTransProp");
     }
 
-    virtual doublereal getMixTransProp(std::vector<LTPspecies*> LTPptrs) {
+    virtual doublereal getMixTransProp(const std::vector<LTPspecies*>& LTPptrs) {
         throw NotImplementedError("LiquidTranInteraction::getMixTransProp");
     }
 
@@ -136,6 +136,28 @@ public:
     }
 
 protected:
+    //! Evaluate the interaction term of the mixing rule
+    /*!
+     * Returns
+     * \f[
+     *     \sum_i \sum_j x_i x_j \sum_k C^{(k)}_{i,j} x_i^k
+     * \f]
+     * where the coefficients \f$ C^{(k)}_{i,j} \f$ are evaluated by
+     * updateInteractions_T() at the current temperature.
+     *
+     * @param x  weighted mole or mass fractions. Length nSpecies.
+     */
+    doublereal interactionSum(const doublereal* x);
+
+    //! Evaluate the interaction coefficients used by interactionSum() at the
+    //! temperature *T*
+    /*!
+     * This is only called when the temperature changes. The default
+     * implementation combines #m_Aij and #m_Bij as \f$ C^{(k)}_{i,j} =
+     * A^{(k)}_{i,j} + T B^{(k)}_{i,j} \f$.
+     */
+    virtual void updateInteractions_T(doublereal T);
+
     //! Model for species interaction effects. Takes enum LiquidTranMixingModel
     LiquidTranMixingModel m_model;
 
@@ -166,6 +188,18 @@ protected:
 
     //! Matrix of interactions
     DenseMatrix m_Dij;
+
+    //! Interaction coefficients at the temperature #m_Ctemp, evaluated by
+    //! updateInteractions_T(). These are stored transposed, that is, entry
+    //! (j,i) of `m_Cij[k]` holds \f$ C^{(k)}_{i,j} \f$.
+    std::vector<DenseMatrix> m_Cij;
+
+    //! Temperature at which #m_Cij was evaluated
+    doublereal m_Ctemp;
+
+    //! Work array of length nSpecies, used for the weighted mole or mass
+    //! fractions
+    vector_fp m_work;
 };
 
 class LTI_Solvent : public LiquidTranInteraction
@@ -179,7 +213,7 @@ public:
      * does not know what transport property it is at this point).
      */
     doublereal getMixTransProp(doublereal* valueSpecies, doublereal* weightSpecies = 0);
-    doublereal getMixTransProp(std::vector<LTPspecies*> LTPptrs);
+    doublereal getMixTransProp(const std::vector<LTPspecies*>& LTPptrs);
 
     //! Return the matrix of binary interaction parameters.
     /**
@@ -212,7 +246,7 @@ public:
      * does not know what transport property it is at this point.
      */
     doublereal getMixTransProp(doublereal* valueSpecies, doublereal* weightSpecies = 0);
-    doublereal getMixTransProp(std::vector<LTPspecies*> LTPptrs);
+    doublereal getMixTransProp(const std::vector<LTPspecies*>& LTPptrs);
 
     //! Return the matrix of binary interaction parameters.
     /**
@@ -248,7 +282,7 @@ public:
      * does not know what transport property it is at this point.
      */
     doublereal getMixTransProp(doublereal* valueSpecies, doublereal* weightSpecies = 0);
-    doublereal getMixTransProp(std::vector<LTPspecies*> LTPptrs);
+    doublereal getMixTransProp(const std::vector<LTPspecies*>& LTPptrs);
 
     //! Return the matrix of binary interaction parameters.
     /**
@@ -313,7 +347,7 @@ public:
      * does not know what transport property it is at this point.
      */
     doublereal getMixTransProp(doublereal* valueSpecies, doublereal* weightSpecies = 0);
-    doublereal getMixTransProp(std::vector<LTPspecies*> LTPptrs);
+    doublereal getMixTransProp(const std::vector<LTPspecies*>& LTPptrs);
 
     //! Return the matrix of binary interaction parameters.
     /**
@@ -323,6 +357,9 @@ public:
     void getMatrixTransProp(DenseMatrix& mat, doublereal* speciesValues = 0) {
         mat = m_Eij;
     }
+
+protected:
+    virtual void updateInteractions_T(doublereal T);
 };
 
 //! Transport properties that act like pairwise interactions
@@ -362,7 +399,7 @@ public:
      * does not know what transport property it is at this point.
      */
     doublereal getMixTransProp(doublereal* valueSpecies, doublereal* weightSpecies = 0);
-    doublereal getMixTransProp(std::vector<LTPspecies*> LTPptrs);
+    doublereal getMixTransProp(const std::vector<LTPspecies*>& LTPptrs);
 
     //! Return the matrix of binary interaction parameters.
     /**
@@ -460,7 +497,7 @@ public:
      * does not know what transport property it is at this point.
      */
     doublereal getMixTransProp(doublereal* valueSpecies, doublereal* weightSpecies = 0);
-    doublereal getMixTransProp(std::vector<LTPspecies*> LTPptrs);
+    doublereal getMixTransProp(const std::vector<LTPspecies*>& LTPptrs);
 
     //! Return the matrix of binary interaction parameters.
     /**
@@ -501,7 +538,7 @@ public:
      * transport property it is at this point.
      */
     doublereal getMixTransProp(doublereal* valueSpecies, doublereal* weightSpecies = 0);
-    doublereal getMixTransProp(std::vector<LTPspecies*> LTPptrs);
+    doublereal getMixTransProp(const std::vector<LTPspecies*>& LTPptrs);
 
     //! Return the matrix of binary interaction parameters.
     /**
@@ -537,7 +574,7 @@ public:
      * does not know what transport property it is at this point.
      */
     doublereal getMixTransProp(doublereal* valueSpecies, doublereal* weightSpecies = 0);
-    doublereal getMixTransProp(std::vector<LTPspecies*> LTPptrs);
+    doublereal getMixTransProp(const std::vector<LTPspecies*>& LTPptrs);
 
     //! Return the matrix of binary interaction parameters.
     /**
@@ -547,6 +584,9 @@ public:
     void getMatrixTransProp(DenseMatrix& mat, doublereal* speciesValues = 0) {
         mat = (*m_Aij[0]);
     }
+
+protected:
+    virtual void updateInteractions_T(doublereal T);
 };
 
 }
@@ -6,7 +6,7 @@
 #define CT_LIQUIDTRAN_H
 
 #include "TransportBase.h"
-#include "cantera/numerics/DenseMatrix.h"
+#include "cantera/numerics/SquareMatrix.h"
 #include "LiquidTransportParams.h"
 
 namespace Cantera
@@ -1124,8 +1124,15 @@ private:
     //! RHS to the Stefan-Maxwell equation
     DenseMatrix m_B;
 
-    //! Matrix for the Stefan-Maxwell equation.
-    DenseMatrix m_A;
+    //! Matrix for the Stefan-Maxwell equation, or its LU factorization if
+    //! #m_diff_mix_ok is true. The matrix depends only on the temperature, the
+    //! composition and the velocity basis, so the factorization is reused
+    //! by all flux, diffusion coefficient and mobility evaluations at the
+    //! same state.
+    SquareMatrix m_A;
+
+    //! Velocity basis used to form #m_A
+    int m_velocityBasisA;
 
     //! Current Temperature -> locally stored. This is used to test whether new
     //! temperature computations should be performed.
@@ -1219,7 +1226,8 @@ private:
     //! the concentration
     bool m_radi_conc_ok;
 
-    //! Boolean indicating that mixture diffusion coeffs are current
+    //! Boolean indicating that the factorization of the Stefan-Maxwell matrix
+    //! #m_A is current
     bool m_diff_mix_ok;
 
     //! Boolean indicating that binary diffusion coeffs are current
@@ -0,0 +1,140 @@
+/**
+ *  @file MixTabulatedTransport.h
+ *    Headers for the MixTabulatedTransport object, which evaluates
+ *    mixture-averaged transport properties from tabulated species properties
+ *    (see \ref tranprops and \link Cantera::MixTabulatedTransport
+ *    MixTabulatedTransport \endlink).
+ */
+
+#ifndef CT_MIXTABTRAN_H
+#define CT_MIXTABTRAN_H
+
+#include "MixTransport.h"
+
+namespace Cantera
+{
+//! Mixture-averaged transport properties computed from tabulated species
+//! properties
+/*!
+ * The pure species viscosities and thermal conductivities and the binary
+ * diffusion coefficients at unit pressure depend only on the temperature. In
+ * init(), these are evaluated from the polynomial fits at evenly spaced
+ * temperatures and stored in a table, and they are subsequently found by
+ * linear interpolation in this table, without evaluating any logarithms,
+ * exponentials or polynomials. The mixture rules are the same as in
+ * MixTransport.
+ *
+ * To reduce the interpolation error, the tabulated quantities are the ones
+ * fitted by the polynomials: \f$ \sqrt{\mu_k} / T^{1/4} \f$, \f$ \lambda_k /
+ * T^{1/2} \f$ and \f$ \mathcal{D}_{kj} / T^{3/2} \f$, which vary only slowly
+ * with temperature. With the default spacing of 5 K, the relative error of
+ * the interpolated properties is of the order of 1e-5. Outside the tabulated
+ * temperature range, the properties are evaluated from the polynomial fits.
+ *
+ * The table holds \f$ K(K+5)/2 \f$ values for each temperature, where \f$ K
+ * \f$ is the number of species, so for large mechanisms the range or spacing
+ * of the table may need to be adjusted with setTableRange().
+ *
+ * @ingroup tranprops
+ */
+class MixTabulatedTransport : public MixTransport
+{
+public:
+    MixTabulatedTransport();
+    MixTabulatedTransport(const MixTabulatedTransport& right);
+    MixTabulatedTransport& operator=(const MixTabulatedTransport& right);
+    virtual Transport* duplMyselfAsTransport() const;
+
+    //! Return the model id for transport
+    /*!
+     * @return cMixtureTabulated
+     */
+    virtual int model() const {
+        return cMixtureTabulated;
+    }
+
+    virtual void init(thermo_t* thermo, int mode=0, int log_level=0);
+
+    //! Set the temperature range and spacing of the table, and rebuild the
+    //! table if the object has already been initialized.
+    /*!
+     * By default, the table spans the temperature range of the phase with a
+     * spacing of 5 K.
+     *
+     * @param Tmin  lowest tabulated temperature [K]
+     * @param Tmax  highest tabulated temperature [K]. If necessary, this is
+     *              increased so that the range is a multiple of *dT*.
+     * @param dT    spacing of the tabulated temperatures [K]
+     */
+    void setTableRange(double Tmin, double Tmax, double dT);
+
+    //! Lowest tabulated temperature [K]
+    double tableMinTemp() const {
+        return m_tabTmin;
+    }
+
+    //! Highest tabulated temperature [K]
+    double tableMaxTemp() const {
+        return m_tabTmax;
+    }
+
+    //! Spacing of the tabulated temperatures [K]
+    double tableSpacing() const {
+        return m_tabDT;
+    }
+
+protected:
+    virtual void getSpeciesBlock(size_t m, const double* T, double* sqvisc,
+                                 double* cond, double* bdiff);
+    virtual void updateSpeciesViscosities();
+    virtual void updateCond_T();
+    virtual void updateDiff_T();
+
+    //! Evaluate the table from the polynomial fits
+    void buildTable();
+
+    //! Find the table interval containing the temperature *T*
+    /*!
+     * @param T  temperature [K]
+     * @param i  index of the table row at the lower end of the interval
+     * @param f  fractional position of *T* within the interval
+     * @returns false if *T* is outside the tabulated range
+     */
+    bool findInterval(double T, size_t& i, double& f) const {
+        double x = (T - m_tabTmin) / m_tabDT;
+        if (!(x >= 0.0 && x <= m_ntab - 1.0)) {
+            return false;
+        }
+        i = std::min(static_cast<size_t>(x), m_ntab - 2);
+        f = x - i;
+        return true;
+    }
+
+    //! Lowest tabulated temperature
+    double m_tabTmin;
+
+    //! Highest tabulated temperature
+    double m_tabTmax;
+
+    //! Spacing of the tabulated temperatures
+    double m_tabDT;
+
+    //! True if the table spans the temperature range of the phase, false if
+    //! the range has been set with setTableRange()
+    bool m_phaseRange;
+
+    //! Number of tabulated temperatures
+    size_t m_ntab;
+
+    //! Number of values stored for each temperature
+    size_t m_rowSize;
+
+    //! The table of species properties. Row *i*, starting at index
+    //! `i*m_rowSize`, holds the values at temperature `m_tabTmin + i*m_tabDT`:
+    //! \f$ \sqrt{\mu_k} / T^{1/4} \f$ for each species, then \f$ \lambda_k /
+    //! T^{1/2} \f$ for each species, then \f$ \mathcal{D}_{kj} / T^{3/2} \f$
+    //! for each species pair, ordered as in #m_bdiffPacked.
+    vector_fp m_table;
+};
+}
+#endif
@@ -99,6 +99,22 @@ public:
      */
     virtual doublereal thermalConductivity();
 
+    //! Compute the mixture transport properties for a set of states
+    /*!
+     * The states are processed in blocks. Within each block, the species
+     * and species-pair loops are evaluated for all states of the block at
+     * once, so that the polynomial fit coefficients are loaded once per block
+     * and the innermost loops, over the states, can be vectorized. The
+     * internal state of this object and the state of the ThermoPhase object
+     * are not used or modified.
+     *
+     * @see Transport::getMixTransportProperties()
+     */
+    virtual void getMixTransportProperties(size_t n, const double* T,
+                                           const double* P, const double* X,
+                                           double* visc, double* cond,
+                                           double* d);
+
     //! Get the Electrical mobilities (m^2/V/s).
     /*!
      * This function returns the mobilities. In some formulations this is equal
@@ -158,12 +174,25 @@ public:
 
     virtual void init(thermo_t* thermo, int mode=0, int log_level=0);
 
-private:
-    //! Calculate the pressure from the ideal gas law
-    doublereal pressure_ig() const {
-        return (m_thermo->molarDensity() * GasConstant *
-                m_thermo->temperature());
-    }
+protected:
+    //! Number of states processed together by getMixTransportProperties()
+    static const size_t BlockSize = 16;
+
+    //! Evaluate the species properties for a block of states
+    /*!
+     * Values for species (or species pair) `k` and state `s` are stored at
+     * index `k*BlockSize + s` of the output arrays. The binary diffusion
+     * coefficients are evaluated at unit pressure, and the species pairs
+     * are ordered as in #m_bdiffPacked.
+     *
+     * @param m       number of states, at most BlockSize
+     * @param T       temperatures of the states
+     * @param sqvisc  square roots of the species viscosities
+     * @param cond    species thermal conductivities
+     * @param bdiff   binary diffusion coefficients at unit pressure
+     */
+    virtual void getSpeciesBlock(size_t m, const double* T, double* sqvisc,
+                                 double* cond, double* bdiff);
 
     //! Update the temperature dependent parts of the species thermal
     //! conductivities
@@ -171,7 +200,7 @@ private:
      * These are evaluated from the polynomial fits of the temperature and are
      * assumed to be independent of pressure
      */
-    void updateCond_T();
+    virtual void updateCond_T();
 
     //! vector of species thermal conductivities (W/m /K)
     /*!
@@ -180,18 +209,25 @@ private:
      */
     vector_fp m_cond;
 
-    //! Internal storage for the calculated mixture thermal conductivity
-    /*!
-     *  Units = W /m /K
-     */
-    doublereal m_lambda;
-
     //! Update boolean for the species thermal conductivities
     bool m_spcond_ok;
 
     //! Update boolean for the mixture rule for the mixture thermal conductivity
     bool m_condmix_ok;
 
+private:
+    //! Calculate the pressure from the ideal gas law
+    doublereal pressure_ig() const {
+        return (m_thermo->molarDensity() * GasConstant *
+                m_thermo->temperature());
+    }
+
+    //! Internal storage for the calculated mixture thermal conductivity
+    /*!
+     *  Units = W /m /K
+     */
+    doublereal m_lambda;
+
     //! Debug flag - turns on more printing
     bool m_debug;
 };
@@ -113,6 +113,33 @@ public:
 
     virtual void init(ThermoPhase* thermo, int mode=0, int log_level=0);
 
+    //! Reuse the factorization of the L matrix for nearby states
+    /*!
+     * By default, the L matrix is factored each time the thermal conductivity
+     * or the thermal diffusion coefficients are computed for a new state.
+     * When reuse is enabled, the system for a new state is instead solved by
+     * iterative refinement, starting from the previous solution and using
+     * the most recent factorization as a preconditioner. The matrix is only
+     * refactored if the iteration does not converge, which is efficient when
+     * successive calls are for similar states, e.g. neighboring points on a
+     * grid or successive Newton iterations.
+     *
+     * @param maxiter  Maximum number of refinement iterations. A value of 0
+     *     (the default) disables reuse.
+     * @param rtol     The iteration is converged when the largest residual
+     *     is less than *rtol* times the largest component of the right-hand
+     *     side.
+     */
+    void setLMatrixReuse(size_t maxiter, doublereal rtol=1.0e-10) {
+        m_lmatrix_maxiter = maxiter;
+        m_lmatrix_rtol = rtol;
+    }
+
+    //! Number of times the L matrix has been factored
+    size_t nLMatrixFactorizations() const {
+        return m_nlmatrix_factor;
+    }
+
 protected:
     //! Update basic temperature-dependent quantities if the temperature has
     //! changed.
@@ -151,6 +178,23 @@ protected:
 
     // L matrix quantities
     DenseMatrix m_Lmatrix;
+
+    //! LU factorization of the L matrix with the L01,01 block eliminated.
+    //! See factorLMatrix().
+    SquareMatrix m_Lred;
+
+    //! The L10,01 block at the time of the last factorization
+    DenseMatrix m_Lcoup;
+
+    //! The diagonal of the L01,01 block at the time of the last factorization
+    vector_fp m_Ldiag;
+
+    //! Work array of length 3*m_nsp
+    vector_fp m_Lwork;
+
+    size_t m_lmatrix_maxiter;
+    doublereal m_lmatrix_rtol;
+    size_t m_nlmatrix_factor;
     SquareMatrix m_aa;
     vector_fp m_a;
     vector_fp m_b;
@@ -168,6 +212,9 @@ protected:
     bool m_l0000_ok;
     bool m_lmatrix_soln_ok;
 
+    //! True if m_Lred holds a factorization that can be reused
+    bool m_lfactor_ok;
+
     //! Evaluate the L0000 matrices
     /*!
      *  Evaluate the upper-left block of the L matrix.
@@ -197,6 +244,27 @@ protected:
     }
 
     virtual void solveLMatrixEquation();
+
+    //! Factor the L matrix for the current state
+    /*!
+     * The L01,01 block is diagonal, and the L00,01 and L01,00 blocks are
+     * zero, so the third block of unknowns is eliminated, leaving a system of
+     * size 2*m_nsp which is factored by LU decomposition. This is several
+     * times faster than factoring the full matrix.
+     */
+    void factorLMatrix();
+
+    //! Solve the L matrix equation using the last factorization
+    /*!
+     * @param x On input, the right-hand side. On output, the solution.
+     *     Length 3*m_nsp.
+     */
+    void solveFactoredLMatrix(doublereal* x);
+
+    //! Solve the L matrix equation for the current state by iterative
+    //! refinement of the previous solution, using the last factorization.
+    //! Returns true if the iteration converged.
+    bool refineLMatrixSolution();
     DenseMatrix incl;
     bool m_debug;
 };
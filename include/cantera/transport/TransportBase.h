@@ -38,6 +38,7 @@ const int cMulticomponent = 200;
 const int CK_Multicomponent = 202;
 const int cMixtureAveraged = 210;
 const int CK_MixtureAveraged = 211;
+const int cMixtureTabulated = 212;
 const int cHighP = 270;
 const int cSolidTransport = 300;
 const int cDustyGasTransport = 400;
@@ -645,6 +646,32 @@ public:
         throw NotImplementedError("Transport::getMixDiffCoeffs");
     }
 
+    //! Compute the mixture transport properties for a set of states
+    /*!
+     * Computes the viscosity, thermal conductivity and mixture-averaged
+     * diffusion coefficients (as returned by getMixDiffCoeffs()) for *n*
+     * states, each specified by its temperature, pressure and mole fractions.
+     * This is equivalent to setting each state in the ThermoPhase object and
+     * calling viscosity(), thermalConductivity() and getMixDiffCoeffs(), but
+     * derived classes may override this method to process the states
+     * together. The state of the ThermoPhase object is not changed.
+     *
+     * @param n     Number of states
+     * @param T     Temperatures [K]. Length = n
+     * @param P     Pressures [Pa]. Length = n
+     * @param X     Mole fractions. Flat vector with the species index in the
+     *              inner loop. Length = n * n_sp
+     * @param visc  Output viscosities [Pa-s]. Length = n. If NULL, the
+     *              viscosities are not computed.
+     * @param cond  Output thermal conductivities [W/m/K]. Length = n
+     * @param d     Output mixture-averaged diffusion coefficients [m^2/s].
+     *              Same layout as X.
+     */
+    virtual void getMixTransportProperties(size_t n, const double* T,
+                                           const double* P, const double* X,
+                                           double* visc, double* cond,
+                                           double* d);
+
     //! Returns a vector of mixture averaged diffusion coefficients
     virtual void getMixDiffCoeffsMole(doublereal* const d) {
         throw NotImplementedError("Transport::getMixDiffCoeffsMole");
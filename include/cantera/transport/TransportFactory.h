@@ -119,7 +119,34 @@ public:
      */
     virtual void initLiquidTransport(Transport* tr, thermo_t* thermo, int log_level=0);
 
+    //! Set the directory used to cache the polynomial fits of gas-phase
+    //! transport managers created by this factory
+    /*!
+     * See GasTransport::setFitCacheDirectory(). The initial value is taken
+     * from the environment variable CANTERA_TRANSPORT_CACHE, if it is set.
+     * An empty string disables the cache.
+     */
+    void setFitCacheDirectory(const std::string& dir) {
+        m_fitCacheDir = dir;
+    }
+
+    //! The directory used to cache the polynomial fits
+    const std::string& fitCacheDirectory() const {
+        return m_fitCacheDir;
+    }
+
 private:
+    //! Initialize a transport manager derived from GasTransport, using the
+    //! cached polynomial fits if available.
+    /*!
+     * @param tr        Pointer to the Transport manager
+     * @param thermo    Pointer to the ThermoPhase object
+     * @param mode      Chemkin compatibility mode (CK_Mode) or 0
+     * @param log_level Defaults to zero, no logging
+     */
+    void initGasTransport(Transport* tr, thermo_t* thermo, int mode,
+                          int log_level);
+
     //! Initialize an existing transport manager for solid phase
     /*!
      * This routine sets up an existing solid-phase transport manager. It is
@@ -242,6 +269,9 @@ private:
     //! Mapping between between the string name for a
     //! liquid mixture transport property model and the integer name.
     std::map<std::string, LiquidTranMixingModel> m_LTImodelMap;
+
+    //! Directory for cached polynomial fits. See setFitCacheDirectory().
+    std::string m_fitCacheDir;
 };
 
 //! Create a new transport manager instance.
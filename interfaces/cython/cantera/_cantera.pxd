@@ -399,6 +399,7 @@ cdef extern from "cantera/transport/DustyGasTransport.h" namespace "Cantera":
         void setMeanParticleDiameter(double) except +
         void setPermeability(double) except +
         void getMolarFluxes(double*, double*, double, double*) except +
+        void getMolarFluxes(size_t, double*, double*, double*) except +
 
 
 cdef extern from "cantera/transport/TransportData.h" namespace "Cantera":
@@ -628,6 +629,10 @@ cdef extern from "cantera/oneD/Inlet1D.h":
         CxxInlet1D()
         double spreadRate()
         void setSpreadRate(double)
+        double TKE()
+        void setTKE(double)
+        double ED()
+        void setED(double)
 
     cdef cppclass CxxOutlet1D "Cantera::Outlet1D":
         CxxOutlet1D()
@@ -656,13 +661,19 @@ cdef extern from "cantera/oneD/StFlow.h":
         void setPressure(double)
         void enableRadiation(cbool)
         cbool radiationEnabled()
+        void enableChemicalJacobian(cbool)
+        cbool chemicalJacobianEnabled()
+        void solveTurbulence(cbool)
+        cbool turbulenceEnabled()
         double pressure()
         void setTKE(double)
-        double TKE()
+        void setTKEProfile(vector[double]&, vector[double]&) except +
+        double TKE(size_t)
         void setED(double)
+        void setEDProfile(vector[double]&, vector[double]&) except +
         void getviscTurb(double*) except +
         void getTT_Out(double*) except +
-        double ED()
+        double ED(size_t)
         void setFixedTempProfile(vector[double]&, vector[double]&)
         void setBoundaryEmissivities(double, double)
         void solveEnergyEqn()
@@ -688,10 +699,14 @@ cdef extern from "cantera/oneD/Sim1D.h":
         void setTimeStep(double, size_t, int*) except +
         void getInitialSoln() except +
         void solve(int, cbool) except +translate_exception
+        vector[double] continuation(CxxFunc1*, vector[double]&, int, cbool, string, string, size_t) except +translate_exception
+        vector[double] arcLengthContinuation(CxxFunc1*, double, double, size_t, int, string, string) except +translate_exception
+        vector[double] turningPoints()
         void refine(int) except +
+        int coarsen(int) except +
         void setRefineCriteria(size_t, double, double, double, double) except +
         void save(string, string, string, int) except +
-        void restore(string, string, int) except +
+        void restore(string, string, int, cbool) except +
         void writeStats(int) except +
         void clearStats()
         int domainIndex(string) except +
@@ -699,6 +714,12 @@ cdef extern from "cantera/oneD/Sim1D.h":
         double workValue(size_t, size_t, size_t) except +
         void eval(double, int) except +
         void setJacAge(int, int)
+        void setJacobianColors(size_t) except +
+        void setNumThreads(size_t) except +
+        void setBlockSolver(cbool)
+        void setKrylovSolver(cbool)
+        void setBroydenUpdates(size_t)
+        void setAdaptiveTimeStepping(cbool, double, double, int) except +
         void setTimeStepFactor(double)
         void setMinTimeStep(double)
         void setMaxTimeStep(double)
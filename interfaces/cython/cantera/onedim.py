@@ -43,10 +43,12 @@ class FlameBase(Sim1D):
             by the maximum difference in the profile (0.0 < curve < 1.0). Adds
             points in regions of high curvature.
         :param prune:
-            if the slope or curve criteria are satisfied to the level of
-            'prune', the grid point is assumed not to be needed and is removed.
-            Set prune significantly smaller than 'slope' and 'curve'. Set to
-            zero to disable pruning the grid.
+            if the slope and curve criteria would still be satisfied to the
+            level of 'prune' without a grid point, the point is assumed not to
+            be needed and is removed once no new points are needed. Set prune
+            significantly smaller than 'slope' and 'curve', so that removed
+            points are not inserted again. Set to zero to disable pruning the
+            grid.
 
         >>> f.set_refine_criteria(ratio=3.0, slope=0.1, curve=0.2, prune=0)
         """
@@ -115,6 +117,18 @@ class FlameBase(Sim1D):
     def radiation_enabled(self, enable):
         self.flame.radiation_enabled = enable
 
+    @property
+    def chemical_jacobian_enabled(self):
+        """
+        Get/Set whether or not to compute the derivatives of the chemical
+        source terms in the Jacobian analytically
+        """
+        return self.flame.chemical_jacobian_enabled
+
+    @chemical_jacobian_enabled.setter
+    def chemical_jacobian_enabled(self, enable):
+        self.flame.chemical_jacobian_enabled = enable
+
     def set_boundary_emissivities(self, e_left, e_right):
         self.flame.set_boundary_emissivities(e_left, e_right)
 
@@ -142,6 +156,22 @@ class FlameBase(Sim1D):
         """ Array containing the temperature fluctuations [K] at each grid point. """
         return self.profile(self.flame, 'T_Prime')			
 
+    @property
+    def TKE(self):
+        """
+        Array containing the turbulent kinetic energy [m^2/s^2] at each grid
+        point.
+        """
+        return self.profile(self.flame, 'TKE')
+
+    @property
+    def ED(self):
+        """
+        Array containing the turbulent dissipation rate [m^2/s^3] at each grid
+        point.
+        """
+        return self.profile(self.flame, 'ED')
+
     @property
     def u(self):
         """
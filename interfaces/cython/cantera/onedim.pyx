@@ -257,6 +257,27 @@ cdef class Inlet1D(Boundary1D):
         def __set__(self, s):
             self.inlet.setSpreadRate(s)
 
+    property TKE:
+        """
+        Get/set the turbulent kinetic energy [m^2/s^2] at this boundary. Used
+        if the k-epsilon equations are enabled in the adjacent flow domain.
+        """
+        def __get__(self):
+            return self.inlet.TKE()
+        def __set__(self, k):
+            self.inlet.setTKE(k)
+
+    property ED:
+        """
+        Get/set the turbulent dissipation rate [m^2/s^3] at this boundary.
+        Used if the k-epsilon equations are enabled in the adjacent flow
+        domain.
+        """
+        def __get__(self):
+            return self.inlet.ED()
+        def __set__(self, e):
+            self.inlet.setED(e)
+
 
 cdef class Outlet1D(Boundary1D):
     """
@@ -420,6 +441,28 @@ cdef class _FlowBase(Domain1D):
             y.push_back(t)
         self.flow.setFixedTempProfile(x, y)
 
+    def set_turbulence_profile(self, pos, TKE, ED):
+        """Set the profiles of the turbulent kinetic energy [m^2/s^2] and the
+        turbulent dissipation rate [m^2/s^3]. The profiles are interpolated
+        onto the grid, and again whenever the grid is refined.
+
+        :param pos:
+            array of relative positions from 0 to 1
+        :param TKE:
+            array of turbulent kinetic energy values
+        :param ED:
+            array of turbulent dissipation rate values
+        """
+        cdef vector[double] x, k, e
+        for p in pos:
+            x.push_back(p)
+        for v in TKE:
+            k.push_back(v)
+        for v in ED:
+            e.push_back(v)
+        self.flow.setTKEProfile(x, k)
+        self.flow.setEDProfile(x, e)
+
     def __dealloc__(self):
         del self.flow
 
@@ -433,6 +476,29 @@ cdef class _FlowBase(Domain1D):
         def __set__(self, do_radiation):
             self.flow.enableRadiation(<cbool>do_radiation)
 
+    property chemical_jacobian_enabled:
+        """
+        Determines whether the derivatives of the chemical source terms are
+        added to the Jacobian analytically. If enabled, the rest of the
+        Jacobian is evaluated by finite differences with the species
+        production rates held fixed.
+        """
+        def __get__(self):
+            return self.flow.chemicalJacobianEnabled()
+        def __set__(self, enable):
+            self.flow.enableChemicalJacobian(<cbool>enable)
+
+    property turbulence_enabled:
+        """
+        Determines whether or not to solve the k-epsilon equations. If
+        disabled, the turbulent kinetic energy and dissipation rate are held
+        to the profiles set by `TKE`, `ED` or `set_turbulence_profile`.
+        """
+        def __get__(self):
+            return self.flow.turbulenceEnabled()
+        def __set__(self, do_turbulence):
+            self.flow.solveTurbulence(<cbool>do_turbulence)
+
 
 
 cdef CxxIdealGasPhase* getIdealGasPhase(ThermoPhase phase) except *:
@@ -714,6 +780,88 @@ cdef class Sim1D:
             self.set_initial_guess()
         self.sim.solve(loglevel, <cbool>refine_grid)
 
+    def continuation(self, f, values, loglevel=1, refine_grid=True,
+                     filename='', name='continuation', max_halvings=4):
+        """
+        Solve the problem for a sequence of values of a parameter, using the
+        solutions for the previous values to predict each new solution.
+        Returns the list of parameter values for which solutions were found.
+
+        :param f:
+            function of one argument which applies a value of the parameter,
+            for example ``lambda mdot: setattr(sim.inlet, 'mdot', mdot)``.
+        :param values:
+            sequence of parameter values
+        :param loglevel:
+            integer flag controlling the amount of diagnostic output.
+        :param refine_grid:
+            if True, enable grid refinement.
+        :param filename:
+            if not empty, each solution is saved to this file as it is found,
+            with the names ``<name>_0``, ``<name>_1``, etc.
+        :param name:
+            prefix for the names of the saved solutions
+        :param max_halvings:
+            number of times the step in the parameter is halved after a
+            failure before the continuation is stopped.
+
+        >>> values = f.continuation(lambda T: setattr(f.inlet, 'T', T),
+        ...                         [300, 350, 400], filename='sweep.xml')
+        """
+        if not self._initialized:
+            self.set_initial_guess()
+
+        def setter(value):
+            f(value)
+            return 0.0
+        g = Func1(setter)
+        return self.sim.continuation(g.func, values, loglevel,
+                                     <cbool>refine_grid, stringify(filename),
+                                     stringify(name), max_halvings)
+
+    def arclength_continuation(self, f, p0, dp, n_steps, loglevel=1,
+                               filename='', name='arclength'):
+        """
+        Follow a branch of solutions with pseudo-arclength continuation in a
+        parameter, starting from the current solution, which must be
+        converged for the parameter value *p0*. The grid is fixed. Unlike
+        `continuation`, this can follow the branch through turning points,
+        such as the extinction point of a strained flame; these are available
+        afterwards from `turning_points`. Returns the list of parameter
+        values along the branch.
+
+        :param f:
+            function of one argument which applies a value of the parameter.
+        :param p0:
+            parameter value for the current solution
+        :param dp:
+            step in the parameter for the first step
+        :param n_steps:
+            number of steps
+        :param loglevel:
+            integer flag controlling the amount of diagnostic output.
+        :param filename:
+            if not empty, each solution is saved to this file as it is found,
+            as for `continuation`.
+        :param name:
+            prefix for the names of the saved solutions
+        """
+        def setter(value):
+            f(value)
+            return 0.0
+        g = Func1(setter)
+        return self.sim.arcLengthContinuation(g.func, p0, dp, n_steps,
+                                              loglevel, stringify(filename),
+                                              stringify(name))
+
+    property turning_points:
+        """
+        Parameter values at the turning points found by the last call to
+        `arclength_continuation`.
+        """
+        def __get__(self):
+            return self.sim.turningPoints()
+
     def refine(self, loglevel=1):
         """
         Refine the grid, adding points where solution is not adequately
@@ -721,6 +869,16 @@ cdef class Sim1D:
         """
         self.sim.refine(loglevel)
 
+    def coarsen(self, loglevel=1):
+        """
+        Remove grid points which are not needed to satisfy the refinement
+        criteria, in domains where the *prune* criterion set by
+        `set_refine_criteria` is positive and no new points are needed. This
+        is done automatically by `solve` once the grid no longer needs
+        refinement. Returns the number of points removed.
+        """
+        return self.sim.coarsen(loglevel)
+
     def set_refine_criteria(self, domain, ratio=10.0, slope=0.8, curve=0.8,
                           prune=0.05):
         """
@@ -740,10 +898,12 @@ cdef class Sim1D:
             by the maximum difference in the profile (0.0 < curve < 1.0). Adds
             points in regions of high curvature.
         :param prune:
-            if the slope or curve criteria are satisfied to the level of
-            'prune', the grid point is assumed not to be needed and is removed.
-            Set prune significantly smaller than 'slope' and 'curve'. Set to
-            zero to disable pruning the grid.
+            if the slope and curve criteria would still be satisfied to the
+            level of 'prune' without a grid point, the point is assumed not to
+            be needed and is removed once no new points are needed. Set prune
+            significantly smaller than 'slope' and 'curve', so that removed
+            points are not inserted again. Set to zero to disable pruning the
+            grid.
 
         >>> s.set_refine_criteria(d, ratio=5.0, slope=0.2, curve=0.3, prune=0.03)
         """
@@ -773,6 +933,70 @@ cdef class Sim1D:
         """
         self.sim.setJacAge(ss_age, ts_age)
 
+    def set_jacobian_colors(self, ncolors):
+        """
+        Set the number of colors used to evaluate the Jacobian. If *ncolors*
+        is 0 (the default), each column of the Jacobian is evaluated
+        separately. Otherwise, each solution component is perturbed at every
+        *ncolors*-th grid point at once, which reduces the number of
+        evaluations of the residual function. *ncolors* must be at least 3.
+        """
+        self.sim.setJacobianColors(ncolors)
+
+    def set_num_threads(self, nthreads):
+        """
+        Set the number of threads used to evaluate the residual function. If
+        *nthreads* is greater than 1, the evaluation of the thermodynamic
+        properties and reaction rates is divided among the threads, each of
+        which uses its own copy of the phase and kinetics objects. The
+        Jacobian is only evaluated in parallel if colored evaluation is
+        enabled with `set_jacobian_colors`.
+        """
+        self.sim.setNumThreads(nthreads)
+
+    def set_block_solver(self, block=True):
+        """
+        Select the linear solver used by the Newton iteration. If *block* is
+        `True`, the Jacobian is stored as a block tridiagonal matrix with one
+        block for each grid point, and factored by block LU decomposition,
+        which requires less memory and time than the default banded solver.
+        """
+        self.sim.setBlockSolver(block)
+
+    def set_krylov_solver(self, krylov=True):
+        """
+        Compute the Newton steps with a Jacobian-free Newton-Krylov method.
+        If *krylov* is `True`, each step is computed by GMRES using
+        differences of the residual function instead of a stored Jacobian,
+        preconditioned with the Jacobian blocks for each grid point. This
+        option takes precedence over `set_block_solver`.
+        """
+        self.sim.setKrylovSolver(krylov)
+
+    def set_broyden_updates(self, max_updates):
+        """
+        Use each accepted Newton step to apply a Broyden update to the
+        current Jacobian, deferring new Jacobian evaluations until
+        *max_updates* updates have been applied. A value of 0 (the default)
+        disables the updates. The number of updates and avoided Jacobian
+        evaluations is included in the output of `show_stats`.
+        """
+        self.sim.setBroydenUpdates(max_updates)
+
+    def set_adaptive_time_stepping(self, adaptive=True, errtol=1e5,
+                                   ss_reduction=0.1, max_steps=100):
+        """
+        Use the adaptive, error-controlled BDF2 method for the time steps
+        taken when the steady-state Newton iteration fails. Steps where the
+        estimated local error exceeds *errtol*, measured relative to the
+        transient tolerances, are rejected. Time stepping stops as soon as the
+        steady-state residual is reduced by the factor *ss_reduction*, or
+        after *max_steps* steps, instead of after the number of steps set by
+        `set_time_step`.
+        """
+        self.sim.setAdaptiveTimeStepping(adaptive, errtol, ss_reduction,
+                                         max_steps)
+
     def set_time_step_factor(self, tfactor):
         """
         Set the factor by which the time step will be increased after a
@@ -798,7 +1022,11 @@ cdef class Sim1D:
     def save(self, filename='soln.xml', name='solution', description='none',
              loglevel=1):
         """
-        Save the solution in XML format.
+        Save the solution in XML format, or in a compact binary checkpoint
+        format if the name of the file ends in ``.bin``. The binary format
+        stores the grid and solution of each domain, which are restored
+        quickly, but not the other settings of the domains, such as the
+        tolerances and the enabled equations.
 
         :param filename:
             solution file
@@ -814,20 +1042,25 @@ cdef class Sim1D:
         self.sim.save(stringify(filename), stringify(name),
                       stringify(description), loglevel)
 
-    def restore(self, filename='soln.xml', name='solution', loglevel=2):
+    def restore(self, filename='soln.xml', name='solution', loglevel=2,
+                keep_grid=False):
         """Set the solution vector to a previously-saved solution.
 
         :param filename:
-            solution file
+            solution file, in either XML or binary checkpoint format
         :param name:
             solution name within the file
         :param loglevel:
             Amount of logging information to display while restoring,
             from 0 (disabled) to 2 (most verbose).
+        :param keep_grid:
+            If True, interpolate the saved solution onto the current grid
+            instead of replacing the grid with the saved grid.
 
         >>> s.restore(filename='save.xml', name='energy_off')
         """
-        self.sim.restore(stringify(filename), stringify(name), loglevel)
+        self.sim.restore(stringify(filename), stringify(name), loglevel,
+                         <cbool>keep_grid)
         self._initialized = True
 
     def show_stats(self, print_time=True):
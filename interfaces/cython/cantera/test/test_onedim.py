@@ -186,6 +186,177 @@ class TestFreeFlame(utilities.CanteraTest):
         for rhou_j in self.sim.density * self.sim.u:
             self.assertNear(rhou_j, rhou, 1e-4)
 
+    def test_jacobian_colors(self):
+        reactants= 'H2:1.1, O2:1, AR:5'
+        p = ct.one_atm
+        Tin = 300
+
+        self.create_sim(p, Tin, reactants)
+        self.solve_fixed_T()
+        self.solve_mix()
+        Su1 = self.sim.u[0]
+        Tad1 = self.sim.T[-1]
+
+        with self.assertRaises(ct.CanteraError):
+            self.sim.set_jacobian_colors(2)
+
+        self.create_sim(p, Tin, reactants)
+        self.sim.set_jacobian_colors(3)
+        self.solve_fixed_T()
+        self.solve_mix()
+
+        self.assertNear(self.sim.u[0], Su1, 1e-5)
+        self.assertNear(self.sim.T[-1], Tad1, 1e-5)
+
+    def test_num_threads(self):
+        reactants= 'H2:1.1, O2:1, AR:5'
+        p = ct.one_atm
+        Tin = 300
+
+        self.create_sim(p, Tin, reactants)
+        self.sim.set_jacobian_colors(3)
+        self.solve_fixed_T()
+        self.solve_mix()
+        Su1 = self.sim.u[0]
+        Tad1 = self.sim.T[-1]
+
+        with self.assertRaises(ct.CanteraError):
+            self.sim.set_num_threads(0)
+
+        self.create_sim(p, Tin, reactants)
+        self.sim.set_jacobian_colors(3)
+        self.sim.set_num_threads(3)
+        self.solve_fixed_T()
+        self.solve_mix()
+
+        self.assertNear(self.sim.u[0], Su1, 1e-10)
+        self.assertNear(self.sim.T[-1], Tad1, 1e-10)
+
+    def test_block_solver(self):
+        reactants= 'H2:1.1, O2:1, AR:5'
+        p = ct.one_atm
+        Tin = 300
+
+        self.create_sim(p, Tin, reactants)
+        self.solve_fixed_T()
+        self.solve_mix()
+        Su1 = self.sim.u[0]
+        Tad1 = self.sim.T[-1]
+
+        self.create_sim(p, Tin, reactants)
+        self.sim.set_block_solver(True)
+        self.solve_fixed_T()
+        self.solve_mix()
+
+        self.assertNear(self.sim.u[0], Su1, 1e-6)
+        self.assertNear(self.sim.T[-1], Tad1, 1e-6)
+
+    def test_krylov_solver(self):
+        reactants= 'H2:1.1, O2:1, AR:5'
+        p = ct.one_atm
+        Tin = 300
+
+        self.create_sim(p, Tin, reactants)
+        self.solve_fixed_T()
+        u1 = self.sim.u
+        Y1 = self.sim.Y
+
+        self.create_sim(p, Tin, reactants)
+        self.sim.set_krylov_solver(True)
+        self.solve_fixed_T()
+
+        self.assertArrayNear(self.sim.u, u1, 1e-6)
+        self.assertArrayNear(self.sim.Y, Y1, 1e-5, 1e-12)
+
+    def test_broyden_updates(self):
+        reactants= 'H2:1.1, O2:1, AR:5'
+        p = ct.one_atm
+        Tin = 300
+
+        self.create_sim(p, Tin, reactants)
+        self.solve_fixed_T()
+        self.solve_mix()
+        Su1 = self.sim.u[0]
+        Tad1 = self.sim.T[-1]
+
+        self.create_sim(p, Tin, reactants)
+        self.sim.set_broyden_updates(10)
+        self.solve_fixed_T()
+        self.solve_mix()
+
+        self.assertNear(self.sim.u[0], Su1, 1e-5)
+        self.assertNear(self.sim.T[-1], Tad1, 1e-6)
+
+    def test_adaptive_time_stepping(self):
+        reactants= 'H2:1.1, O2:1, AR:5'
+        p = ct.one_atm
+        Tin = 300
+
+        self.create_sim(p, Tin, reactants)
+        self.solve_fixed_T()
+        self.solve_mix()
+        Su1 = self.sim.u[0]
+        Tad1 = self.sim.T[-1]
+
+        self.create_sim(p, Tin, reactants)
+        self.sim.set_adaptive_time_stepping(True)
+        self.solve_fixed_T()
+        self.solve_mix()
+
+        self.assertNear(self.sim.u[0], Su1, 1e-5)
+        self.assertNear(self.sim.T[-1], Tad1, 1e-6)
+
+        with self.assertRaises(ct.CanteraError):
+            self.sim.set_adaptive_time_stepping(True, ss_reduction=2.0)
+
+    def test_continuation(self):
+        reactants= 'H2:1.1, O2:1, AR:5'
+        p = ct.one_atm
+
+        self.create_sim(p, 340, reactants)
+        self.solve_fixed_T()
+        self.solve_mix()
+        Su1 = self.sim.u[0]
+
+        self.create_sim(p, 300, reactants)
+        self.solve_fixed_T()
+        self.solve_mix()
+
+        def set_T(T):
+            self.sim.inlet.T = T
+        values = self.sim.continuation(set_T, [320, 340], loglevel=0)
+        self.assertArrayNear(values, [320, 340])
+        self.assertNear(self.sim.inlet.T, 340)
+        self.assertNear(self.sim.u[0], Su1, 1e-4)
+
+        values = self.sim.arclength_continuation(set_T, 340, 10, 3,
+                                                 loglevel=0)
+        self.assertEqual(len(values), 4)
+        self.assertTrue(all(np.diff(values) > 0))
+        self.assertEqual(len(self.sim.turning_points), 0)
+        self.assertNear(self.sim.inlet.T, values[-1])
+
+    def test_chemical_jacobian(self):
+        reactants= 'H2:1.1, O2:1, AR:5'
+        p = ct.one_atm
+        Tin = 300
+
+        self.create_sim(p, Tin, reactants)
+        self.solve_fixed_T()
+        self.solve_mix()
+        Su1 = self.sim.u[0]
+        Tad1 = self.sim.T[-1]
+
+        self.create_sim(p, Tin, reactants)
+        self.assertFalse(self.sim.chemical_jacobian_enabled)
+        self.sim.chemical_jacobian_enabled = True
+        self.assertTrue(self.sim.chemical_jacobian_enabled)
+        self.solve_fixed_T()
+        self.solve_mix()
+
+        self.assertNear(self.sim.u[0], Su1, 1e-6)
+        self.assertNear(self.sim.T[-1], Tad1, 1e-6)
+
     # @utilities.unittest.skip('sometimes slow')
     def test_multicomponent(self):
         reactants= 'H2:1.1, O2:1, AR:5.3'
@@ -234,6 +405,29 @@ class TestFreeFlame(utilities.CanteraTest):
         # TODO: check that the solution is actually correct (i.e. that the
         # residual satisfies the error tolerances) on the new grid.
 
+    def test_coarsen(self):
+        reactants= 'H2:1.1, O2:1, AR:5'
+        p = ct.one_atm
+        Tin = 300
+
+        self.create_sim(p, Tin, reactants)
+        self.solve_fixed_T()
+        self.solve_mix(slope=0.2, curve=0.1, prune=0.0)
+        N1 = len(self.sim.grid)
+        Su1 = self.sim.u[0]
+
+        # Points should be removed once the criteria are relaxed, without
+        # changing the solution significantly
+        self.solve_mix(slope=0.2, curve=0.1, prune=0.05)
+        N2 = len(self.sim.grid)
+        self.assertLess(N2, N1)
+        self.assertNear(self.sim.u[0], Su1, 2e-2)
+
+        # Removed points should not be inserted again by later solutions
+        self.sim.solve(loglevel=0, refine_grid=True)
+        self.assertLessEqual(len(self.sim.grid), N2)
+        self.assertNear(self.sim.u[0], Su1, 2e-2)
+
     def test_save_restore(self):
         reactants= 'H2:1.1, O2:1, AR:5'
         p = 2 * ct.one_atm
@@ -325,6 +519,181 @@ class TestFreeFlame(utilities.CanteraTest):
             k2 = gas2.species_index(species)
             self.assertArrayNear(Y1[k1], Y2[k2])
 
+    def test_save_restore_binary(self):
+        reactants= 'H2:1.1, O2:1, AR:5'
+        p = 2 * ct.one_atm
+        Tin = 400
+
+        filename = 'onedim-checkpoint{0}.bin'.format(utilities.python_version)
+        if os.path.exists(filename):
+            os.remove(filename)
+
+        self.create_sim(p, Tin, reactants)
+        self.solve_fixed_T()
+        self.solve_mix(ratio=5, slope=0.5, curve=0.3)
+        grid1 = self.sim.grid
+        T1 = self.sim.T
+        Y1 = self.sim.Y
+        u1 = self.sim.u
+        self.sim.save(filename, 'test', loglevel=0)
+        size1 = os.path.getsize(filename)
+        # A new id is appended, and an existing one is replaced
+        self.sim.save(filename, 'test2', loglevel=0)
+        size2 = os.path.getsize(filename)
+        self.assertGreater(size2, size1)
+        self.sim.save(filename, 'test', loglevel=0)
+        self.assertEqual(os.path.getsize(filename), size2)
+        self.assertFalse(os.path.exists(filename + '.tmp'))
+
+        # Existing files which are not checkpoint files are not overwritten
+        other = 'onedim-not-checkpoint{0}.bin'.format(utilities.python_version)
+        with open(other, 'w') as f:
+            f.write('not a checkpoint')
+        with self.assertRaises(RuntimeError):
+            self.sim.save(other, 'test', loglevel=0)
+        with open(other) as f:
+            self.assertEqual(f.read(), 'not a checkpoint')
+
+        self.sim = ct.FreeFlame(self.gas)
+        self.sim.restore(filename, 'test', loglevel=0)
+        self.assertNear(self.sim.P, p)
+        self.assertArrayNear(self.sim.grid, grid1)
+        self.assertArrayNear(self.sim.T, T1)
+        self.assertArrayNear(self.sim.Y, Y1)
+        self.assertArrayNear(self.sim.u, u1)
+
+        # Interpolate onto a different grid
+        grid2 = np.linspace(0, 0.03, 21)
+        self.sim = ct.FreeFlame(self.gas, grid2)
+        self.sim.restore(filename, 'test2', loglevel=0, keep_grid=True)
+        self.assertArrayNear(self.sim.grid, grid2)
+        self.assertArrayNear(self.sim.T, np.interp(grid2, grid1, T1))
+        self.assertArrayNear(self.sim.u, np.interp(grid2, grid1, u1))
+
+    def test_turbulence(self):
+        reactants = 'H2:1.1, O2:1, AR:5'
+        self.create_sim(ct.one_atm, 300, reactants)
+        flame = self.sim.flame
+
+        # The k-epsilon components sit between the temperature fluctuations
+        # and the species mass fractions
+        names = flame.component_names
+        self.assertEqual(names[:7],
+                         ['u', 'V', 'T', 'lambda', 'T_Prime', 'TKE', 'ED'])
+        self.assertEqual(names[7:], self.gas.species_names)
+        self.assertEqual(flame.n_components, 7 + self.gas.n_species)
+        self.assertEqual(flame.component_index('TKE'), 5)
+        self.assertEqual(flame.component_index('ED'), 6)
+        self.assertEqual(flame.component_index(self.gas.species_name(0)), 7)
+
+        # With the k-epsilon equations disabled, TKE and ED are held to the
+        # specified profiles
+        flame.TKE = 1e-3
+        flame.ED = 1e-2
+        self.solve_fixed_T()
+        self.solve_mix(ratio=5, slope=0.5, curve=0.3)
+        self.assertFalse(flame.turbulence_enabled)
+        self.assertArrayNear(self.sim.TKE, 1e-3 * np.ones(len(self.sim.grid)))
+        self.assertArrayNear(self.sim.ED, 1e-2 * np.ones(len(self.sim.grid)))
+
+        self.sim.inlet.TKE = 2e-3
+        self.sim.inlet.ED = 3e-2
+        flame.turbulence_enabled = True
+        self.sim.solve(loglevel=0, refine_grid=True)
+        self.assertTrue(flame.turbulence_enabled)
+        self.assertNear(self.sim.inlet.TKE, 2e-3)
+        self.assertNear(self.sim.inlet.ED, 3e-2)
+        self.assertNear(self.sim.TKE[0], 2e-3)
+        self.assertNear(self.sim.ED[0], 3e-2)
+        self.assertGreater(max(self.sim.TKE), 2e-3)
+
+        filename = 'onedim-turbulence{0}.xml'.format(utilities.python_version)
+        if os.path.exists(filename):
+            os.remove(filename)
+
+        grid1 = self.sim.grid
+        T1 = self.sim.T
+        TKE1 = self.sim.TKE
+        ED1 = self.sim.ED
+        self.sim.save(filename, 'test', loglevel=0)
+
+        self.sim = ct.FreeFlame(self.gas)
+        self.sim.restore(filename, 'test', loglevel=0)
+        self.assertTrue(self.sim.flame.turbulence_enabled)
+        self.assertNear(self.sim.inlet.TKE, 2e-3)
+        self.assertNear(self.sim.inlet.ED, 3e-2)
+        self.assertArrayNear(self.sim.grid, grid1)
+        self.assertArrayNear(self.sim.T, T1)
+        self.assertArrayNear(self.sim.TKE, TKE1)
+        self.assertArrayNear(self.sim.ED, ED1)
+
+    def test_restore_without_turbulence(self):
+        # Solutions saved before the k-epsilon equations were added have no
+        # TKE or ED data
+        import xml.etree.ElementTree as ET
+
+        reactants = 'H2:1.1, O2:1, AR:5'
+        self.create_sim(ct.one_atm, 300, reactants)
+        self.solve_fixed_T()
+        u1 = self.sim.u
+        T1 = self.sim.T
+        Y1 = self.sim.Y
+
+        filename = 'onedim-no-turbulence{0}.xml'.format(utilities.python_version)
+        if os.path.exists(filename):
+            os.remove(filename)
+        self.sim.save(filename, 'test', loglevel=0)
+
+        tree = ET.parse(filename)
+        for parent in tree.iter():
+            for child in list(parent):
+                if (child.get('title') in ('TKE', 'ED') or
+                    child.tag in ('TKE', 'ED', 'turbulence_enabled')):
+                    parent.remove(child)
+        tree.write(filename)
+
+        self.sim = ct.FreeFlame(self.gas)
+        self.sim.restore(filename, 'test', loglevel=0)
+        self.assertFalse(self.sim.flame.turbulence_enabled)
+        self.assertArrayNear(self.sim.u, u1)
+        self.assertArrayNear(self.sim.T, T1)
+        self.assertArrayNear(self.sim.Y, Y1)
+        self.assertArrayNear(self.sim.TKE, np.zeros(len(self.sim.grid)))
+        self.assertArrayNear(self.sim.ED, np.zeros(len(self.sim.grid)))
+
+        self.solve_fixed_T()
+        self.assertArrayNear(self.sim.u, u1, 1e-3)
+
+    def test_turbulence_profile(self):
+        self.create_sim(ct.one_atm, 300, 'H2:1.1, O2:1, AR:5')
+        flame = self.sim.flame
+        pos = [0.0, 0.4, 1.0]
+        TKE = [1e-3, 4e-3, 2e-3]
+        ED = [1e-2, 6e-2, 3e-2]
+        flame.set_turbulence_profile(pos, TKE, ED)
+
+        def check_profiles():
+            grid = self.sim.grid
+            zz = (grid - grid[0]) / (grid[-1] - grid[0])
+            self.assertArrayNear(self.sim.TKE, np.interp(zz, pos, TKE))
+            self.assertArrayNear(self.sim.ED, np.interp(zz, pos, ED))
+
+        # With the k-epsilon equations disabled, the solution follows the
+        # profiles interpolated onto the grid
+        self.solve_fixed_T()
+        check_profiles()
+
+        # The profiles are interpolated again onto the refined grid
+        N1 = len(self.sim.grid)
+        self.sim.set_refine_criteria(ratio=5, slope=0.5, curve=0.3)
+        self.sim.refine(loglevel=0)
+        self.assertGreater(len(self.sim.grid), N1)
+        self.sim.solve(loglevel=0, refine_grid=False)
+        check_profiles()
+
+        with self.assertRaises(RuntimeError):
+            flame.set_turbulence_profile([0.0, 1.0], [1e-3], [1e-2, 2e-2])
+
     def test_save_restore_remove_species(self):
         reactants= 'H2:1.1, O2:1, AR:5'
         p = 2 * ct.one_atm
@@ -388,9 +757,10 @@ class TestDiffusionFlame(utilities.CanteraTest):
     #     >>> t.test_mixture_averaged(True)
 
     def create_sim(self, p, fuel='H2:1.0, AR:1.0', T_fuel=300, mdot_fuel=0.24,
-                   oxidizer='O2:0.2, AR:0.8', T_ox=300, mdot_ox=0.72):
+                   oxidizer='O2:0.2, AR:0.8', T_ox=300, mdot_ox=0.72,
+                   n_points=6):
 
-        initial_grid = np.linspace(0, 0.02, 6)  # m
+        initial_grid = np.linspace(0, 0.02, n_points)  # m
         tol_ss = [2.0e-5, 1.0e-11]  # [rtol, atol] for steady-state problem
         tol_ts = [5.0e-4, 1.0e-11]  # [rtol, atol] for time stepping
 
@@ -485,6 +855,36 @@ class TestDiffusionFlame(utilities.CanteraTest):
                                             rtol=1e-2, atol=1e-8, xtol=1e-2)
             self.assertFalse(bad, bad)
 
+    def test_extinction_arclength(self):
+        # Increasing both mass fluxes strains the flame until it is
+        # extinguished at a turning point, beyond which the solution branch
+        # continues to lower mass fluxes
+        self.create_sim(p=ct.one_atm, fuel='H2:0.15, AR:0.85', mdot_fuel=0.70,
+                        oxidizer='O2:0.21, AR:0.79', mdot_ox=0.78,
+                        n_points=21)
+        self.solve_fixed_T()
+        self.solve_mix(slope=0.4, curve=0.4)
+        T_burning = max(self.sim.T)
+
+        def set_mdot(s):
+            self.sim.fuel_inlet.mdot = 0.70 * s
+            self.sim.oxidizer_inlet.mdot = 0.78 * s
+        values = self.sim.continuation(set_mdot, [2, 4, 6, 8], loglevel=0,
+                                       refine_grid=False)
+        self.assertNear(values[-1], 8)
+
+        values = self.sim.arclength_continuation(set_mdot, 8, 2, 20,
+                                                 loglevel=0)
+        self.assertEqual(len(values), 21)
+        self.assertEqual(len(self.sim.turning_points), 1)
+        s_ext = self.sim.turning_points[0]
+        self.assertNear(s_ext, 21.4, 0.02)
+        n = values.index(s_ext)
+        self.assertTrue(all(np.diff(values[:n+1]) > 0))
+        self.assertTrue(all(np.diff(values[n:]) < 0))
+        self.assertNear(self.sim.fuel_inlet.mdot, 0.70 * values[-1])
+        self.assertLess(max(self.sim.T), T_burning)
+
     def test_strain_rate(self):
         # This doesn't test that the values are correct, just that they can be
         # computed without error
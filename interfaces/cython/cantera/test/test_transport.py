@@ -132,6 +132,26 @@ class TestDustyGas(utilities.CanteraTest):
         # Not sure why the following condition is not satisfied:
         # self.assertNear(sum(fluxes1) / sum(abs(fluxes1)), 0.0)
 
+    def test_mesh_molar_fluxes(self):
+        T = np.array([500.0, 500.0, 520.0])
+        P = [ct.one_atm, 1.01 * ct.one_atm, 1.01 * ct.one_atm]
+        X = ["O2:2.0, H2:1.0, H2O:1.0", "O2:2.0, H2:1.001, H2O:0.999",
+             "O2:2.0, H2:1.003, H2O:0.997"]
+        rho = np.empty(3)
+        Y = np.empty((3, self.phase.n_species))
+        for j in range(3):
+            self.phase.TPX = T[j], P[j], X[j]
+            rho[j] = self.phase.density
+            Y[j] = self.phase.Y
+        delta = np.array([1e-4, 2e-4])
+
+        fluxes = self.phase.mesh_molar_fluxes(T, rho, Y, delta)
+        self.assertEqual(fluxes.shape, (2, self.phase.n_species))
+        for j in range(2):
+            ref = self.phase.molar_fluxes(T[j], T[j+1], rho[j], rho[j+1],
+                                          Y[j], Y[j+1], delta[j])
+            self.assertArrayNear(ref, fluxes[j])
+
 
 class TestTransportData(utilities.CanteraTest):
     @classmethod
@@ -271,3 +271,36 @@ cdef class DustyGasTransport(Transport):
         (<CxxDustyGasTransport*>self.transport).getMolarFluxes(&state1[0],
             &state2[0], delta, &fluxes[0])
         return fluxes
+
+    def mesh_molar_fluxes(self, T, rho, Y, delta):
+        """
+        Get the molar fluxes [kmol/m^2/s] between each pair of adjacent points
+        of a one-dimensional mesh. Row *j* of the returned array holds the
+        fluxes between points *j* and *j+1*, as given by `molar_fluxes`.
+
+        :param T:
+            Array of temperatures [K] at the mesh points
+        :param rho:
+            Array of densities [kg/m^3] at the mesh points
+        :param Y:
+            Array of mass fractions, with shape (number of points, `n_species`)
+        :param delta:
+            Array of distances [m] between adjacent points
+        """
+        npts = len(T)
+        nsp = self.n_species
+        if len(rho) != npts or len(delta) != npts - 1:
+            raise ValueError('Inconsistent array lengths')
+        cdef np.ndarray[np.double_t, ndim=2] states = np.empty((npts, nsp + 2))
+        cdef np.ndarray[np.double_t, ndim=1] dz = np.ascontiguousarray(delta,
+                                                                      dtype=np.double)
+        cdef np.ndarray[np.double_t, ndim=2] fluxes = np.empty((max(npts - 1, 0), nsp))
+
+        states[:,0] = T
+        states[:,1] = rho
+        states[:,2:] = Y
+
+        if npts > 1:
+            (<CxxDustyGasTransport*>self.transport).getMolarFluxes(npts,
+                &states[0,0], &dz[0], &fluxes[0,0])
+        return fluxes
@@ -46,7 +46,8 @@ int _equilflag(const char* xy)
 ChemEquil::ChemEquil() : m_skip(npos), m_elementTotalSum(1.0),
     m_p0(OneAtm), m_eloc(npos),
     m_elemFracCutoff(1.0E-100),
-    m_doResPerturb(false)
+    m_doResPerturb(false),
+    m_guessT(0.0)
 {}
 
 ChemEquil::ChemEquil(thermo_t& s) :
@@ -54,7 +55,8 @@ ChemEquil::ChemEquil(thermo_t& s) :
     m_elementTotalSum(1.0),
     m_p0(OneAtm), m_eloc(npos),
     m_elemFracCutoff(1.0E-100),
-    m_doResPerturb(false)
+    m_doResPerturb(false),
+    m_guessT(0.0)
 {
     initialize(s);
 }
@@ -185,6 +187,12 @@ void ChemEquil::update(const thermo_t& s)
     }
 }
 
+void ChemEquil::setInitialGuess(doublereal T, const vector_fp& lambda_RT)
+{
+    m_guessT = T;
+    m_guessLambda = lambda_RT;
+}
+
 int ChemEquil::setInitialMoles(thermo_t& s, vector_fp& elMoleGoal,
                                int loglevel)
 {
@@ -438,8 +446,32 @@ int ChemEquil::equilibrate(thermo_t& s, const char* XYstr,
 
     doublereal tmaxPhase = s.maxTemp();
     doublereal tminPhase = s.minTemp();
+
+    // If continuing from a previous solution, start from the temperature and
+    // element potentials supplied through setInitialGuess() and skip the
+    // (comparatively expensive) estimation of the initial state.
+    bool warmStart = options.contin && m_guessLambda.size() == m_mm;
+    if (warmStart) {
+        if (!tempFixed) {
+            s.setTemperature(clip(m_guessT, tminPhase, tmaxPhase));
+        }
+        copy(m_guessLambda.begin(), m_guessLambda.end(), x.begin());
+
+        // Set the composition from the element potentials, then restore the
+        // specified pressure or density
+        setToEquilState(s, x, s.temperature());
+        if (XY == TP || XY == PT || XY == HP || XY == PH ||
+                XY == SP || XY == PS) {
+            s.setPressure(yval);
+        } else {
+            s.setDensity(yval);
+        }
+        update(s);
+    }
+    m_guessLambda.clear();
+
     // loop to estimate T
-    if (!tempFixed) {
+    if (!tempFixed && !warmStart) {
         doublereal tmin = std::max(s.temperature(), tminPhase);
         if (tmin > tmaxPhase) {
             tmin = tmaxPhase - 20;
@@ -510,30 +542,32 @@ int ChemEquil::equilibrate(thermo_t& s, const char* XYstr,
         }
     }
 
-    setInitialMoles(s, elMolesGoal,loglevel);
+    if (!warmStart) {
+        setInitialMoles(s, elMolesGoal,loglevel);
 
-    // If requested, get the initial estimate for the chemical potentials from
-    // the ThermoPhase object itself. Or else, create our own estimate.
-    if (useThermoPhaseElementPotentials) {
-        bool haveEm = s.getElementPotentials(x.data());
-        if (haveEm) {
-            if (s.temperature() < 100.) {
-                writelog("we are here {:g}\n", s.temperature());
-            }
-            for (m = 0; m < m_mm; m++) {
-                x[m] *= 1.0 / s.RT();
+        // If requested, get the initial estimate for the chemical potentials
+        // from the ThermoPhase object itself. Or else, create our own estimate.
+        if (useThermoPhaseElementPotentials) {
+            bool haveEm = s.getElementPotentials(x.data());
+            if (haveEm) {
+                if (s.temperature() < 100.) {
+                    writelog("we are here {:g}\n", s.temperature());
+                }
+                for (m = 0; m < m_mm; m++) {
+                    x[m] *= 1.0 / s.RT();
+                }
+            } else {
+                estimateElementPotentials(s, x, elMolesGoal);
             }
         } else {
+            // Calculate initial estimates of the element potentials. This
+            // algorithm uese the MultiPhaseEquil object's initialization
+            // capabilities to calculate an initial estimate of the mole
+            // fractions for a set of linearly independent component species.
+            // Then, the element potentials are solved for based on the
+            // chemical potentials of the component species.
             estimateElementPotentials(s, x, elMolesGoal);
         }
-    } else {
-        // Calculate initial estimates of the element potentials. This algorithm
-        // uese the MultiPhaseEquil object's initialization capabilities to
-        // calculate an initial estimate of the mole fractions for a set of
-        // linearly independent component species. Then, the element potentials
-        // are solved for based on the chemical potentials of the component
-        // species.
-        estimateElementPotentials(s, x, elMolesGoal);
     }
 
     // Do a better estimate of the element potentials. We have found that the
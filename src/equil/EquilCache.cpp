@@ -0,0 +1,285 @@
+/**
+ *  @file EquilCache.cpp
+ *  Implementation file for class EquilCache.
+ */
+
+#include "cantera/equil/EquilCache.h"
+#include "cantera/base/global.h"
+#include "cantera/base/utilities.h"
+
+using namespace std;
+
+namespace Cantera
+{
+
+EquilCache::EquilCache(size_t maxEntries) :
+    m_maxEntries(maxEntries),
+    m_XY(-1),
+    m_clock(0),
+    m_warmDist(0.5),
+    m_retrieveRadius(0.0),
+    m_retrieveTol(0.0),
+    m_nRetrieved(0),
+    m_nWarm(0),
+    m_nCold(0),
+    m_kk(0),
+    m_mm(0)
+{
+    options.relTolerance = 1e-9;
+    options.maxIterations = 50000;
+}
+
+void EquilCache::clear()
+{
+    m_entries.clear();
+}
+
+void EquilCache::equilibrate(thermo_t& s, const std::string& XYstr,
+                             int loglevel)
+{
+    int XY = _equilflag(XYstr.c_str());
+    if (!m_solver || m_kk != s.nSpecies() || m_mm != s.nElements()) {
+        m_kk = s.nSpecies();
+        m_mm = s.nElements();
+        m_solver.reset(new ChemEquil(s));
+        m_elemFracs.resize(m_mm);
+        m_work.resize(m_kk);
+        clear();
+    }
+    if (XY != m_XY) {
+        // Stored solutions are only comparable for the same property pair
+        m_XY = XY;
+        clear();
+    }
+    m_clock++;
+
+    // Elemental composition and specified properties of this problem
+    s.getMoleFractions(m_work.data());
+    double sum = 0.0;
+    for (size_t m = 0; m < m_mm; m++) {
+        m_elemFracs[m] = 0.0;
+        for (size_t k = 0; k < m_kk; k++) {
+            m_elemFracs[m] += s.nAtoms(k,m) * m_work[k];
+        }
+        sum += m_elemFracs[m];
+    }
+    scale(m_elemFracs.begin(), m_elemFracs.end(), m_elemFracs.begin(),
+          1.0/sum);
+    double v1, v2;
+    getProperties(s, XY, v1, v2);
+
+    // Find the nearest stored solution
+    size_t inear = npos;
+    double dnear = 0.0;
+    for (size_t i = 0; i < m_entries.size(); i++) {
+        double d = distance(m_entries[i], v1, v2);
+        if (inear == npos || d < dnear) {
+            inear = i;
+            dnear = d;
+        }
+    }
+
+    if (inear != npos && m_retrieveTol > 0.0 &&
+            inRegion(m_entries[inear], v1, v2)) {
+        retrieve(s, m_entries[inear], XY, v1, v2);
+        m_entries[inear].lastUsed = m_clock;
+        m_nRetrieved++;
+        return;
+    }
+
+    vector_fp state;
+    s.saveState(state);
+    bool solved = false;
+    m_solver->options = options;
+    if (inear != npos && dnear <= m_warmDist) {
+        debuglog(fmt::format("EquilCache: warm start from entry {}\n", inear),
+                 loglevel);
+        try {
+            vector_fp elMoles = m_elemFracs;
+            m_solver->options.contin = true;
+            m_solver->setInitialGuess(m_entries[inear].T,
+                                      m_entries[inear].lambda_RT);
+            m_solver->equilibrate(s, XYstr.c_str(), elMoles, false,
+                                  loglevel-1);
+            m_entries[inear].lastUsed = m_clock;
+            m_nWarm++;
+            solved = true;
+        } catch (CanteraError& err) {
+            debuglog("EquilCache: warm start failed\n", loglevel);
+            debuglog(err.what(), loglevel);
+            s.restoreState(state);
+        }
+    }
+
+    if (!solved) {
+        m_nCold++;
+        try {
+            vector_fp elMoles = m_elemFracs;
+            m_solver->options.contin = false;
+            m_solver->equilibrate(s, XYstr.c_str(), elMoles, false,
+                                  loglevel-1);
+        } catch (CanteraError& err) {
+            // The VCS solver does not provide the element potentials, so the
+            // solution is not stored.
+            debuglog("EquilCache: ChemEquil solver failed\n", loglevel);
+            debuglog(err.what(), loglevel);
+            s.restoreState(state);
+            s.equilibrate(XYstr, "vcs", options.relTolerance,
+                          options.maxIterations, 100, 0, loglevel-1);
+            return;
+        }
+    }
+
+    const vector_fp& lambda = m_solver->elementPotentials();
+    if (inear != npos && m_retrieveTol > 0.0) {
+        // If the stored composition would have been accurate enough, grow its
+        // region of accuracy rather than storing a new solution.
+        Entry& e = m_entries[inear];
+        s.getMoleFractions(m_work.data());
+        double err = 0.0;
+        for (size_t k = 0; k < m_kk; k++) {
+            err = std::max(err, fabs(m_work[k] - e.X[k]));
+        }
+        if (err <= m_retrieveTol) {
+            e.radius[0] = std::max(e.radius[0], fabs(v1 - e.v1) / e.scale1);
+            e.radius[1] = std::max(e.radius[1], fabs(log(v2 / e.v2)));
+            for (size_t m = 0; m < m_mm; m++) {
+                e.radius[m+2] = std::max(e.radius[m+2],
+                    fabs(m_elemFracs[m] - e.elemFracs[m]));
+            }
+            e.lastUsed = m_clock;
+            return;
+        }
+    }
+    addEntry(s, v1, v2, lambda);
+}
+
+void EquilCache::getProperties(thermo_t& s, int XY, double& v1,
+                               double& v2) const
+{
+    switch (XY) {
+    case TP:
+        v1 = s.temperature();
+        v2 = s.pressure();
+        break;
+    case TV:
+        v1 = s.temperature();
+        v2 = s.density();
+        break;
+    case HP:
+        v1 = s.enthalpy_mass();
+        v2 = s.pressure();
+        break;
+    case SP:
+        v1 = s.entropy_mass();
+        v2 = s.pressure();
+        break;
+    case SV:
+        v1 = s.entropy_mass();
+        v2 = s.density();
+        break;
+    case UV:
+        v1 = s.intEnergy_mass();
+        v2 = s.density();
+        break;
+    default:
+        throw CanteraError("EquilCache::getProperties",
+                           "illegal property pair.");
+    }
+}
+
+double EquilCache::distance(const Entry& e, double v1, double v2) const
+{
+    double d = fabs(v1 - e.v1) / e.scale1 + fabs(log(v2 / e.v2));
+    for (size_t m = 0; m < m_mm; m++) {
+        d += fabs(m_elemFracs[m] - e.elemFracs[m]);
+    }
+    return d;
+}
+
+bool EquilCache::inRegion(const Entry& e, double v1, double v2) const
+{
+    if (fabs(v1 - e.v1) / e.scale1 > e.radius[0] ||
+        fabs(log(v2 / e.v2)) > e.radius[1]) {
+        return false;
+    }
+    for (size_t m = 0; m < m_mm; m++) {
+        if (fabs(m_elemFracs[m] - e.elemFracs[m]) > e.radius[m+2]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void EquilCache::retrieve(thermo_t& s, const Entry& e, int XY, double v1,
+                          double v2)
+{
+    s.setMoleFractions(e.X.data());
+    switch (XY) {
+    case TP:
+        s.setState_TP(v1, v2);
+        break;
+    case TV:
+        s.setTemperature(v1);
+        s.setDensity(v2);
+        break;
+    case HP:
+        s.setTemperature(e.T);
+        s.setState_HP(v1, v2);
+        break;
+    case SP:
+        s.setTemperature(e.T);
+        s.setState_SP(v1, v2);
+        break;
+    case SV:
+        s.setTemperature(e.T);
+        s.setState_SV(v1, 1.0/v2);
+        break;
+    case UV:
+        s.setTemperature(e.T);
+        s.setState_UV(v1, 1.0/v2);
+        break;
+    }
+    vector_fp lambda(e.lambda_RT);
+    scale(lambda.begin(), lambda.end(), lambda.begin(), s.RT());
+    s.setElementPotentials(lambda);
+}
+
+void EquilCache::addEntry(thermo_t& s, double v1, double v2,
+                          const vector_fp& lambda)
+{
+    size_t i = m_entries.size();
+    if (i < m_maxEntries) {
+        m_entries.push_back(Entry());
+    } else if (m_maxEntries == 0) {
+        return;
+    } else {
+        // replace the least recently used entry
+        i = 0;
+        for (size_t j = 1; j < m_entries.size(); j++) {
+            if (m_entries[j].lastUsed < m_entries[i].lastUsed) {
+                i = j;
+            }
+        }
+    }
+    Entry& e = m_entries[i];
+    e.v1 = v1;
+    e.v2 = v2;
+    e.T = s.temperature();
+    if (m_XY == TP || m_XY == TV) {
+        e.scale1 = e.T;
+    } else if (m_XY == HP || m_XY == UV) {
+        e.scale1 = GasConstant * e.T / s.meanMolecularWeight();
+    } else {
+        e.scale1 = GasConstant / s.meanMolecularWeight();
+    }
+    e.radius.assign(m_mm + 2, m_retrieveRadius);
+    e.lastUsed = m_clock;
+    e.elemFracs = m_elemFracs;
+    e.lambda_RT.resize(m_mm);
+    scale(lambda.begin(), lambda.end(), e.lambda_RT.begin(), 1.0/s.RT());
+    e.X.resize(m_kk);
+    s.getMoleFractions(e.X.data());
+}
+
+}
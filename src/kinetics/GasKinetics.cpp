@@ -10,6 +10,22 @@ using namespace std;
 
 namespace Cantera
 {
+
+namespace {
+
+//! A concentration raised to the power `order`, as in the concentration
+//! products computed by the StoichManagerN classes
+double concPower(double c, double order)
+{
+    if (c > 0.0 || fmod(order, 1.0) == 0.0) {
+        return pow(c, order);
+    } else {
+        return 0.0;
+    }
+}
+
+}
+
 GasKinetics::GasKinetics(thermo_t* thermo) :
     BulkKinetics(thermo),
     m_logp_ref(0.0),
@@ -234,6 +250,129 @@ void GasKinetics::getFwdRateConstants(doublereal* kfwd)
     }
 }
 
+void GasKinetics::getNetProductionRates_ddC(doublereal* ddC)
+{
+    if (m_rxnStoich.size() != nReactions()) {
+        buildDerivativeData();
+    }
+    m_kfwd.resize(nReactions());
+    m_eff.resize(m_kk);
+    getFwdRateConstants(m_kfwd.data());
+    updateROP();
+    fill(ddC, ddC + m_kk*m_kk, 0.0);
+
+    // add the derivative 'drop' of the net rate of progress of reaction i
+    // with respect to the concentration of species m to the derivatives of
+    // the production rates of the species in the reaction
+    auto addRopDerivative = [&](size_t i, size_t m, double drop) {
+        for (const auto& nu : m_rxnStoich[i]) {
+            ddC[nu.first + m*m_kk] += nu.second * drop;
+        }
+    };
+
+    // Mass-action concentration products. m_rkcn is zero for irreversible
+    // reactions.
+    for (size_t i = 0; i < nReactions(); i++) {
+        for (size_t dir = 0; dir < 2; dir++) {
+            double k = (dir == 0) ? m_kfwd[i] : -m_kfwd[i] * m_rkcn[i];
+            if (k == 0.0) {
+                continue;
+            }
+            const auto& orders = m_rxnOrders[2*i + dir];
+            for (size_t n = 0; n < orders.size(); n++) {
+                if (orders[n].second == 0.0) {
+                    continue;
+                }
+                double drop = k;
+                for (size_t l = 0; l < orders.size(); l++) {
+                    double c = m_conc[orders[l].first];
+                    double order = orders[l].second;
+                    if (l == n) {
+                        drop *= order * concPower(c, order - 1.0);
+                    } else {
+                        drop *= concPower(c, order);
+                    }
+                }
+                addRopDerivative(i, orders[n].first, drop);
+            }
+        }
+    }
+
+    // Enhanced third-body concentrations of three-body reactions, which
+    // multiply the rates of progress
+    for (size_t n = 0; n < concm_3b_values.size(); n++) {
+        size_t i = m_3b_concm.reactionIndex(n);
+        if (concm_3b_values[n] == 0.0) {
+            continue;
+        }
+        m_3b_concm.getEfficiencies(n, m_eff.data(), m_kk);
+        double dropdM = m_ropnet[i] / concm_3b_values[n];
+        for (size_t m = 0; m < m_kk; m++) {
+            addRopDerivative(i, m, dropdM * m_eff[m]);
+        }
+    }
+
+    // Enhanced third-body concentrations of falloff reactions. The
+    // logarithmic derivative of the falloff rate constant with respect to
+    // the reduced pressure is found by perturbing the reduced pressure.
+    size_t nfall = m_falloff_low_rates.nReactions();
+    if (nfall) {
+        const double delta = 1.0e-7;
+        m_prWork.resize(2*nfall);
+        double* pr0 = m_prWork.data();
+        double* pr1 = pr0 + nfall;
+        for (size_t n = 0; n < nfall; n++) {
+            pr0[n] = concm_falloff_values[n] * m_rfn_low[n] /
+                     (m_rfn_high[n] + SmallNumber);
+            pr1[n] = pr0[n] * (1.0 + delta);
+        }
+        m_falloffn.pr_to_falloff(pr0, falloff_work.data());
+        m_falloffn.pr_to_falloff(pr1, falloff_work.data());
+        for (size_t n = 0; n < nfall; n++) {
+            size_t i = m_fallindx[n];
+            if (pr0[n] <= 0.0 || pr1[n] <= 0.0 || concm_falloff_values[n] == 0.0) {
+                continue;
+            }
+            m_falloff_concm.getEfficiencies(n, m_eff.data(), m_kk);
+            double dropdM = m_ropnet[i] * log(pr1[n] / pr0[n]) /
+                            log1p(delta) / concm_falloff_values[n];
+            for (size_t m = 0; m < m_kk; m++) {
+                addRopDerivative(i, m, dropdM * m_eff[m]);
+            }
+        }
+    }
+}
+
+void GasKinetics::buildDerivativeData()
+{
+    m_rxnOrders.clear();
+    m_rxnStoich.clear();
+    for (size_t i = 0; i < nReactions(); i++) {
+        const Reaction& r = *m_reactions[i];
+        // The orders are the stoichiometric coefficients unless overridden,
+        // as in Kinetics::addReaction
+        std::map<size_t, double> fwd, rev, net;
+        for (const auto& sp : r.reactants) {
+            size_t k = kineticsSpeciesIndex(sp.first);
+            fwd[k] = sp.second;
+            net[k] -= sp.second;
+        }
+        for (const auto& sp : r.orders) {
+            fwd[kineticsSpeciesIndex(sp.first)] = sp.second;
+        }
+        for (const auto& sp : r.products) {
+            size_t k = kineticsSpeciesIndex(sp.first);
+            if (r.reversible) {
+                rev[k] = sp.second;
+            }
+            net[k] += sp.second;
+        }
+        m_rxnOrders.emplace_back(fwd.begin(), fwd.end());
+        m_rxnOrders.emplace_back(rev.begin(), rev.end());
+        m_rxnStoich.emplace_back(net.begin(), net.end());
+    }
+}
+
 bool GasKinetics::addReaction(shared_ptr<Reaction> r)
 {
     // operations common to all reaction types
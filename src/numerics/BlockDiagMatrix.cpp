@@ -0,0 +1,294 @@
+//! @file BlockDiagMatrix.cpp Block diagonal matrices.
+
+#include "cantera/numerics/BlockDiagMatrix.h"
+#include "cantera/numerics/ctlapack.h"
+
+using namespace std;
+
+namespace Cantera
+{
+
+BlockDiagMatrix::BlockDiagMatrix() :
+    GeneralMatrix(3),
+    m_n(0),
+    m_zero(0.0),
+    m_regularize(false)
+{
+}
+
+BlockDiagMatrix::BlockDiagMatrix(const std::vector<size_t>& blockSizes,
+                                 doublereal v) :
+    GeneralMatrix(3),
+    m_n(0),
+    m_zero(0.0),
+    m_regularize(false)
+{
+    resize(blockSizes, v);
+}
+
+void BlockDiagMatrix::resize(const std::vector<size_t>& blockSizes,
+                             doublereal v)
+{
+    size_t nb = blockSizes.size();
+    m_bsize = blockSizes;
+    m_bstart.resize(nb);
+    m_loc.resize(nb);
+    m_n = 0;
+    size_t nd = 0;
+    for (size_t i = 0; i < nb; i++) {
+        if (m_bsize[i] == 0) {
+            throw CanteraError("BlockDiagMatrix::resize",
+                               "Block {} has zero size", i);
+        }
+        m_bstart[i] = m_n;
+        m_n += m_bsize[i];
+        m_loc[i] = nd;
+        nd += m_bsize[i] * m_bsize[i];
+    }
+
+    m_rowBlock.resize(m_n);
+    for (size_t i = 0; i < nb; i++) {
+        fill(m_rowBlock.begin() + m_bstart[i],
+             m_rowBlock.begin() + m_bstart[i] + m_bsize[i], i);
+    }
+    data.assign(nd, v);
+    ludata.assign(nd, 0.0);
+    m_ipiv.resize(m_n);
+    m_factored = false;
+}
+
+doublereal& BlockDiagMatrix::operator()(size_t i, size_t j)
+{
+    return value(i,j);
+}
+
+doublereal BlockDiagMatrix::operator()(size_t i, size_t j) const
+{
+    return value(i,j);
+}
+
+doublereal& BlockDiagMatrix::value(size_t i, size_t j)
+{
+    m_factored = false;
+    size_t b = m_rowBlock[i];
+    if (m_rowBlock[j] != b) {
+        m_zero = 0.0;
+        return m_zero;
+    }
+    return data[m_loc[b] + (j - m_bstart[b])*m_bsize[b] + i - m_bstart[b]];
+}
+
+doublereal BlockDiagMatrix::value(size_t i, size_t j) const
+{
+    size_t b = m_rowBlock[i];
+    if (m_rowBlock[j] != b) {
+        return 0.0;
+    }
+    return data[m_loc[b] + (j - m_bstart[b])*m_bsize[b] + i - m_bstart[b]];
+}
+
+size_t BlockDiagMatrix::nRows() const
+{
+    return m_n;
+}
+
+size_t BlockDiagMatrix::nRowsAndStruct(size_t* const iStruct) const
+{
+    if (iStruct) {
+        iStruct[0] = nBlocks();
+    }
+    return m_n;
+}
+
+void BlockDiagMatrix::mult(const doublereal* b, doublereal* prod) const
+{
+    for (size_t k = 0; k < nBlocks(); k++) {
+        size_t n = m_bsize[k];
+        const doublereal* a = &data[m_loc[k]];
+        const doublereal* bk = b + m_bstart[k];
+        doublereal* pk = prod + m_bstart[k];
+        for (size_t i = 0; i < n; i++) {
+            double sum = 0.0;
+            for (size_t j = 0; j < n; j++) {
+                sum += a[j*n + i] * bk[j];
+            }
+            pk[i] = sum;
+        }
+    }
+}
+
+void BlockDiagMatrix::leftMult(const doublereal* const b,
+                               doublereal* const prod) const
+{
+    for (size_t k = 0; k < nBlocks(); k++) {
+        size_t n = m_bsize[k];
+        const doublereal* a = &data[m_loc[k]];
+        const doublereal* bk = b + m_bstart[k];
+        doublereal* pk = prod + m_bstart[k];
+        for (size_t j = 0; j < n; j++) {
+            double sum = 0.0;
+            for (size_t i = 0; i < n; i++) {
+                sum += a[j*n + i] * bk[i];
+            }
+            pk[j] = sum;
+        }
+    }
+}
+
+int BlockDiagMatrix::factor()
+{
+    m_factored = false;
+    ludata = data;
+    for (size_t k = 0; k < nBlocks(); k++) {
+        size_t n = m_bsize[k];
+        doublereal* lu = &ludata[m_loc[k]];
+        int info = 0;
+        ct_dgetrf(n, n, lu, n, &m_ipiv[m_bstart[k]], info);
+        if (info > 0 && m_regularize) {
+            // Since the pivot is the element of largest magnitude in the
+            // remaining part of its column, the elements of L below a zero
+            // pivot are also zero.
+            for (size_t i = info - 1; i < n; i++) {
+                if (lu[i*n + i] == 0.0) {
+                    lu[i*n + i] = 1.0;
+                }
+            }
+        } else if (info != 0) {
+            return (info > 0) ? static_cast<int>(m_bstart[k]) + info : info;
+        }
+    }
+    m_factored = true;
+    return 0;
+}
+
+int BlockDiagMatrix::solve(const doublereal* const b, doublereal* const x)
+{
+    copy(b, b + m_n, x);
+    return solve(x);
+}
+
+int BlockDiagMatrix::solve(doublereal* b, size_t nrhs, size_t ldb)
+{
+    int info = 0;
+    if (!m_factored) {
+        info = factor();
+    }
+    if (info != 0) {
+        return info;
+    }
+    if (ldb == 0) {
+        ldb = nRows();
+    }
+    for (size_t k = 0; k < nBlocks(); k++) {
+        size_t n = m_bsize[k];
+        ct_dgetrs(ctlapack::NoTranspose, n, nrhs, &ludata[m_loc[k]], n,
+                  &m_ipiv[m_bstart[k]], b + m_bstart[k], ldb, info);
+        if (info != 0) {
+            return info;
+        }
+    }
+    return 0;
+}
+
+vector_fp::iterator BlockDiagMatrix::begin()
+{
+    m_factored = false;
+    return data.begin();
+}
+
+vector_fp::const_iterator BlockDiagMatrix::begin() const
+{
+    return data.begin();
+}
+
+void BlockDiagMatrix::zero()
+{
+    fill(data.begin(), data.end(), 0.0);
+    m_factored = false;
+}
+
+doublereal BlockDiagMatrix::rcond(doublereal a1norm)
+{
+    throw NotImplementedError("BlockDiagMatrix::rcond");
+}
+
+int BlockDiagMatrix::factorAlgorithm() const
+{
+    return 0;
+}
+
+doublereal BlockDiagMatrix::oneNorm() const
+{
+    double value = 0.0;
+    for (size_t k = 0; k < nBlocks(); k++) {
+        size_t n = m_bsize[k];
+        const doublereal* a = &data[m_loc[k]];
+        for (size_t j = 0; j < n; j++) {
+            double sum = 0.0;
+            for (size_t i = 0; i < n; i++) {
+                sum += std::abs(a[j*n + i]);
+            }
+            value = std::max(sum, value);
+        }
+    }
+    return value;
+}
+
+GeneralMatrix* BlockDiagMatrix::duplMyselfAsGeneralMatrix() const
+{
+    return new BlockDiagMatrix(*this);
+}
+
+doublereal* BlockDiagMatrix::ptrColumn(size_t j)
+{
+    throw NotImplementedError("BlockDiagMatrix::ptrColumn");
+}
+
+doublereal* const* BlockDiagMatrix::colPts()
+{
+    throw NotImplementedError("BlockDiagMatrix::colPts");
+}
+
+size_t BlockDiagMatrix::checkRows(doublereal& valueSmall) const
+{
+    valueSmall = 1.0E300;
+    size_t iSmall = npos;
+    for (size_t i = 0; i < m_n; i++) {
+        size_t b = m_rowBlock[i];
+        double valueS = 0.0;
+        for (size_t j = m_bstart[b]; j < m_bstart[b] + m_bsize[b]; j++) {
+            valueS = std::max(fabs(value(i,j)), valueS);
+        }
+        if (valueS < valueSmall) {
+            iSmall = i;
+            valueSmall = valueS;
+            if (valueSmall == 0.0) {
+                return iSmall;
+            }
+        }
+    }
+    return iSmall;
+}
+
+size_t BlockDiagMatrix::checkColumns(doublereal& valueSmall) const
+{
+    valueSmall = 1.0E300;
+    size_t jSmall = npos;
+    for (size_t j = 0; j < m_n; j++) {
+        size_t b = m_rowBlock[j];
+        double valueS = 0.0;
+        for (size_t i = m_bstart[b]; i < m_bstart[b] + m_bsize[b]; i++) {
+            valueS = std::max(fabs(value(i,j)), valueS);
+        }
+        if (valueS < valueSmall) {
+            jSmall = j;
+            valueSmall = valueS;
+            if (valueSmall == 0.0) {
+                return jSmall;
+            }
+        }
+    }
+    return jSmall;
+}
+
+}
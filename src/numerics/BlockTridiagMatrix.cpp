@@ -0,0 +1,401 @@
+//! @file BlockTridiagMatrix.cpp Block tridiagonal matrices.
+
+#include "cantera/numerics/BlockTridiagMatrix.h"
+#include "cantera/numerics/ctlapack.h"
+
+using namespace std;
+
+namespace Cantera
+{
+
+namespace {
+
+//! Copy the *m* by *n* column-major array *a*, with leading dimension *lda*,
+//! to the array *b*, with leading dimension *ldb*
+void copyBlock(size_t m, size_t n, const doublereal* a, size_t lda,
+               doublereal* b, size_t ldb)
+{
+    for (size_t j = 0; j < n; j++) {
+        copy(a + j*lda, a + j*lda + m, b + j*ldb);
+    }
+}
+
+}
+
+BlockTridiagMatrix::BlockTridiagMatrix() :
+    GeneralMatrix(2),
+    m_n(0),
+    m_zero(0.0)
+{
+}
+
+BlockTridiagMatrix::BlockTridiagMatrix(const std::vector<size_t>& blockSizes,
+                                       doublereal v) :
+    GeneralMatrix(2),
+    m_n(0),
+    m_zero(0.0)
+{
+    resize(blockSizes, v);
+}
+
+void BlockTridiagMatrix::resize(const std::vector<size_t>& blockSizes,
+                                doublereal v)
+{
+    size_t nb = blockSizes.size();
+    m_bsize = blockSizes;
+    m_bstart.resize(nb);
+    m_loc.resize(nb);
+    m_luLoc.resize(nb);
+    m_uLoc.resize(nb);
+    m_n = 0;
+    for (size_t i = 0; i < nb; i++) {
+        if (m_bsize[i] == 0) {
+            throw CanteraError("BlockTridiagMatrix::resize",
+                               "Block {} has zero size", i);
+        }
+        m_bstart[i] = m_n;
+        m_n += m_bsize[i];
+    }
+
+    size_t nd = 0, nlu = 0, nu = 0, nwork = 0;
+    m_rowBlock.resize(m_n);
+    for (size_t i = 0; i < nb; i++) {
+        size_t n = m_bsize[i];
+        size_t n1 = bsize(i+1);
+        size_t n2 = bsize(i+2);
+        fill(m_rowBlock.begin() + m_bstart[i],
+             m_rowBlock.begin() + m_bstart[i] + n, i);
+        m_loc[i] = nd;
+        nd += n * (bsize(i-1) + n + n1);
+        m_luLoc[i] = nlu;
+        nlu += (n + n1) * n;
+        m_uLoc[i] = nu;
+        nu += n * (n1 + n2);
+        nwork = std::max(nwork, (n + n1) * (n1 + n2));
+    }
+    data.assign(nd, v);
+    ludata.assign(nlu, 0.0);
+    udata.assign(nu, 0.0);
+    m_work.resize(nwork);
+    m_ipiv.resize(m_n);
+    m_factored = false;
+}
+
+doublereal& BlockTridiagMatrix::operator()(size_t i, size_t j)
+{
+    return value(i,j);
+}
+
+doublereal BlockTridiagMatrix::operator()(size_t i, size_t j) const
+{
+    return value(i,j);
+}
+
+doublereal& BlockTridiagMatrix::value(size_t i, size_t j)
+{
+    m_factored = false;
+    size_t j0 = firstColumn(i);
+    if (j < j0 || j >= lastColumn(i)) {
+        m_zero = 0.0;
+        return m_zero;
+    }
+    size_t b = m_rowBlock[i];
+    return data[m_loc[b] + (j - j0)*m_bsize[b] + i - m_bstart[b]];
+}
+
+doublereal BlockTridiagMatrix::value(size_t i, size_t j) const
+{
+    size_t j0 = firstColumn(i);
+    if (j < j0 || j >= lastColumn(i)) {
+        return 0.0;
+    }
+    size_t b = m_rowBlock[i];
+    return data[m_loc[b] + (j - j0)*m_bsize[b] + i - m_bstart[b]];
+}
+
+size_t BlockTridiagMatrix::nRows() const
+{
+    return m_n;
+}
+
+size_t BlockTridiagMatrix::nRowsAndStruct(size_t* const iStruct) const
+{
+    if (iStruct) {
+        iStruct[0] = nBlocks();
+    }
+    return m_n;
+}
+
+void BlockTridiagMatrix::mult(const doublereal* b, doublereal* prod) const
+{
+    for (size_t i = 0; i < m_n; i++) {
+        size_t n = m_bsize[m_rowBlock[i]];
+        size_t j0 = firstColumn(i);
+        size_t nc = lastColumn(i) - j0;
+        const doublereal* row = &data[m_loc[m_rowBlock[i]] + i
+                                      - m_bstart[m_rowBlock[i]]];
+        double sum = 0.0;
+        for (size_t k = 0; k < nc; k++) {
+            sum += row[k*n] * b[j0 + k];
+        }
+        prod[i] = sum;
+    }
+}
+
+void BlockTridiagMatrix::leftMult(const doublereal* const b,
+                                  doublereal* const prod) const
+{
+    fill(prod, prod + m_n, 0.0);
+    for (size_t i = 0; i < m_n; i++) {
+        size_t n = m_bsize[m_rowBlock[i]];
+        size_t j0 = firstColumn(i);
+        size_t nc = lastColumn(i) - j0;
+        const doublereal* row = &data[m_loc[m_rowBlock[i]] + i
+                                      - m_bstart[m_rowBlock[i]]];
+        for (size_t k = 0; k < nc; k++) {
+            prod[j0 + k] += row[k*n] * b[i];
+        }
+    }
+}
+
+int BlockTridiagMatrix::factor()
+{
+    m_factored = false;
+    size_t nb = nBlocks();
+    if (nb == 0) {
+        m_factored = true;
+        return 0;
+    }
+
+    // The diagonal and super-diagonal blocks of the first block row
+    size_t n0 = m_bsize[0];
+    copyBlock(n0, n0, &data[m_loc[0]], n0, &ludata[m_luLoc[0]],
+              n0 + bsize(1));
+    copyBlock(n0, bsize(1), &data[m_loc[0] + n0*n0], n0, &udata[m_uLoc[0]],
+              n0);
+
+    // At the start of step b, the reduced diagonal block of block row b is
+    // in the top rows of its factorization array, and the reduced
+    // super-diagonal block is in the first columns of its upper triangular
+    // array.
+    for (size_t b = 0; b < nb; b++) {
+        size_t n = m_bsize[b];
+        size_t n1 = bsize(b+1);
+        size_t n2 = bsize(b+2);
+        size_t ld = n + n1;
+        doublereal* lu = &ludata[m_luLoc[b]];
+        integer* ipiv = &m_ipiv[m_bstart[b]];
+        const doublereal* row = 0;
+        if (n1) {
+            // Sub-diagonal block from block row b+1
+            row = &data[m_loc[b+1]];
+            copyBlock(n1, n, row, n1, lu + n, ld);
+        }
+
+        int info = 0;
+        ct_dgetrf(ld, n, lu, ld, ipiv, info);
+        if (info != 0) {
+            return (info > 0) ? static_cast<int>(m_bstart[b]) + info : info;
+        }
+        if (n1 == 0) {
+            break;
+        }
+
+        // Assemble the remaining columns of block rows b and b+1, and apply
+        // the row interchanges
+        size_t nc = n1 + n2;
+        doublereal* w = m_work.data();
+        doublereal* u = &udata[m_uLoc[b]];
+        for (size_t k = 0; k < nc; k++) {
+            for (size_t i = 0; i < n; i++) {
+                w[k*ld + i] = (k < n1) ? u[k*n + i] : 0.0;
+            }
+        }
+        copyBlock(n1, nc, row + n*n1, n1, w + n, ld);
+        for (size_t i = 0; i < n; i++) {
+            size_t ip = ipiv[i] - 1;
+            if (ip != i) {
+                for (size_t k = 0; k < nc; k++) {
+                    std::swap(w[k*ld + i], w[k*ld + ip]);
+                }
+            }
+        }
+
+        // Rows of the upper triangular factor, and the Schur complement
+        ct_dtrsm(ctlapack::Left, ctlapack::LowerTriangular,
+                 ctlapack::NoTranspose, "U", n, nc, 1.0, lu, ld, w, ld);
+        ct_dgemm(ctlapack::NoTranspose, ctlapack::NoTranspose, n1, nc, n,
+                 -1.0, lu + n, ld, w, ld, 1.0, w + n, ld);
+
+        copyBlock(n, nc, w, ld, u, n);
+        copyBlock(n1, n1, w + n, ld, &ludata[m_luLoc[b+1]], n1 + n2);
+        copyBlock(n1, n2, w + n + n1*ld, ld, &udata[m_uLoc[b+1]], n1);
+    }
+    m_factored = true;
+    return 0;
+}
+
+int BlockTridiagMatrix::solve(const doublereal* const b, doublereal* const x)
+{
+    copy(b, b + m_n, x);
+    return solve(x);
+}
+
+int BlockTridiagMatrix::solve(doublereal* b, size_t nrhs, size_t ldb)
+{
+    int info = 0;
+    if (!m_factored) {
+        info = factor();
+    }
+    if (info != 0) {
+        return info;
+    }
+    if (ldb == 0) {
+        ldb = nRows();
+    }
+    size_t nb = nBlocks();
+
+    // Forward substitution with the row interchanges and the unit lower
+    // triangular factor
+    for (size_t k = 0; k < nb; k++) {
+        size_t n = m_bsize[k];
+        size_t n1 = bsize(k+1);
+        size_t ld = n + n1;
+        const doublereal* lu = &ludata[m_luLoc[k]];
+        const integer* ipiv = &m_ipiv[m_bstart[k]];
+        doublereal* bk = b + m_bstart[k];
+        for (size_t i = 0; i < n; i++) {
+            size_t ip = ipiv[i] - 1;
+            if (ip != i) {
+                for (size_t r = 0; r < nrhs; r++) {
+                    std::swap(bk[r*ldb + i], bk[r*ldb + ip]);
+                }
+            }
+        }
+        ct_dtrsm(ctlapack::Left, ctlapack::LowerTriangular,
+                 ctlapack::NoTranspose, "U", n, nrhs, 1.0, lu, ld, bk, ldb);
+        if (n1) {
+            ct_dgemm(ctlapack::NoTranspose, ctlapack::NoTranspose, n1, nrhs,
+                     n, -1.0, lu + n, ld, bk, ldb, 1.0, bk + n, ldb);
+        }
+    }
+
+    // Back substitution with the upper triangular factor
+    for (size_t k = nb - 1; k != npos; k--) {
+        size_t n = m_bsize[k];
+        size_t n1 = bsize(k+1);
+        size_t ld = n + n1;
+        doublereal* bk = b + m_bstart[k];
+        if (n1) {
+            ct_dgemm(ctlapack::NoTranspose, ctlapack::NoTranspose, n, nrhs,
+                     n1 + bsize(k+2), -1.0, &udata[m_uLoc[k]], n, bk + n, ldb,
+                     1.0, bk, ldb);
+        }
+        ct_dtrsm(ctlapack::Left, ctlapack::UpperTriangular,
+                 ctlapack::NoTranspose, "N", n, nrhs, 1.0,
+                 &ludata[m_luLoc[k]], ld, bk, ldb);
+    }
+    return 0;
+}
+
+vector_fp::iterator BlockTridiagMatrix::begin()
+{
+    m_factored = false;
+    return data.begin();
+}
+
+vector_fp::const_iterator BlockTridiagMatrix::begin() const
+{
+    return data.begin();
+}
+
+void BlockTridiagMatrix::zero()
+{
+    fill(data.begin(), data.end(), 0.0);
+    m_factored = false;
+}
+
+doublereal BlockTridiagMatrix::rcond(doublereal a1norm)
+{
+    throw NotImplementedError("BlockTridiagMatrix::rcond");
+}
+
+int BlockTridiagMatrix::factorAlgorithm() const
+{
+    return 0;
+}
+
+doublereal BlockTridiagMatrix::oneNorm() const
+{
+    vector_fp sum(m_n, 0.0);
+    for (size_t i = 0; i < m_n; i++) {
+        size_t j0 = firstColumn(i);
+        for (size_t j = j0; j < lastColumn(i); j++) {
+            sum[j] += std::abs(value(i,j));
+        }
+    }
+    double value = 0.0;
+    for (size_t j = 0; j < m_n; j++) {
+        value = std::max(sum[j], value);
+    }
+    return value;
+}
+
+GeneralMatrix* BlockTridiagMatrix::duplMyselfAsGeneralMatrix() const
+{
+    return new BlockTridiagMatrix(*this);
+}
+
+doublereal* BlockTridiagMatrix::ptrColumn(size_t j)
+{
+    throw NotImplementedError("BlockTridiagMatrix::ptrColumn");
+}
+
+doublereal* const* BlockTridiagMatrix::colPts()
+{
+    throw NotImplementedError("BlockTridiagMatrix::colPts");
+}
+
+size_t BlockTridiagMatrix::checkRows(doublereal& valueSmall) const
+{
+    valueSmall = 1.0E300;
+    size_t iSmall = npos;
+    for (size_t i = 0; i < m_n; i++) {
+        double valueS = 0.0;
+        for (size_t j = firstColumn(i); j < lastColumn(i); j++) {
+            valueS = std::max(fabs(value(i,j)), valueS);
+        }
+        if (valueS < valueSmall) {
+            iSmall = i;
+            valueSmall = valueS;
+            if (valueSmall == 0.0) {
+                return iSmall;
+            }
+        }
+    }
+    return iSmall;
+}
+
+size_t BlockTridiagMatrix::checkColumns(doublereal& valueSmall) const
+{
+    vector_fp colMax(m_n, 0.0);
+    for (size_t i = 0; i < m_n; i++) {
+        for (size_t j = firstColumn(i); j < lastColumn(i); j++) {
+            colMax[j] = std::max(fabs(value(i,j)), colMax[j]);
+        }
+    }
+    valueSmall = 1.0E300;
+    size_t jSmall = npos;
+    for (size_t j = 0; j < m_n; j++) {
+        if (colMax[j] < valueSmall) {
+            jSmall = j;
+            valueSmall = colMax[j];
+            if (valueSmall == 0.0) {
+                return jSmall;
+            }
+        }
+    }
+    return jSmall;
+}
+
+}
@@ -0,0 +1,396 @@
+//! @file Checkpoint.cpp Implementation file for class CheckpointFile
+
+#include "cantera/oneD/Checkpoint.h"
+#include "cantera/base/ctexceptions.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <fcntl.h>
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace Cantera
+{
+
+namespace { // restrict scope of helper functions to this file
+
+const char CheckpointMagic[] = "CT1DCKPT";
+const uint64_t CheckpointVersion = 1;
+const size_t HeaderSize = 16;
+
+void check_byte_order(const char* method)
+{
+    const uint16_t one = 1;
+    if (*reinterpret_cast<const char*>(&one) != 1) {
+        throw CanteraError(method, "Checkpoint files are only supported on "
+                           "little-endian systems.");
+    }
+}
+
+size_t padded(size_t n)
+{
+    return (n + 7) / 8 * 8;
+}
+
+//! Shorten the file *fname* to *size* bytes
+bool truncate_file(const string& fname, size_t size)
+{
+#ifdef _WIN32
+    int fd = _open(fname.c_str(), _O_WRONLY | _O_BINARY);
+    if (fd < 0) {
+        return false;
+    }
+    bool ok = (_chsize_s(fd, size) == 0);
+    _close(fd);
+    return ok;
+#else
+    return truncate(fname.c_str(), (off_t) size) == 0;
+#endif
+}
+
+//! Serialize the fields of one record
+class RecordWriter
+{
+public:
+    void putInt(uint64_t n) {
+        m_buf.append(reinterpret_cast<const char*>(&n), sizeof(n));
+    }
+
+    void putString(const string& s) {
+        putInt(s.size());
+        m_buf.append(s);
+        m_buf.append(padded(s.size()) - s.size(), '\0');
+    }
+
+    void putArray(const double* x, size_t n) {
+        m_buf.append(reinterpret_cast<const char*>(x), n * sizeof(double));
+    }
+
+    //! Set the length of the record in its first field
+    const string& finish() {
+        uint64_t n = m_buf.size();
+        memcpy(&m_buf[0], &n, sizeof(n));
+        return m_buf;
+    }
+
+private:
+    string m_buf;
+};
+
+//! Read the fields of one record, checking that they are within the record
+class RecordReader
+{
+public:
+    RecordReader(const char* begin, const char* end) : m_pos(begin),
+        m_end(end) {}
+
+    uint64_t getInt() {
+        uint64_t n;
+        memcpy(&n, advance(sizeof(n)), sizeof(n));
+        return n;
+    }
+
+    string getString() {
+        size_t n = getInt();
+        if (n > size_t(m_end - m_pos)) {
+            corrupt();
+        }
+        const char* s = advance(padded(n));
+        return string(s, n);
+    }
+
+    const double* getArray(size_t n) {
+        if (n > size_t(m_end - m_pos) / sizeof(double)) {
+            corrupt();
+        }
+        return reinterpret_cast<const double*>(advance(n * sizeof(double)));
+    }
+
+private:
+    const char* advance(size_t n) {
+        if (n > size_t(m_end - m_pos)) {
+            corrupt();
+        }
+        const char* p = m_pos;
+        m_pos += n;
+        return p;
+    }
+
+    void corrupt() {
+        throw CanteraError("CheckpointFile::parse",
+                           "Checkpoint file is truncated or corrupt.");
+    }
+
+    const char* m_pos;
+    const char* m_end;
+};
+
+} // end unnamed namespace
+
+CheckpointFile::CheckpointFile(const string& fname) :
+    m_data(0),
+    m_size(0)
+{
+    check_byte_order("CheckpointFile::CheckpointFile");
+#ifdef _WIN32
+    ifstream s(fname, ios::binary);
+    if (!s) {
+        throw CanteraError("CheckpointFile::CheckpointFile",
+                           "could not open input file " + fname);
+    }
+    m_buffer.assign(istreambuf_iterator<char>(s), istreambuf_iterator<char>());
+    m_data = m_buffer.data();
+    m_size = m_buffer.size();
+#else
+    int fd = open(fname.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw CanteraError("CheckpointFile::CheckpointFile",
+                           "could not open input file " + fname);
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t) HeaderSize) {
+        close(fd);
+        throw CanteraError("CheckpointFile::CheckpointFile",
+                           "'{}' is not a checkpoint file", fname);
+    }
+    m_size = st.st_size;
+    void* data = mmap(0, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        throw CanteraError("CheckpointFile::CheckpointFile",
+                           "could not map file " + fname);
+    }
+    m_data = static_cast<const char*>(data);
+#endif
+    try {
+        parse();
+    } catch (CanteraError&) {
+#ifndef _WIN32
+        munmap(const_cast<char*>(m_data), m_size);
+#endif
+        throw;
+    }
+}
+
+CheckpointFile::~CheckpointFile()
+{
+#ifndef _WIN32
+    munmap(const_cast<char*>(m_data), m_size);
+#endif
+}
+
+void CheckpointFile::parse()
+{
+    uint64_t version = 0;
+    if (m_size >= HeaderSize) {
+        memcpy(&version, m_data + 8, sizeof(version));
+    }
+    if (m_size < HeaderSize || memcmp(m_data, CheckpointMagic, 8) != 0) {
+        throw CanteraError("CheckpointFile::parse",
+                           "File is not a checkpoint file.");
+    } else if (version != CheckpointVersion) {
+        throw CanteraError("CheckpointFile::parse",
+                           "Unsupported checkpoint file version {}", version);
+    }
+
+    size_t offset = HeaderSize;
+    while (offset < m_size) {
+        RecordReader header(m_data + offset, m_data + m_size);
+        size_t length = header.getInt();
+        if (length < 8 || length > m_size - offset) {
+            throw CanteraError("CheckpointFile::parse",
+                               "Checkpoint file is truncated or corrupt.");
+        }
+        RecordReader r(m_data + offset + 8, m_data + offset + length);
+        CheckpointSolution soln;
+        soln.id = r.getString();
+        soln.description = r.getString();
+        soln.timestamp = r.getString();
+        soln.mechanismHash = r.getInt();
+        size_t nd = r.getInt();
+        for (size_t n = 0; n < nd; n++) {
+            CheckpointDomain d;
+            d.id = r.getString();
+            d.type = static_cast<int>(r.getInt());
+            d.nComponents = r.getInt();
+            d.nPoints = r.getInt();
+            size_t nparams = r.getInt();
+            for (size_t i = 0; i < d.nComponents; i++) {
+                d.componentNames.push_back(r.getString());
+            }
+            for (size_t i = 0; i < nparams; i++) {
+                string name = r.getString();
+                d.parameters[name] = *r.getArray(1);
+            }
+            d.grid = r.getArray(d.nPoints);
+            if (d.nComponents && d.nPoints > size_t(-1) / d.nComponents) {
+                throw CanteraError("CheckpointFile::parse",
+                                   "Checkpoint file is truncated or corrupt.");
+            }
+            d.values = r.getArray(d.nPoints * d.nComponents);
+            soln.domains.push_back(d);
+        }
+        m_solutions.push_back(soln);
+        m_records.emplace_back(offset, length);
+        offset += length;
+    }
+}
+
+vector<string> CheckpointFile::ids() const
+{
+    vector<string> names;
+    for (const auto& soln : m_solutions) {
+        names.push_back(soln.id);
+    }
+    return names;
+}
+
+bool CheckpointFile::hasSolution(const string& id) const
+{
+    for (const auto& soln : m_solutions) {
+        if (soln.id == id) {
+            return true;
+        }
+    }
+    return false;
+}
+
+const CheckpointSolution& CheckpointFile::solution(const string& id) const
+{
+    // If a solution was written more than once, the last one is current
+    for (auto soln = m_solutions.rbegin(); soln != m_solutions.rend(); ++soln) {
+        if (soln->id == id) {
+            return *soln;
+        }
+    }
+    throw CanteraError("CheckpointFile::solution",
+                       "No solution with id = " + id);
+}
+
+void CheckpointFile::write(const string& fname, const CheckpointSolution& soln)
+{
+    check_byte_order("CheckpointFile::write");
+    RecordWriter w;
+    w.putInt(0); // length of the record, set by finish()
+    w.putString(soln.id);
+    w.putString(soln.description);
+    w.putString(soln.timestamp);
+    w.putInt(soln.mechanismHash);
+    w.putInt(soln.domains.size());
+    for (const auto& d : soln.domains) {
+        w.putString(d.id);
+        w.putInt(d.type);
+        w.putInt(d.nComponents);
+        w.putInt(d.nPoints);
+        w.putInt(d.parameters.size());
+        for (size_t i = 0; i < d.nComponents; i++) {
+            w.putString(d.componentNames[i]);
+        }
+        for (const auto& param : d.parameters) {
+            w.putString(param.first);
+            w.putArray(&param.second, 1);
+        }
+        w.putArray(d.grid, d.nPoints);
+        w.putArray(d.values, d.nPoints * d.nComponents);
+    }
+    const string& record = w.finish();
+
+    // A solution with a new id is appended to the file. Replacing a solution
+    // requires rewriting the file, which is done using a temporary file so
+    // that the existing solutions are not lost if writing fails part way
+    // through.
+    size_t oldSize = 0;
+    string kept;
+    if (isCheckpointFile(fname)) {
+        CheckpointFile f(fname);
+        if (f.hasSolution(soln.id)) {
+            kept.assign(f.m_data, HeaderSize);
+            for (size_t i = 0; i < f.m_solutions.size(); i++) {
+                if (f.m_solutions[i].id != soln.id) {
+                    kept.append(f.m_data + f.m_records[i].first,
+                                f.m_records[i].second);
+                }
+            }
+        } else {
+            oldSize = f.m_size;
+        }
+    } else if (ifstream(fname)) {
+        throw CanteraError("CheckpointFile::write", "refusing to overwrite "
+                           "'" + fname + "', which is not a checkpoint file");
+    }
+
+    if (kept.empty()) {
+        ofstream s(fname, ios::binary | ios::app);
+        if (!s) {
+            throw CanteraError("CheckpointFile::write",
+                               "could not open file " + fname);
+        }
+        if (oldSize == 0) {
+            s.write(CheckpointMagic, 8);
+            s.write(reinterpret_cast<const char*>(&CheckpointVersion),
+                    sizeof(CheckpointVersion));
+        }
+        s.write(record.data(), record.size());
+        s.close();
+        if (!s) {
+            // Remove the partial record, or the new file
+            if (oldSize) {
+                truncate_file(fname, oldSize);
+            } else {
+                std::remove(fname.c_str());
+            }
+            throw CanteraError("CheckpointFile::write",
+                               "error writing file " + fname);
+        }
+        return;
+    }
+
+    string tmpname = fname + ".tmp";
+    {
+        ofstream s(tmpname, ios::binary);
+        if (!s) {
+            throw CanteraError("CheckpointFile::write",
+                               "could not open file " + tmpname);
+        }
+        s.write(kept.data(), kept.size());
+        s.write(record.data(), record.size());
+        s.close();
+        if (!s) {
+            std::remove(tmpname.c_str());
+            throw CanteraError("CheckpointFile::write",
+                               "error writing file " + tmpname);
+        }
+    }
+#ifdef _WIN32
+    // rename() does not replace existing files on Windows
+    bool moved = MoveFileExA(tmpname.c_str(), fname.c_str(),
+                             MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+    bool moved = std::rename(tmpname.c_str(), fname.c_str()) == 0;
+#endif
+    if (!moved) {
+        std::remove(tmpname.c_str());
+        throw CanteraError("CheckpointFile::write",
+                           "could not replace file " + fname);
+    }
+}
+
+bool CheckpointFile::isCheckpointFile(const string& fname)
+{
+    ifstream s(fname, ios::binary);
+    char magic[8];
+    return s.read(magic, 8) && memcmp(magic, CheckpointMagic, 8) == 0;
+}
+
+}
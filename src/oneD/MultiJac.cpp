@@ -13,14 +13,20 @@ namespace Cantera
 {
 
 MultiJac::MultiJac(OneDim& r)
-    : BandMatrix(r.size(),r.bandwidth(),r.bandwidth())
+    : GeneralMatrix(1)
 {
     m_size = r.size();
     m_points = r.points();
     m_resid = &r;
+    m_block = r.blockSolver();
+    m_krylov = r.krylovSolver();
+    updateStorage();
     m_r1.resize(m_size);
     m_ssdiag.resize(m_size);
     m_mask.resize(m_size);
+    m_ncolors = 0;
+    m_xsave.resize(m_points);
+    m_dx.resize(m_points);
     m_elapsed = 0.0;
     m_nevals = 0;
     m_age = 100000;
@@ -32,6 +38,46 @@ MultiJac::MultiJac(OneDim& r)
     m_rtol = 1.0e-5;
 }
 
+void MultiJac::setBlockSolver(bool block)
+{
+    if (block != m_block) {
+        m_block = block;
+        updateStorage();
+    }
+}
+
+void MultiJac::setKrylovSolver(bool krylov)
+{
+    if (krylov != m_krylov) {
+        m_krylov = krylov;
+        updateStorage();
+    }
+}
+
+void MultiJac::updateStorage()
+{
+    if (m_krylov || m_block) {
+        std::vector<size_t> sizes(m_points);
+        for (size_t j = 0; j < m_points; j++) {
+            sizes[j] = m_resid->nVars(j);
+        }
+        if (m_krylov) {
+            // The diagonal block for a point may be singular, e.g. if an
+            // unknown only appears in the residuals at a neighboring point
+            BlockDiagMatrix* precon = new BlockDiagMatrix(sizes);
+            precon->setRegularize(true);
+            m_mat.reset(precon);
+        } else {
+            m_mat.reset(new BlockTridiagMatrix(sizes));
+        }
+    } else {
+        m_mat.reset(new BandMatrix(m_size, m_resid->bandwidth(),
+                                   m_resid->bandwidth()));
+    }
+    matrixType_ = m_mat->matrixType_;
+    m_age = 100000;
+}
+
 void MultiJac::updateTransient(doublereal rdt, integer* mask)
 {
     for (size_t n = 0; n < m_size; n++) {
@@ -49,7 +95,41 @@ void MultiJac::eval(doublereal* x0, doublereal* resid0, doublereal rdt)
 {
     m_nevals++;
     clock_t t0 = clock();
-    bfill(0.0);
+    m_mat->zero();
+    for (size_t n = 0; n < m_resid->nDomains(); n++) {
+        m_resid->domain(n).startJacobian(x0);
+    }
+    try {
+        if (m_ncolors) {
+            evalColored(x0, resid0);
+        } else {
+            evalColumns(x0, resid0, rdt);
+        }
+    } catch (...) {
+        // Let the domains restore their normal residual evaluation before
+        // the error propagates, and force the incomplete Jacobian to be
+        // re-evaluated. The perturbed components of x0 have already been
+        // restored.
+        for (size_t n = 0; n < m_resid->nDomains(); n++) {
+            m_resid->domain(n).abortJacobian();
+        }
+        m_age = 100000;
+        throw;
+    }
+    for (size_t n = 0; n < m_resid->nDomains(); n++) {
+        m_resid->domain(n).finishJacobian(x0, *this);
+    }
+
+    for (size_t n = 0; n < m_size; n++) {
+        m_ssdiag[n] = value(n,n);
+    }
+
+    m_elapsed += double(clock() - t0)/CLOCKS_PER_SEC;
+    m_age = 0;
+}
+
+void MultiJac::evalColumns(doublereal* x0, doublereal* resid0, doublereal rdt)
+{
     size_t n, m, ipt=0, j, nv, mv, iloc;
     doublereal rdx, dx, xsave;
 
@@ -64,7 +144,12 @@ void MultiJac::eval(doublereal* x0, doublereal* resid0, doublereal rdt)
             rdx = 1.0/dx;
 
             // calculate perturbed residual
-            m_resid->eval(j, x0, m_r1.data(), rdt, 0);
+            try {
+                m_resid->eval(j, x0, m_r1.data(), rdt, 0);
+            } catch (...) {
+                x0[ipt] = xsave;
+                throw;
+            }
 
             // compute nth column of Jacobian
             for (size_t i = j - 1; i != j+2; i++) {
@@ -80,13 +165,179 @@ void MultiJac::eval(doublereal* x0, doublereal* resid0, doublereal rdt)
             ipt++;
         }
     }
+}
 
-    for (n = 0; n < m_size; n++) {
-        m_ssdiag[n] = value(n,n);
+void MultiJac::evalColored(doublereal* x0, doublereal* resid0)
+{
+    size_t nvmax = 0;
+    for (size_t j = 0; j < m_points; j++) {
+        nvmax = std::max(nvmax, m_resid->nVars(j));
     }
 
-    m_elapsed += double(clock() - t0)/CLOCKS_PER_SEC;
-    m_age = 0;
+    for (size_t c = 0; c < m_ncolors; c++) {
+        for (size_t n = 0; n < nvmax; n++) {
+            // perturb x(n) at every point of color c
+            bool perturbed = false;
+            for (size_t j = c; j < m_points; j += m_ncolors) {
+                if (n < m_resid->nVars(j)) {
+                    size_t ipt = m_resid->loc(j) + n;
+                    m_xsave[j] = x0[ipt];
+                    x0[ipt] = m_xsave[j] + m_atol + fabs(m_xsave[j])*m_rtol;
+                    m_dx[j] = x0[ipt] - m_xsave[j];
+                    perturbed = true;
+                }
+            }
+            if (!perturbed) {
+                continue;
+            }
+
+            // calculate perturbed residual at all points
+            try {
+                m_resid->evalPerturbed(x0, m_r1.data());
+            } catch (...) {
+                for (size_t j = c; j < m_points; j += m_ncolors) {
+                    if (n < m_resid->nVars(j)) {
+                        x0[m_resid->loc(j) + n] = m_xsave[j];
+                    }
+                }
+                throw;
+            }
+
+            // The residual at each point is affected by the perturbation of
+            // at most one point of this color, so the nth column for each
+            // perturbed point is found from the residuals within its domain
+            // of influence.
+            for (size_t j = c; j < m_points; j += m_ncolors) {
+                if (n >= m_resid->nVars(j)) {
+                    continue;
+                }
+                size_t ipt = m_resid->loc(j) + n;
+                doublereal rdx = 1.0/m_dx[j];
+                for (size_t i = j - 1; i != j+2; i++) {
+                    if (i != npos && i < m_points) {
+                        size_t mv = m_resid->nVars(i);
+                        size_t iloc = m_resid->loc(i);
+                        for (size_t m = 0; m < mv; m++) {
+                            value(m+iloc,ipt) =
+                                (m_r1[m+iloc] - resid0[m+iloc])*rdx;
+                        }
+                    }
+                }
+                x0[ipt] = m_xsave[j];
+            }
+        }
+    }
+}
+
+int MultiJac::solve(const doublereal* const b, doublereal* const x)
+{
+    copy(b, b + m_size, x);
+    return m_mat->solve(x);
+}
+
+int MultiJac::solve(doublereal* b, size_t nrhs, size_t ldb)
+{
+    return m_mat->solve(b, nrhs, ldb);
+}
+
+int MultiJac::factor()
+{
+    return m_mat->factor();
+}
+
+bool MultiJac::factored() const
+{
+    return m_mat->factored();
+}
+
+void MultiJac::clearFactorFlag()
+{
+    m_mat->clearFactorFlag();
+}
+
+void MultiJac::zero()
+{
+    m_mat->zero();
+}
+
+doublereal& MultiJac::operator()(size_t i, size_t j)
+{
+    return value(i,j);
+}
+
+doublereal MultiJac::operator()(size_t i, size_t j) const
+{
+    return value(i,j);
+}
+
+void MultiJac::mult(const doublereal* b, doublereal* prod) const
+{
+    m_mat->mult(b, prod);
+}
+
+void MultiJac::leftMult(const doublereal* const b, doublereal* const prod) const
+{
+    m_mat->leftMult(b, prod);
+}
+
+doublereal MultiJac::rcond(doublereal a1norm)
+{
+    return m_mat->rcond(a1norm);
+}
+
+int MultiJac::factorAlgorithm() const
+{
+    return m_mat->factorAlgorithm();
+}
+
+doublereal MultiJac::oneNorm() const
+{
+    return m_mat->oneNorm();
+}
+
+size_t MultiJac::nRows() const
+{
+    return m_mat->nRows();
+}
+
+size_t MultiJac::nRowsAndStruct(size_t* const iStruct) const
+{
+    return m_mat->nRowsAndStruct(iStruct);
+}
+
+vector_fp::iterator MultiJac::begin()
+{
+    return m_mat->begin();
+}
+
+vector_fp::const_iterator MultiJac::begin() const
+{
+    return static_cast<const GeneralMatrix&>(*m_mat).begin();
+}
+
+doublereal* MultiJac::ptrColumn(size_t j)
+{
+    return m_mat->ptrColumn(j);
+}
+
+doublereal* const* MultiJac::colPts()
+{
+    return m_mat->colPts();
+}
+
+size_t MultiJac::checkRows(doublereal& valueSmall) const
+{
+    return m_mat->checkRows(valueSmall);
+}
+
+size_t MultiJac::checkColumns(doublereal& valueSmall) const
+{
+    return m_mat->checkColumns(valueSmall);
+}
+
+GeneralMatrix* MultiJac::duplMyselfAsGeneralMatrix() const
+{
+    return m_mat->duplMyselfAsGeneralMatrix();
 }
 
 } // namespace
@@ -8,6 +8,7 @@
 #include "cantera/base/utilities.h"
 
 #include <ctime>
+#include <limits>
 
 using namespace std;
 
@@ -126,6 +127,27 @@ doublereal norm_square(const doublereal* x,
     return sum;
 }
 
+/**
+ * Compute the error weights \f$ w_n \f$ used by norm_square() for each
+ * solution component of one domain, and store them in the array `ewt`, which
+ * has the same layout as the solution vector `x`.
+ */
+void error_weights(const doublereal* x, Domain1D& r, doublereal* ewt)
+{
+    size_t nv = r.nComponents();
+    size_t np = r.nPoints();
+    for (size_t n = 0; n < nv; n++) {
+        doublereal esum = 0.0;
+        for (size_t j = 0; j < np; j++) {
+            esum += fabs(x[nv*j + n]);
+        }
+        doublereal w = r.rtol(n)*esum/np + r.atol(n);
+        for (size_t j = 0; j < np; j++) {
+            ewt[nv*j + n] = w;
+        }
+    }
+}
+
 } // end unnamed-namespace
 
 
@@ -137,6 +159,13 @@ const size_t NDAMP = 7;
 
 MultiNewton::MultiNewton(int sz)
     : m_maxAge(5)
+    , m_krylovIters(50)
+    , m_krylovTol(1.0e-4)
+    , m_krylovRestarts(10)
+    , m_krylovFailed(false)
+    , m_maxBroyden(0)
+    , m_nBroyden(0)
+    , m_nAvoided(0)
 {
     m_n = sz;
     m_elapsed = 0.0;
@@ -148,6 +177,25 @@ void MultiNewton::resize(size_t sz)
     m_x.resize(m_n);
     m_stp.resize(m_n);
     m_stp1.resize(m_n);
+    m_broydenP.clear();
+    m_broydenQ.clear();
+}
+
+void MultiNewton::setKrylovOptions(size_t maxIters, doublereal rtol,
+                                   size_t maxRestarts)
+{
+    if (maxIters == 0) {
+        throw CanteraError("MultiNewton::setKrylovOptions",
+                           "Maximum number of iterations must be positive");
+    }
+    if (rtol <= 0.0 || rtol >= 1.0) {
+        throw CanteraError("MultiNewton::setKrylovOptions",
+                           "Relative tolerance must be between 0 and 1; got {}",
+                           rtol);
+    }
+    m_krylovIters = maxIters;
+    m_krylovTol = rtol;
+    m_krylovRestarts = maxRestarts;
 }
 
 doublereal MultiNewton::norm2(const doublereal* x,
@@ -174,7 +222,15 @@ void MultiNewton::step(doublereal* x, doublereal* step,
         step[n] = -step[n];
     }
 
-    iok = jac.solve(step, step);
+    if (jac.krylovSolver()) {
+        iok = solveKrylov(x, step, r, jac, loglevel);
+    } else {
+        iok = jac.solve(step, step);
+        m_krylovFailed = false;
+        if (iok == 0) {
+            applyBroydenUpdates(step);
+        }
+    }
     // if iok is non-zero, then solve failed
     if (iok != 0) {
         iok--;
@@ -189,15 +245,269 @@ void MultiNewton::step(doublereal* x, doublereal* step,
         size_t offset = iok - r.start(n);
         size_t pt = offset/dom.nComponents();
         size_t comp = offset - pt*dom.nComponents();
+        // The banded solver writes the matrix to a file for debugging
+        string note = (jac.blockSolver() || jac.krylovSolver()) ?
+                      "" : "see file bandmatrix.csv\n";
         throw CanteraError("MultiNewton::step",
             "Jacobian is singular for domain {}, component {} at point {}\n"
-            "(Matrix row {}) \nsee file bandmatrix.csv\n",
-            dom.id(), dom.componentName(comp), pt, iok);
+            "(Matrix row {}) \n{}",
+            dom.id(), dom.componentName(comp), pt, iok, note);
     } else if (int(iok) < 0) {
         throw CanteraError("MultiNewton::step", "iok = {}", iok);
     }
 }
 
+int MultiNewton::solveKrylov(const doublereal* x, doublereal* b, OneDim& r,
+                             MultiJac& jac, int loglevel)
+{
+    size_t n = m_n;
+    size_t mmax = m_krylovIters;
+    m_basis.resize((mmax+1)*n);
+    m_ewt.resize(n);
+    m_f0.resize(n);
+    m_xp.resize(n);
+    m_fp.resize(n);
+
+    for (size_t i = 0; i < r.nDomains(); i++) {
+        error_weights(x + r.start(i), r.domain(i), &m_ewt[r.start(i)]);
+    }
+    for (size_t k = 0; k < n; k++) {
+        m_f0[k] = -b[k];
+    }
+
+    // Increment used for the difference approximation of the Jacobian-vector
+    // products. Since the vectors are scaled by the error weights and
+    // normalized, this is relative to the norm of the scaled solution.
+    doublereal xnorm = 0.0;
+    for (size_t k = 0; k < n; k++) {
+        xnorm += pow(x[k]/m_ewt[k], 2);
+    }
+    doublereal sigma = sqrt(std::numeric_limits<double>::epsilon())
+                       * std::max(sqrt(xnorm), 1.0);
+
+    // Compute w = W^-1 M^-1 J W v for the scaled vector v with unit norm,
+    // where W is the diagonal matrix of error weights and M is the
+    // preconditioner.
+    auto precJv = [&](const doublereal* v, doublereal* w) {
+        for (size_t k = 0; k < n; k++) {
+            m_xp[k] = x[k] + sigma*m_ewt[k]*v[k];
+        }
+        r.eval(npos, &m_xp[0], &m_fp[0]);
+        for (size_t k = 0; k < n; k++) {
+            w[k] = (m_fp[k] - m_f0[k])/sigma;
+        }
+        int info = jac.solve(w, w);
+        for (size_t k = 0; k < n; k++) {
+            w[k] /= m_ewt[k];
+        }
+        return info;
+    };
+
+    // Upper Hessenberg matrix (column-major, leading dimension mmax+1), its
+    // Givens rotations, and the right-hand side of the least squares problem
+    vector_fp h((mmax+1)*mmax);
+    vector_fp cs(mmax), sn(mmax), g(mmax+1);
+
+    // The solution is accumulated in terms of the scaled step y = W^-1 s
+    vector_fp& y = m_y;
+    y.assign(n, 0.0);
+    doublereal beta0 = 0.0, resid = 0.0;
+    size_t iters = 0;
+    m_krylovFailed = true;
+    for (size_t cycle = 0; cycle <= m_krylovRestarts; cycle++) {
+        // Residual of the preconditioned system for the current solution
+        doublereal* v = &m_basis[0];
+        int info = jac.solve(b, v);
+        if (info != 0) {
+            return info;
+        }
+        for (size_t k = 0; k < n; k++) {
+            v[k] /= m_ewt[k];
+        }
+        doublereal ynorm = 0.0;
+        for (size_t k = 0; k < n; k++) {
+            ynorm += y[k]*y[k];
+        }
+        ynorm = sqrt(ynorm);
+        if (ynorm > 0.0) {
+            doublereal* w = &m_basis[n];
+            for (size_t k = 0; k < n; k++) {
+                w[k] = y[k]/ynorm;
+            }
+            info = precJv(w, w);
+            if (info != 0) {
+                return info;
+            }
+            for (size_t k = 0; k < n; k++) {
+                v[k] -= ynorm*w[k];
+            }
+        }
+        doublereal beta = 0.0;
+        for (size_t k = 0; k < n; k++) {
+            beta += v[k]*v[k];
+        }
+        beta = sqrt(beta);
+        if (cycle == 0) {
+            beta0 = beta;
+        }
+        resid = beta;
+        if (beta <= m_krylovTol*beta0) {
+            m_krylovFailed = false;
+            break;
+        }
+        for (size_t k = 0; k < n; k++) {
+            v[k] /= beta;
+        }
+        std::fill(h.begin(), h.end(), 0.0);
+        std::fill(g.begin(), g.end(), 0.0);
+        g[0] = beta;
+
+        size_t m = 0;
+        while (m < mmax && resid > m_krylovTol*beta0) {
+            doublereal* w = &m_basis[(m+1)*n];
+            doublereal* hm = &h[m*(mmax+1)];
+            info = precJv(&m_basis[m*n], w);
+            if (info != 0) {
+                return info;
+            }
+            iters++;
+
+            // modified Gram-Schmidt orthogonalization
+            for (size_t i = 0; i <= m; i++) {
+                const doublereal* vi = &m_basis[i*n];
+                doublereal dot = 0.0;
+                for (size_t k = 0; k < n; k++) {
+                    dot += vi[k]*w[k];
+                }
+                hm[i] = dot;
+                for (size_t k = 0; k < n; k++) {
+                    w[k] -= dot*vi[k];
+                }
+            }
+            doublereal wnorm = 0.0;
+            for (size_t k = 0; k < n; k++) {
+                wnorm += w[k]*w[k];
+            }
+            hm[m+1] = sqrt(wnorm);
+            if (hm[m+1] > 0.0) {
+                for (size_t k = 0; k < n; k++) {
+                    w[k] /= hm[m+1];
+                }
+            }
+
+            // Apply the previous rotations to the new column, then eliminate
+            // the subdiagonal element
+            for (size_t i = 0; i < m; i++) {
+                doublereal t = cs[i]*hm[i] + sn[i]*hm[i+1];
+                hm[i+1] = -sn[i]*hm[i] + cs[i]*hm[i+1];
+                hm[i] = t;
+            }
+            doublereal d = hypot(hm[m], hm[m+1]);
+            if (d == 0.0) {
+                break;
+            }
+            cs[m] = hm[m]/d;
+            sn[m] = hm[m+1]/d;
+            hm[m] = d;
+            hm[m+1] = 0.0;
+            g[m+1] = -sn[m]*g[m];
+            g[m] *= cs[m];
+            resid = fabs(g[m+1]);
+            m++;
+            if (wnorm == 0.0) {
+                // The solution lies in the current subspace
+                break;
+            }
+        }
+
+        // Solve the triangular least squares system, and update the solution
+        // with a combination of the basis vectors.
+        for (size_t i = m; i-- > 0;) {
+            for (size_t j = i + 1; j < m; j++) {
+                g[i] -= h[j*(mmax+1) + i]*g[j];
+            }
+            g[i] /= h[i*(mmax+1) + i];
+        }
+        for (size_t i = 0; i < m; i++) {
+            const doublereal* vi = &m_basis[i*n];
+            for (size_t k = 0; k < n; k++) {
+                y[k] += g[i]*vi[k];
+            }
+        }
+        if (resid <= m_krylovTol*beta0) {
+            m_krylovFailed = false;
+            break;
+        }
+    }
+
+    for (size_t k = 0; k < n; k++) {
+        b[k] = m_ewt[k]*y[k];
+    }
+    if (loglevel > 0) {
+        writelog("\nKrylov solver: {:d} iterations, residual reduction {:10.3e}",
+                 iters, (beta0 > 0.0) ? resid/beta0 : 0.0);
+    }
+    return 0;
+}
+
+void MultiNewton::addBroydenUpdate(const doublereal* x0,
+                                   const doublereal* step0,
+                                   const doublereal* x1, doublereal* step1,
+                                   OneDim& r)
+{
+    // With H = J^-1, the steps are step0 = -H F(x0) and step1 = -H F(x1), so
+    // H (F(x1) - F(x0)) = step0 - step1, and no additional solves are needed.
+    // The rank-one update H' = H + (s - H y) q^T / (q^T H y) with
+    // q = W^-2 s satisfies the secant condition H' y = s, where
+    // s = x1 - x0 and y = F(x1) - F(x0).
+    m_ewt.resize(m_n);
+    for (size_t i = 0; i < r.nDomains(); i++) {
+        error_weights(x0 + r.start(i), r.domain(i), &m_ewt[r.start(i)]);
+    }
+    vector_fp p(m_n), q(m_n);
+    doublereal denom = 0.0, snorm = 0.0;
+    for (size_t k = 0; k < m_n; k++) {
+        doublereal s = x1[k] - x0[k];
+        doublereal hy = step0[k] - step1[k];
+        q[k] = s/(m_ewt[k]*m_ewt[k]);
+        p[k] = s - hy;
+        denom += q[k]*hy;
+        snorm += q[k]*s;
+    }
+    // If the current Jacobian predicts the change in the residual poorly,
+    // the update would be large, and evaluating a new Jacobian is more
+    // reliable.
+    if (!(denom > 0.5*snorm && denom < 2.0*snorm)) {
+        return;
+    }
+    doublereal qs = 0.0;
+    for (size_t k = 0; k < m_n; k++) {
+        p[k] /= denom;
+        qs += q[k]*step1[k];
+    }
+    for (size_t k = 0; k < m_n; k++) {
+        step1[k] += qs*p[k];
+    }
+    m_broydenP.push_back(std::move(p));
+    m_broydenQ.push_back(std::move(q));
+    m_nBroyden++;
+}
+
+void MultiNewton::applyBroydenUpdates(doublereal* step) const
+{
+    for (size_t i = 0; i < m_broydenP.size(); i++) {
+        const vector_fp& p = m_broydenP[i];
+        const vector_fp& q = m_broydenQ[i];
+        doublereal qs = 0.0;
+        for (size_t k = 0; k < m_n; k++) {
+            qs += q[k]*step[k];
+        }
+        for (size_t k = 0; k < m_n; k++) {
+            step[k] += qs*p[k];
+        }
+    }
+}
+
 doublereal MultiNewton::boundStep(const doublereal* x0,
                                   const doublereal* step0, const OneDim& r, int loglevel)
 {
@@ -256,6 +566,15 @@ int MultiNewton::dampStep(const doublereal* x0, const doublereal* step0,
         // compute the next undamped step that would result if x1 is accepted
         step(x1, step1, r, jac, loglevel-1);
 
+        // The Krylov solver did not converge, so the size of the step cannot
+        // be used to judge the damped step. Treat this like a failure to find
+        // a damping coefficient, which leads to a new preconditioner or time
+        // stepping.
+        if (m_krylovFailed) {
+            debuglog("\nKrylov solver did not converge.\n", loglevel);
+            return -2;
+        }
+
         // compute the weighted norm of step1
         s1 = norm2(x1, step1, r);
 
@@ -307,13 +626,28 @@ int MultiNewton::solve(doublereal* x0, doublereal* x1,
     int j0 = jac.nEvals();
     int nJacReeval = 0;
 
+    // true if m_stp1 holds the undamped step for m_x with the current Jacobian
+    bool haveStep = false;
+
+    // Broyden updates are relative to the Jacobian used by the previous call
+    m_broydenP.clear();
+    m_broydenQ.clear();
+    bool broyden = (m_maxBroyden > 0 && !jac.krylovSolver());
+    int maxAge = m_maxAge;
+
     while (true) {
         // Check whether the Jacobian should be re-evaluated.
-        if (jac.age() > m_maxAge) {
-            if (loglevel > 0) {
-                writelog("\nMaximum Jacobian age reached ({})\n", m_maxAge);
+        if (jac.age() > maxAge) {
+            if (!m_broydenP.empty() && m_broydenP.size() < m_maxBroyden) {
+                // The Jacobian has been kept up to date by Broyden updates
+                maxAge += m_maxAge;
+                m_nAvoided++;
+            } else {
+                if (loglevel > 0) {
+                    writelog("\nMaximum Jacobian age reached ({})\n", m_maxAge);
+                }
+                forceNewJac = true;
             }
-            forceNewJac = true;
         }
 
         if (forceNewJac) {
@@ -321,16 +655,30 @@ int MultiNewton::solve(doublereal* x0, doublereal* x1,
             jac.eval(&m_x[0], &m_stp[0], 0.0);
             jac.updateTransient(rdt, r.transientMask().data());
             forceNewJac = false;
+            haveStep = false;
+            m_broydenP.clear();
+            m_broydenQ.clear();
+            maxAge = m_maxAge;
         }
 
-        // compute the undamped Newton step
-        step(&m_x[0], &m_stp[0], r, jac, loglevel-1);
+        // compute the undamped Newton step, unless dampStep() already did
+        if (haveStep) {
+            copy(m_stp1.begin(), m_stp1.end(), m_stp.begin());
+        } else {
+            step(&m_x[0], &m_stp[0], r, jac, loglevel-1);
+        }
 
         // increment the Jacobian age
         jac.incrementAge();
 
         // damp the Newton step
-        m = dampStep(&m_x[0], &m_stp[0], x1, &m_stp1[0], s1, r, jac, loglevel-1, frst);
+        if (m_krylovFailed) {
+            // see dampStep()
+            m = -2;
+        } else {
+            m = dampStep(&m_x[0], &m_stp[0], x1, &m_stp1[0], s1, r, jac,
+                         loglevel-1, frst);
+        }
         if (loglevel == 1 && m >= 0) {
             if (frst) {
                 writelog("\n\n    {:>10s}    {:>10s}   {:>5s}",
@@ -346,7 +694,11 @@ int MultiNewton::solve(doublereal* x0, doublereal* x1,
         // Successful step, but not converged yet. Take the damped step, and try
         // again.
         if (m == 0) {
+            if (broyden && m_broydenP.size() < m_maxBroyden) {
+                addBroydenUpdate(&m_x[0], &m_stp[0], x1, &m_stp1[0], r);
+            }
             copy(x1, x1 + m_n, m_x.begin());
+            haveStep = true;
         } else if (m == 1) {
             // convergence
             jac.setAge(0); // for efficient sensitivity analysis
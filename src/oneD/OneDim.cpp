@@ -17,8 +17,11 @@ OneDim::OneDim()
       m_rdt(0.0), m_jac_ok(false),
       m_bw(0), m_size(0),
       m_init(false), m_pts(0), m_solve_time(0.0),
-      m_ss_jac_age(10), m_ts_jac_age(20),
-      m_interrupt(0), m_nevals(0), m_evaltime(0.0)
+      m_ss_jac_age(10), m_ts_jac_age(20), m_jac_colors(0),
+      m_jac_block(false), m_jac_krylov(false),
+      m_ts_adaptive(false), m_ts_errtol(1.0e5), m_ts_ssreduction(0.1),
+      m_ts_maxsteps(100),
+      m_interrupt(0), m_holdStats(false), m_nevals(0), m_evaltime(0.0)
 {
     m_newt.reset(new MultiNewton(1));
 }
@@ -28,8 +31,11 @@ OneDim::OneDim(vector<Domain1D*> domains) :
     m_rdt(0.0), m_jac_ok(false),
     m_bw(0), m_size(0),
     m_init(false), m_solve_time(0.0),
-    m_ss_jac_age(10), m_ts_jac_age(20),
-    m_interrupt(0), m_nevals(0), m_evaltime(0.0)
+    m_ss_jac_age(10), m_ts_jac_age(20), m_jac_colors(0),
+    m_jac_block(false), m_jac_krylov(false),
+    m_ts_adaptive(false), m_ts_errtol(1.0e5), m_ts_ssreduction(0.1),
+    m_ts_maxsteps(100),
+    m_interrupt(0), m_holdStats(false), m_nevals(0), m_evaltime(0.0)
 {
     // create a Newton iterator, and add each domain.
     m_newt.reset(new MultiNewton(1));
@@ -100,11 +106,18 @@ void OneDim::writeStats(int printTime)
                      m_gridpts[i], m_funcEvals[i], m_jacEvals[i]);
         }
     }
+    if (m_newt->broydenUpdates()) {
+        writelog("\n Grid   Broyden updates   Jacobians avoided\n");
+        for (size_t i = 0; i < n; i++) {
+            writelog("{:5d}       {:5d}             {:5d}\n",
+                     m_gridpts[i], m_broydenUpdates[i], m_jacAvoided[i]);
+        }
+    }
 }
 
 void OneDim::saveStats()
 {
-    if (m_jac) {
+    if (m_jac && !m_holdStats) {
         int nev = m_jac->nEvals();
         if (nev > 0 && m_nevals > 0) {
             m_gridpts.push_back(m_pts);
@@ -114,6 +127,9 @@ void OneDim::saveStats()
             m_nevals = 0;
             m_funcElapsed.push_back(m_evaltime);
             m_evaltime = 0.0;
+            m_broydenUpdates.push_back(m_newt->nBroydenUpdates());
+            m_jacAvoided.push_back(m_newt->nJacobiansAvoided());
+            m_newt->clearStats();
         }
     }
 }
@@ -125,8 +141,11 @@ void OneDim::clearStats()
     m_jacElapsed.clear();
     m_funcEvals.clear();
     m_funcElapsed.clear();
+    m_broydenUpdates.clear();
+    m_jacAvoided.clear();
     m_nevals = 0;
     m_evaltime = 0.0;
+    m_newt->clearStats();
 }
 
 void OneDim::resize()
@@ -178,6 +197,7 @@ void OneDim::resize()
 
     // delete the current Jacobian evaluator and create a new one
     m_jac.reset(new MultiJac(*this));
+    m_jac->setColors(m_jac_colors);
     m_jac_ok = false;
 
     for (size_t i = 0; i < nDomains(); i++) {
@@ -248,6 +268,93 @@ void OneDim::eval(size_t j, double* x, double* r, doublereal rdt, int count)
     }
 }
 
+void OneDim::evalPerturbed(double* x, double* r)
+{
+    fill(r, r + m_size, 0.0);
+    fill(m_mask.begin(), m_mask.end(), 0);
+
+    // bulk domains first, since the connector domains modify the residuals
+    // at the adjacent boundary points
+    for (const auto& d : m_bulk) {
+        d->evalPerturbed(x, r, m_mask.data());
+    }
+    for (const auto& d : m_connect) {
+        d->evalPerturbed(x, r, m_mask.data());
+    }
+}
+
+void OneDim::setJacobianColors(size_t ncolors)
+{
+    if (ncolors == 1 || ncolors == 2) {
+        throw CanteraError("OneDim::setJacobianColors",
+                           "At least 3 colors are required, got {}", ncolors);
+    }
+    m_jac_colors = ncolors;
+    if (m_jac) {
+        m_jac->setColors(ncolors);
+    }
+}
+
+void OneDim::setBlockSolver(bool block)
+{
+    m_jac_block = block;
+    if (m_jac && m_jac->blockSolver() != block) {
+        m_jac->setBlockSolver(block);
+        m_jac_ok = false;
+    }
+}
+
+void OneDim::setKrylovSolver(bool krylov)
+{
+    m_jac_krylov = krylov;
+    if (m_jac && m_jac->krylovSolver() != krylov) {
+        m_jac->setKrylovSolver(krylov);
+        m_jac_ok = false;
+    }
+}
+
+void OneDim::setBroydenUpdates(size_t maxUpdates)
+{
+    m_newt->setBroydenUpdates(maxUpdates);
+}
+
+void OneDim::setAdaptiveTimeStepping(bool adaptive, double errtol,
+                                     double ssreduction, int maxsteps)
+{
+    if (errtol <= 0.0) {
+        throw CanteraError("OneDim::setAdaptiveTimeStepping",
+                           "'errtol' must be positive ({} was specified).",
+                           errtol);
+    } else if (ssreduction <= 0.0 || ssreduction >= 1.0) {
+        throw CanteraError("OneDim::setAdaptiveTimeStepping",
+            "'ssreduction' must be between 0.0 and 1.0 ({} was specified).",
+            ssreduction);
+    } else if (maxsteps < 1) {
+        throw CanteraError("OneDim::setAdaptiveTimeStepping",
+                           "'maxsteps' must be positive ({} was specified).",
+                           maxsteps);
+    }
+    m_ts_adaptive = adaptive;
+    m_ts_errtol = errtol;
+    m_ts_ssreduction = ssreduction;
+    m_ts_maxsteps = maxsteps;
+}
+
+void OneDim::setNumThreads(size_t nThreads)
+{
+    if (nThreads == 0) {
+        throw CanteraError("OneDim::setNumThreads",
+                           "The number of threads must be positive");
+    }
+    if (nThreads == numThreads()) {
+        return;
+    } else if (nThreads == 1) {
+        m_pool.reset();
+    } else {
+        m_pool.reset(new ThreadPool(nThreads));
+    }
+}
+
 doublereal OneDim::ssnorm(doublereal* x, doublereal* r)
 {
     eval(npos, x, r, 0.0, 0);
@@ -305,6 +412,10 @@ void OneDim::init()
 doublereal OneDim::timeStep(int nsteps, doublereal dt, doublereal* x,
                             doublereal* r, int loglevel)
 {
+    if (m_ts_adaptive) {
+        return adaptiveTimeStep(dt, x, r, loglevel);
+    }
+
     // set the Jacobian age parameter to the transient value
     newton().setOptions(m_ts_jac_age);
 
@@ -355,6 +466,121 @@ doublereal OneDim::timeStep(int nsteps, doublereal dt, doublereal* x,
     return dt;
 }
 
+double OneDim::adaptiveTimeStep(double dt, double* x, double* r, int loglevel)
+{
+    newton().setOptions(m_ts_jac_age);
+
+    debuglog("\n\n step    size (s)    log10(ss) \n", loglevel);
+    debuglog("===============================\n", loglevel);
+
+    // solutions at the two previous steps, the values used in place of the
+    // previous solution by the Backward Euler form of the transient terms,
+    // and the estimated local error
+    vector_fp x1(x, x + m_size), x2(m_size), xhat(m_size), err(m_size);
+    double dt1 = 0.0, dt2 = 0.0; // sizes of the two previous steps
+    double ss0 = ssnorm(x, r);
+    double ss = ss0;
+
+    int n = 0;
+    while (n < m_ts_maxsteps) {
+        if (loglevel > 0) {
+            writelog(" {:>4d}  {:10.4g}  {:10.4g}", n, dt, log10(ss));
+        }
+
+        // The BDF2 approximation of the time derivative with w = dt/dt1,
+        // [(1+2w) x - (1+w)^2 x_n + w^2 x_n-1] / ((1+w) dt), has the form
+        // (x - xhat)/h used by the domains, with the effective step size
+        // h = (1+w) dt / (1+2w). The first step (w = 0) is Backward Euler.
+        double w = (dt1 > 0.0) ? dt / dt1 : 0.0;
+        double a0 = (1 + 2*w) / ((1 + w)*dt);
+        for (size_t i = 0; i < m_size; i++) {
+            xhat[i] = ((1 + w)*(1 + w)*x[i] - w*w*x1[i]) / (1 + 2*w);
+        }
+        initTimeInteg(1.0/a0, xhat.data());
+
+        int m = solve(x, r, loglevel-1);
+        if (m < 0) {
+            // No solution could be found with this time step.
+            // Decrease the stepsize and try again.
+            debuglog("...failure.\n", loglevel);
+            dt *= m_tfactor;
+            if (dt < m_tmin) {
+                throw CanteraError("OneDim::adaptiveTimeStep",
+                                   "Time integration failed.");
+            }
+            continue;
+        }
+
+        // Once the solution at three previous steps is available, estimate
+        // the local error from the difference between the new solution and
+        // the quadratic extrapolation of the previous solutions. Both differ
+        // from the exact solution by multiples of x''', which are evaluated
+        // for x''' = 1 to find the part of the difference due to the error of
+        // the BDF2 step.
+        double errfactor = 4.0;
+        if (dt2 > 0.0) {
+            double t1 = -dt1, t2 = -dt1 - dt2;
+            double L0 = (dt - t1)*(dt - t2) / (t1*t2);
+            double L1 = dt*(dt - t2) / (t1*(t1 - t2));
+            double L2 = dt*(dt - t1) / (t2*(t2 - t1));
+            double epred = dt*(dt - t1)*(dt - t2) / 6.0;
+            double a2 = w*w / ((1 + w)*dt);
+            double ebdf = -((a0*dt*dt*dt + a2*t1*t1*t1) / 6.0 - 0.5*dt*dt) / a0;
+            double c = ebdf / (ebdf + epred);
+            for (size_t i = 0; i < m_size; i++) {
+                err[i] = c*(r[i] - L0*x[i] - L1*x1[i] - L2*x2[i]);
+            }
+            double errnorm = newton().norm2(r, err.data(), *this) / m_ts_errtol;
+            errfactor = 0.9 * pow(std::max(errnorm, 1e-6), -1.0/3.0);
+            if (errnorm > 1.0) {
+                debuglog("...error test failed.\n", loglevel);
+                dt *= std::max(errfactor, 0.2);
+                if (dt < m_tmin) {
+                    throw CanteraError("OneDim::adaptiveTimeStep",
+                                       "Time integration failed.");
+                }
+                continue;
+            }
+        }
+
+        // Accept the step
+        n += 1;
+        debuglog("\n", loglevel);
+        x2.swap(x1);
+        copy(x, x + m_size, x1.begin());
+        copy(r, r + m_size, x);
+        dt2 = dt1;
+        dt1 = dt;
+
+        // Switched evolution relaxation: increase the step size in
+        // proportion to the reduction in the steady-state residual, within
+        // the limit set by the error estimate. As in the Backward Euler
+        // method, the step size is increased by at least a factor of 1.5 if
+        // the step did not require a new Jacobian, even while the residual
+        // grows, as it often does while the solution moves away from a poor
+        // initial estimate. Otherwise, it is not increased, and is decreased
+        // by at most a factor of 2 if the residual grows.
+        double sslast = ss;
+        ss = ssnorm(x, r);
+        if (ss < m_ts_ssreduction * ss0) {
+            break;
+        }
+        double factor = sslast / std::max(ss, Tiny);
+        if (m == 100) {
+            factor = std::max(factor, 1.5);
+        } else {
+            factor = clip(factor, 0.5, 1.0);
+        }
+        dt *= std::min(std::min(factor, errfactor), 4.0);
+        dt = std::min(dt, m_tmax);
+    }
+
+    // Prepare to solve the steady problem.
+    setSteadyMode();
+    newton().setOptions(m_ss_jac_age);
+    return dt;
+}
+
 void OneDim::save(const std::string& fname, std::string id,
                   const std::string& desc, doublereal* sol,
                   int loglevel)
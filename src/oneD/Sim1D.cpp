@@ -3,11 +3,16 @@
  */
 
 #include "cantera/oneD/Sim1D.h"
+#include "cantera/oneD/Checkpoint.h"
+#include "cantera/oneD/Inlet1D.h"
 #include "cantera/oneD/MultiJac.h"
+#include "cantera/oneD/MultiNewton.h"
 #include "cantera/oneD/StFlow.h"
 #include "cantera/numerics/funcs.h"
+#include "cantera/numerics/Func1.h"
 #include "cantera/base/xml.h"
 
+#include <ctime>
 #include <fstream>
 
 using namespace std;
@@ -15,6 +20,25 @@ using namespace std;
 namespace Cantera
 {
 
+namespace { // restrict scope of helper functions to this file
+
+//! Return true if solutions should be saved to *fname* as a checkpoint file
+bool is_checkpoint_name(const std::string& fname)
+{
+    return fname.size() > 4 && fname.compare(fname.size() - 4, 4, ".bin") == 0;
+}
+
+//! Update the 64-bit FNV-1a hash *h* with the characters of *s*
+void hash_string(uint64_t& h, const std::string& s)
+{
+    for (unsigned char c : s) {
+        h = (h ^ c) * 1099511628211ULL;
+    }
+    h = (h ^ 0xff) * 1099511628211ULL;
+}
+
+} // end unnamed namespace
+
 Sim1D::Sim1D(vector<Domain1D*>& domains) :
     OneDim(domains)
 {
@@ -86,7 +110,14 @@ void Sim1D::setProfile(size_t dom, size_t comp,
 void Sim1D::save(const std::string& fname, const std::string& id,
                  const std::string& desc, int loglevel)
 {
-    OneDim::save(fname, id, desc, m_x.data(), loglevel);
+    if (is_checkpoint_name(fname)) {
+        vector<vector_fp> grids;
+        CheckpointFile::write(fname, checkpoint(id, desc, grids));
+        debuglog("Solution saved to file "+fname+" as solution "+id+".\n",
+                 loglevel);
+    } else {
+        OneDim::save(fname, id, desc, m_x.data(), loglevel);
+    }
 }
 
 void Sim1D::saveResidual(const std::string& fname, const std::string& id,
@@ -98,8 +129,29 @@ void Sim1D::saveResidual(const std::string& fname, const std::string& id,
 }
 
 void Sim1D::restore(const std::string& fname, const std::string& id,
-                    int loglevel)
+                    int loglevel, bool keep_grid)
 {
+    if (CheckpointFile::isCheckpointFile(fname)) {
+        CheckpointFile f(fname);
+        restoreSolution(f.solution(id), keep_grid, loglevel);
+        return;
+    }
+
+    // Keep the current grid and fixed temperature points to interpolate the
+    // restored solution onto the current grid
+    vector<vector_fp> grids;
+    vector_fp zfixed(nDomains(), Undef), tfixed(nDomains(), Undef);
+    if (keep_grid) {
+        for (size_t n = 0; n < nDomains(); n++) {
+            grids.push_back(domain(n).grid());
+            FreeFlame* free = dynamic_cast<FreeFlame*>(&domain(n));
+            if (free) {
+                zfixed[n] = free->m_zfixed;
+                tfixed[n] = free->m_tfixed;
+            }
+        }
+    }
+
     ifstream s(fname);
     if (!s) {
         throw CanteraError("Sim1D::restore",
@@ -135,9 +187,198 @@ void Sim1D::restore(const std::string& fname, const std::string& id,
         domain(m).restore(*xd[m], &m_x[domain(m).loc()], loglevel);
     }
     resize();
+    if (keep_grid) {
+        vector<vector_fp> restored;
+        CheckpointSolution soln = checkpoint(id, "", restored);
+        vector_fp x = m_x;
+        for (size_t m = 0; m < nDomains(); m++) {
+            soln.domains[m].values = &x[domain(m).loc()];
+        }
+        for (size_t m = 0; m < nDomains(); m++) {
+            domain(m).setupGrid(grids[m].size(), grids[m].data());
+            FreeFlame* free = dynamic_cast<FreeFlame*>(&domain(m));
+            if (free) {
+                free->m_zfixed = zfixed[m];
+                free->m_tfixed = tfixed[m];
+            }
+        }
+        restoreSolution(soln, true, loglevel);
+        return;
+    }
     finalize();
 }
 
+CheckpointSolution Sim1D::checkpoint(const std::string& id,
+                                     const std::string& desc,
+                                     vector<vector_fp>& grids)
+{
+    time_t aclock;
+    ::time(&aclock);
+    CheckpointSolution soln;
+    soln.id = id;
+    soln.description = desc;
+    soln.timestamp = asctime(localtime(&aclock));
+    soln.mechanismHash = mechanismHash();
+    grids.resize(nDomains());
+    for (size_t n = 0; n < nDomains(); n++) {
+        Domain1D& d = domain(n);
+        CheckpointDomain cd;
+        cd.id = d.id();
+        cd.type = d.domainType();
+        cd.nComponents = d.nComponents();
+        cd.nPoints = d.nPoints();
+        for (size_t i = 0; i < d.nComponents(); i++) {
+            cd.componentNames.push_back(d.componentName(i));
+        }
+        StFlow* flow = dynamic_cast<StFlow*>(&d);
+        if (flow) {
+            cd.parameters["pressure"] = flow->pressure();
+        }
+        FreeFlame* free = dynamic_cast<FreeFlame*>(&d);
+        if (free && free->m_zfixed != Undef) {
+            cd.parameters["z_fixed"] = free->m_zfixed;
+            cd.parameters["t_fixed"] = free->m_tfixed;
+        }
+        grids[n] = d.grid();
+        cd.grid = grids[n].data();
+        cd.values = &m_x[d.loc()];
+        soln.domains.push_back(cd);
+    }
+    return soln;
+}
+
+void Sim1D::restoreSolution(const CheckpointSolution& soln, bool keep_grid,
+                            int loglevel)
+{
+    if (soln.domains.size() != nDomains()) {
+        throw CanteraError("Sim1D::restore", "Solution does not contain the "
+            " correct number of domains. Found {} expected {}.\n",
+            soln.domains.size(), nDomains());
+    }
+    if (loglevel > 0 && soln.mechanismHash != mechanismHash()) {
+        writelog("Warning: solution '" + soln.id + "' was computed with a "
+                 "different reaction mechanism.\n");
+    }
+
+    // Determine the new grid of each domain
+    vector<vector_fp> grids(nDomains());
+    size_t sz = 0;
+    for (size_t m = 0; m < nDomains(); m++) {
+        const CheckpointDomain& cd = soln.domains[m];
+        if (loglevel > 0 && cd.id != domain(m).id()) {
+            writelog("Warning: domain names do not match: '" + cd.id +
+                     "' and '" + domain(m).id() + "'\n");
+        }
+        if (keep_grid) {
+            grids[m] = domain(m).grid();
+        } else {
+            grids[m].assign(cd.grid, cd.grid + cd.nPoints);
+        }
+        sz += domain(m).nComponents() * grids[m].size();
+    }
+
+    // Copy the components with matching names, interpolating the solution
+    // from the stored grid to the new grid
+    vector_fp x(sz, 0.0);
+    size_t start = 0;
+    for (size_t m = 0; m < nDomains(); m++) {
+        Domain1D& d = domain(m);
+        const CheckpointDomain& cd = soln.domains[m];
+        size_t nc = d.nComponents();
+        const vector_fp& z = grids[m];
+        for (size_t i = 0; i < nc; i++) {
+            string name = d.componentName(i);
+            auto iter = std::find(cd.componentNames.begin(),
+                                  cd.componentNames.end(), name);
+            if (iter == cd.componentNames.end()) {
+                if (loglevel > 0) {
+                    writelog("Warning: no data for component '" + name +
+                             "' in domain '" + d.id() + "'\n");
+                }
+                continue;
+            }
+            size_t k = iter - cd.componentNames.begin();
+            const double* y = cd.values + k;
+            for (size_t j = 0; j < z.size(); j++) {
+                size_t jp = std::upper_bound(cd.grid, cd.grid + cd.nPoints,
+                                             z[j]) - cd.grid;
+                double value;
+                if (jp == 0 || cd.nPoints == 1) {
+                    value = y[0];
+                } else if (jp == cd.nPoints) {
+                    value = y[(jp - 1) * cd.nComponents];
+                } else {
+                    double y0 = y[(jp - 1) * cd.nComponents];
+                    double y1 = y[jp * cd.nComponents];
+                    value = y0 + (y1 - y0) * (z[j] - cd.grid[jp-1]) /
+                            (cd.grid[jp] - cd.grid[jp-1]);
+                }
+                x[start + nc*j + i] = value;
+            }
+        }
+        start += nc * z.size();
+    }
+
+    for (size_t m = 0; m < nDomains(); m++) {
+        domain(m).setupGrid(grids[m].size(), grids[m].data());
+    }
+    m_x = x;
+    m_xnew.resize(sz);
+    resize();
+
+    // Properties of each domain that are saved with the solution
+    for (size_t m = 0; m < nDomains(); m++) {
+        Domain1D& d = domain(m);
+        const auto& params = soln.domains[m].parameters;
+        Inlet1D* inlet = dynamic_cast<Inlet1D*>(&d);
+        if (inlet) {
+            inlet->setMdot(m_x[d.loc()]);
+            inlet->setTemperature(m_x[d.loc() + 1]);
+        }
+        StFlow* flow = dynamic_cast<StFlow*>(&d);
+        if (!flow) {
+            continue;
+        }
+        if (params.count("pressure")) {
+            flow->setPressure(params.at("pressure"));
+        }
+        // Use the restored temperature profile for fixed-temperature
+        // simulations, as when restoring from XML.
+        size_t np = d.nPoints();
+        vector_fp zz(np), T(np);
+        for (size_t j = 0; j < np; j++) {
+            zz[j] = (d.grid(j) - d.zmin()) / (d.zmax() - d.zmin());
+            T[j] = m_x[d.loc() + d.nComponents()*j + c_offset_T];
+        }
+        flow->setFixedTempProfile(zz, T);
+        FreeFlame* free = dynamic_cast<FreeFlame*>(&d);
+        if (free && !keep_grid && params.count("z_fixed")) {
+            free->m_zfixed = params.at("z_fixed");
+            free->m_tfixed = params.at("t_fixed");
+        }
+    }
+    finalize();
+}
+
+uint64_t Sim1D::mechanismHash()
+{
+    uint64_t h = 14695981039346656037ULL;
+    for (size_t n = 0; n < nDomains(); n++) {
+        StFlow* flow = dynamic_cast<StFlow*>(&domain(n));
+        if (!flow) {
+            continue;
+        }
+        for (size_t k = 0; k < flow->phase().nSpecies(); k++) {
+            hash_string(h, flow->phase().speciesName(k));
+        }
+        Kinetics& kin = flow->kinetics();
+        for (size_t i = 0; i < kin.nReactions(); i++) {
+            hash_string(h, kin.reactionString(i));
+        }
+    }
+    return h;
+}
+
 void Sim1D::setFlatProfile(size_t dom, size_t comp, doublereal v)
 {
     size_t np = domain(dom).nPoints();
@@ -210,6 +451,7 @@ void Sim1D::solve(int loglevel, bool refine_grid)
     int nsteps;
     doublereal dt = m_tstep;
     int soln_number = -1;
+    bool coarsened = false;
     finalize();
 
     while (new_points > 0) {
@@ -306,6 +548,15 @@ void Sim1D::solve(int loglevel, bool refine_grid)
             if (new_points < 0) {
                 writelog("Maximum number of grid points reached.");
                 new_points = 0;
+            } else if (new_points == 0 && !coarsened) {
+                // Once no new points are needed, remove unneeded points and
+                // solve again on the coarser grid. This is done only once,
+                // so that points are not repeatedly removed and inserted.
+                new_points = coarsen(loglevel);
+                coarsened = true;
+                if (new_points) {
+                    dt = m_tstep;
+                }
             }
         } else {
             debuglog("grid refinement disabled.\n", loglevel);
@@ -314,6 +565,309 @@ void Sim1D::solve(int loglevel, bool refine_grid)
     }
 }
 
+vector_fp Sim1D::continuation(Func1* setParameter, const vector_fp& path,
+                              int loglevel, bool refine_grid,
+                              const std::string& fname, const std::string& id,
+                              size_t maxHalvings)
+{
+    vector_fp values;
+
+    // Grids and solutions at the last two converged values of the parameter.
+    // Initially, the last state is the current solution, which is restored if
+    // the first solution fails.
+    std::vector<vector_fp> grids, gridsPrev;
+    for (size_t n = 0; n < nDomains(); n++) {
+        grids.push_back(domain(n).grid());
+    }
+    vector_fp x = m_x, xPrev;
+    doublereal p = 0.0, pPrev = 0.0;
+
+    for (size_t i = 0; i < path.size(); i++) {
+        doublereal step = 0.0;
+        size_t nHalvings = 0;
+        while (true) {
+            doublereal pnew = path[i];
+            if (step != 0.0 && fabs(pnew - p) > fabs(step)) {
+                pnew = p + step;
+            }
+
+            // Changing the parameter would otherwise discard the Jacobian,
+            // which is usually still a good approximation
+            int age = OneDim::jacobian().age();
+            setParameter->eval(pnew);
+            OneDim::jacobian().setAge(age);
+
+            // Secant predictor, unless the path repeats a parameter value
+            if (values.size() > 1 && grids == gridsPrev && p != pPrev) {
+                doublereal f = (pnew - p) / (p - pPrev);
+                for (size_t k = 0; k < m_x.size(); k++) {
+                    m_x[k] = x[k] + f * (x[k] - xPrev[k]);
+                }
+                clipToBounds(m_x);
+            }
+
+            try {
+                solve(loglevel - 1, refine_grid);
+            } catch (CanteraError& err) {
+                setGridAndSolution(grids, x);
+                if (values.empty() || nHalvings == maxHalvings) {
+                    if (loglevel > 0) {
+                        writelog("continuation: no solution for parameter "
+                                 "value {}; stopping at {}.\n", pnew, p);
+                        if (loglevel > 1) {
+                            writelog(err.what());
+                        }
+                    }
+                    if (!values.empty()) {
+                        setParameter->eval(p);
+                    }
+                    return values;
+                }
+                step = 0.5 * (pnew - p);
+                nHalvings++;
+                if (loglevel > 0) {
+                    writelog("continuation: no solution for parameter value "
+                             "{}; reducing step to {}.\n", pnew, step);
+                }
+                continue;
+            }
+
+            pPrev = p;
+            p = pnew;
+            gridsPrev = grids;
+            xPrev = x;
+            for (size_t n = 0; n < nDomains(); n++) {
+                grids[n] = domain(n).grid();
+            }
+            x = m_x;
+            if (!fname.empty()) {
+                save(fname, fmt::format("{}_{}", id, values.size()),
+                     fmt::format("parameter = {}", p), loglevel - 1);
+            }
+            values.push_back(p);
+            if (loglevel > 0) {
+                writelog("continuation: solved for parameter value {}.\n", p);
+            }
+            if (p == path[i]) {
+                break;
+            }
+        }
+    }
+    return values;
+}
+
+vector_fp Sim1D::arcLengthContinuation(Func1* setParameter, double p0,
+                                       double dp, size_t nSteps,
+                                       int loglevel, const std::string& fname,
+                                       const std::string& id)
+{
+    if (krylovSolver()) {
+        throw CanteraError("Sim1D::arcLengthContinuation",
+            "Arclength continuation is not supported with the Krylov solver.");
+    }
+    m_turningPoints.clear();
+    size_t nv = size();
+    std::vector<vector_fp> grids;
+    for (size_t n = 0; n < nDomains(); n++) {
+        grids.push_back(domain(n).grid());
+    }
+    vector_fp values{p0};
+    if (!fname.empty()) {
+        save(fname, id + "_0", fmt::format("parameter = {}", p0), loglevel - 1);
+    }
+
+    // First step by natural parameter continuation, which gives the secant
+    // for the first prediction
+    vector_fp x0 = m_x;
+    setParameter->eval(p0 + dp);
+    try {
+        solve(loglevel - 1, false);
+    } catch (CanteraError&) {
+        setGridAndSolution(grids, x0);
+        setParameter->eval(p0);
+        if (loglevel > 0) {
+            writelog("arcLengthContinuation: no solution for parameter value "
+                     "{}.\n", p0 + dp);
+        }
+        return values;
+    }
+    doublereal p1 = p0 + dp;
+    vector_fp x1 = m_x;
+    values.push_back(p1);
+    if (!fname.empty()) {
+        save(fname, id + "_1", fmt::format("parameter = {}", p1), loglevel - 1);
+    }
+
+    // Error weights of the initial solution, which define the norm of the
+    // solution components. The scale of the parameter is chosen so that the
+    // solution and the parameter contribute equally to the first step.
+    vector_fp ewt(nv);
+    for (size_t n = 0; n < nDomains(); n++) {
+        Domain1D& d = domain(n);
+        size_t nc = d.nComponents();
+        size_t np = d.nPoints();
+        for (size_t i = 0; i < nc; i++) {
+            doublereal esum = 0.0;
+            for (size_t j = 0; j < np; j++) {
+                esum += fabs(x0[d.loc() + nc*j + i]);
+            }
+            doublereal w = d.rtol(i) * esum / np + d.atol(i);
+            for (size_t j = 0; j < np; j++) {
+                ewt[d.loc() + nc*j + i] = w*sqrt(double(nv));
+            }
+        }
+    }
+    auto dot = [&](const vector_fp& a, const vector_fp& b) {
+        doublereal sum = 0.0;
+        for (size_t k = 0; k < nv; k++) {
+            sum += a[k] * b[k] / (ewt[k] * ewt[k]);
+        }
+        return sum;
+    };
+    vector_fp tx(nv);
+    for (size_t k = 0; k < nv; k++) {
+        tx[k] = x1[k] - x0[k];
+    }
+    doublereal dxnorm = sqrt(dot(tx, tx));
+    doublereal pscale = (dxnorm > 0.0) ? fabs(dp) / dxnorm : fabs(dp);
+    doublereal tp = dp / pscale;
+    doublereal ds = sqrt(dxnorm * dxnorm + tp * tp);
+    for (size_t k = 0; k < nv; k++) {
+        tx[k] /= ds;
+    }
+    tp /= ds;
+    doublereal dsmin = 1.0e-3 * ds;
+
+    MultiJac& jac = OneDim::jacobian();
+    vector_fp x(nv), r(nv), a(nv), b(nv), dx(nv);
+    const size_t maxIter = 10;
+    while (values.size() <= nSteps) {
+        // Predictor
+        for (size_t k = 0; k < nv; k++) {
+            x[k] = x1[k] + ds * tx[k];
+        }
+        clipToBounds(x);
+        doublereal p = p1 + ds * tp * pscale;
+
+        // Corrector: Newton iteration on the augmented system
+        //     F(x, p) = 0
+        //     (x - x1, p - p1) . t = ds
+        // using the Jacobian at the predicted solution. With J dx + Fp dp =
+        // -F, dx = a + b dp, where a = -J^-1 F and b = -J^-1 Fp.
+        //
+        // The parameter setters call Domain1D::needJacUpdate(), which would
+        // save a row of statistics for each evaluation of the parameter
+        // derivative. Instead, one row is saved for each corrector.
+        struct StatsHold {
+            StatsHold(Sim1D& sim) : s(sim) {
+                s.m_holdStats = true;
+            }
+            ~StatsHold() {
+                release();
+            }
+            void release() {
+                s.m_holdStats = false;
+            }
+            Sim1D& s;
+        } hold(*this);
+        bool converged = false;
+        size_t iter = 0;
+        for (; iter < maxIter && !converged; iter++) {
+            setParameter->eval(p);
+            OneDim::eval(npos, x.data(), r.data(), 0.0);
+            if (iter == 0) {
+                jac.eval(x.data(), r.data(), 0.0);
+            }
+            doublereal delta = sqrt(std::numeric_limits<double>::epsilon())
+                               * std::max(fabs(p), pscale);
+            setParameter->eval(p + delta);
+            OneDim::eval(npos, x.data(), b.data(), 0.0);
+            setParameter->eval(p);
+            for (size_t k = 0; k < nv; k++) {
+                a[k] = -r[k];
+                b[k] = -(b[k] - r[k]) / delta;
+            }
+            if (jac.solve(a.data(), a.data()) || jac.solve(b.data(), b.data())) {
+                break;
+            }
+            doublereal g = tp * (p - p1) / pscale - ds;
+            for (size_t k = 0; k < nv; k++) {
+                dx[k] = x[k] - x1[k];
+            }
+            g += dot(tx, dx);
+            doublereal dpnew = (-g - dot(tx, a)) / (dot(tx, b) + tp / pscale);
+            for (size_t k = 0; k < nv; k++) {
+                dx[k] = a[k] + b[k] * dpnew;
+            }
+            doublereal fbound = newton().boundStep(x.data(), dx.data(), *this,
+                                                   loglevel - 1);
+            if (fbound <= 0.0) {
+                break;
+            }
+            for (size_t k = 0; k < nv; k++) {
+                x[k] += fbound * dx[k];
+            }
+            p += fbound * dpnew;
+            doublereal snorm = sqrt(dot(dx, dx) + pow(dpnew / pscale, 2));
+            converged = (fbound == 1.0 && snorm < 1.0);
+        }
+        hold.release();
+        saveStats();
+
+        if (!converged) {
+            ds *= 0.5;
+            setParameter->eval(p1);
+            if (loglevel > 0) {
+                writelog("arcLengthContinuation: corrector failed; reducing "
+                         "step to {}.\n", ds);
+            }
+            if (ds < dsmin) {
+                break;
+            }
+            continue;
+        }
+
+        if ((p - p1) * (p1 - p0) < 0.0) {
+            m_turningPoints.push_back(p1);
+            if (loglevel > 0) {
+                writelog("arcLengthContinuation: turning point near parameter "
+                         "value {}.\n", p1);
+            }
+        }
+
+        // Update the secant
+        for (size_t k = 0; k < nv; k++) {
+            tx[k] = x[k] - x1[k];
+        }
+        doublereal tpnew = (p - p1) / pscale;
+        doublereal norm = sqrt(dot(tx, tx) + tpnew * tpnew);
+        for (size_t k = 0; k < nv; k++) {
+            tx[k] /= norm;
+        }
+        tp = tpnew / norm;
+        x0 = x1;
+        x1 = x;
+        p0 = p1;
+        p1 = p;
+        m_x = x;
+        if (!fname.empty()) {
+            save(fname, fmt::format("{}_{}", id, values.size()),
+                 fmt::format("parameter = {}", p), loglevel - 1);
+        }
+        values.push_back(p);
+        if (loglevel > 0) {
+            writelog("arcLengthContinuation: solved for parameter value {} "
+                     "in {} iterations.\n", p, iter);
+        }
+        if (iter <= maxIter / 2) {
+            ds *= 1.5;
+        }
+    }
+    m_x = x1;
+    setParameter->eval(p1);
+    return values;
+}
+
 int Sim1D::refine(int loglevel)
 {
     int ianalyze, np = 0;
@@ -342,34 +896,28 @@ int Sim1D::refine(int loglevel)
         size_t npnow = d.nPoints();
         size_t nstart = znew.size();
         for (size_t m = 0; m < npnow; m++) {
-            if (r.keepPoint(m)) {
-                // add the current grid point to the new grid
-                znew.push_back(d.grid(m));
+            // add the current grid point to the new grid
+            znew.push_back(d.grid(m));
 
-                // do the same for the solution at this point
-                for (size_t i = 0; i < comp; i++) {
-                    xnew.push_back(value(n, i, m));
-                }
+            // do the same for the solution at this point
+            for (size_t i = 0; i < comp; i++) {
+                xnew.push_back(value(n, i, m));
+            }
 
-                // now check whether a new point is needed in the interval to
-                // the right of point m, and if so, add entries to znew and xnew
-                // for this new point
-                if (r.newPointNeeded(m) && m + 1 < npnow) {
-                    // add new point at midpoint
-                    zmid = 0.5*(d.grid(m) + d.grid(m+1));
-                    znew.push_back(zmid);
-                    np++;
-
-                    // for each component, linearly interpolate
-                    // the solution to this point
-                    for (size_t i = 0; i < comp; i++) {
-                        xmid = 0.5*(value(n, i, m) + value(n, i, m+1));
-                        xnew.push_back(xmid);
-                    }
-                }
-            } else {
-                if (loglevel > 0) {
-                    writelog("refine: discarding point at {}\n", d.grid(m));
+            // now check whether a new point is needed in the interval to
+            // the right of point m, and if so, add entries to znew and xnew
+            // for this new point
+            if (r.newPointNeeded(m) && m + 1 < npnow) {
+                // add new point at midpoint
+                zmid = 0.5*(d.grid(m) + d.grid(m+1));
+                znew.push_back(zmid);
+                np++;
+
+                // for each component, linearly interpolate
+                // the solution to this point
+                for (size_t i = 0; i < comp; i++) {
+                    xmid = 0.5*(value(n, i, m) + value(n, i, m+1));
+                    xnew.push_back(xmid);
                 }
             }
         }
@@ -399,6 +947,89 @@ int Sim1D::refine(int loglevel)
     return np;
 }
 
+int Sim1D::coarsen(int loglevel)
+{
+    int nremoved = 0;
+    vector_fp znew, xnew;
+    std::vector<size_t> dsize;
+
+    for (size_t n = 0; n < nDomains(); n++) {
+        Domain1D& d = domain(n);
+        Refiner& r = d.refiner();
+        size_t npnow = d.nPoints();
+        size_t nstart = znew.size();
+
+        // determine which points can be removed. Points are only removed
+        // from domains where no new points are needed.
+        bool remove = (r.prune() > 0.0 && npnow > 2 &&
+            r.analyze(npnow, d.grid().data(), &m_x[start(n)]) == 0);
+
+        for (size_t m = 0; m < npnow; m++) {
+            if (!remove || r.keepPoint(m)) {
+                znew.push_back(d.grid(m));
+                for (size_t i = 0; i < d.nComponents(); i++) {
+                    xnew.push_back(value(n, i, m));
+                }
+            } else {
+                if (loglevel > 0) {
+                    writelog("coarsen: discarding point at {}\n", d.grid(m));
+                }
+                nremoved++;
+            }
+        }
+        dsize.push_back(znew.size() - nstart);
+    }
+
+    if (nremoved == 0) {
+        return 0;
+    }
+
+    size_t gridstart = 0;
+    for (size_t n = 0; n < nDomains(); n++) {
+        domain(n).setupGrid(dsize[n], &znew[gridstart]);
+        gridstart += dsize[n];
+    }
+    m_x = xnew;
+    m_xnew.resize(xnew.size());
+    resize();
+    finalize();
+    return nremoved;
+}
+
+void Sim1D::setGridAndSolution(const std::vector<vector_fp>& grids,
+                               const vector_fp& x)
+{
+    bool changed = false;
+    for (size_t n = 0; n < nDomains(); n++) {
+        if (domain(n).grid() != grids[n]) {
+            domain(n).setupGrid(grids[n].size(), grids[n].data());
+            changed = true;
+        }
+    }
+    m_x = x;
+    m_xnew.resize(x.size());
+    if (changed) {
+        resize();
+    }
+    finalize();
+    setSteadyMode();
+    newton().setOptions(m_ss_jac_age);
+}
+
+void Sim1D::clipToBounds(vector_fp& x)
+{
+    for (size_t n = 0; n < nDomains(); n++) {
+        Domain1D& d = domain(n);
+        size_t nc = d.nComponents();
+        for (size_t j = 0; j < d.nPoints(); j++) {
+            for (size_t i = 0; i < nc; i++) {
+                doublereal& xi = x[d.loc() + nc*j + i];
+                xi = std::min(std::max(xi, d.lowerBound(i)), d.upperBound(i));
+            }
+        }
+    }
+}
+
 int Sim1D::setFixedTemperature(doublereal t)
 {
     int np = 0;
@@ -5,6 +5,7 @@
 // Copyright 2002  California Institute of Technology
 
 #include "cantera/oneD/StFlow.h"
+#include "cantera/oneD/OneDim.h"
 #include "cantera/base/ctml.h"
 #include "cantera/transport/TransportBase.h"
 #include "cantera/numerics/funcs.h"
@@ -17,6 +18,20 @@ using namespace std;
 namespace Cantera
 {
 
+namespace {
+// Model constant C_mu and turbulent Prandtl and Schmidt numbers used to
+// evaluate the turbulent transport properties
+const doublereal C_mu = 0.09;
+const doublereal Pr_turb = 0.85;
+const doublereal Sc_turb = 0.7;
+
+// Constants of the standard k-epsilon model (Launder and Spalding, 1974)
+const doublereal C_eps1 = 1.44;
+const doublereal C_eps2 = 1.92;
+const doublereal sigma_k = 1.0;
+const doublereal sigma_eps = 1.3;
+}
+
 StFlow::StFlow(IdealGasPhase* ph, size_t nsp, size_t points) :
     Domain1D(nsp+c_offset_Y, points),
 
@@ -31,9 +46,13 @@ StFlow::StFlow(IdealGasPhase* ph, size_t nsp, size_t points) :
 
     m_do_soret(false),
     m_transport_option(-1),
-    m_do_radiation(false)
+    m_do_radiation(false),
+    m_do_turbulence(false),
+    m_do_chemJac(false),
+    m_frozenWdot(false)
 {
     m_type = cFlowType;
+    m_boundaryRad[0] = m_boundaryRad[1] = 0.0;
 
 
     m_points = points;
@@ -79,6 +98,8 @@ StFlow::StFlow(IdealGasPhase* ph, size_t nsp, size_t points) :
     setBounds(2, 200.0, 1e9); // temperature bounds
     setBounds(3, -1e20, 1e20); // lambda should be negative
 	setBounds(c_offset_TT, -1e20, 1e20);// T'^2 bounds
+    setBounds(c_offset_K, -1.0e-10, 1e20); // TKE
+    setBounds(c_offset_E, -1.0e-10, 1e20); // epsilon
 	
     // mass fraction bounds
     for (size_t k = 0; k < m_nsp; k++) {
@@ -94,6 +115,8 @@ StFlow::StFlow(IdealGasPhase* ph, size_t nsp, size_t points) :
     m_refiner->setActive(1, false);
     m_refiner->setActive(2, false);
     m_refiner->setActive(3, false);
+    m_refiner->setActive(c_offset_K, false);
+    m_refiner->setActive(c_offset_E, false);
 
     vector_fp gr;
     for (size_t ng = 0; ng < m_points; ng++) {
@@ -120,6 +143,14 @@ void StFlow::resize(size_t ncomponents, size_t points)
     m_tcon.resize(m_points, 0.0);
 	viscTurb.resize(m_points, 0.0);
 	TT_Out.resize(m_points, 0.0);
+	m_TKE.resize(m_points, 0.0);
+	m_ED.resize(m_points, 0.0);
+	m_tconTurb.resize(m_points, 0.0);
+	m_diffTurb.resize(m_points, 0.0);
+
+    m_tmid.resize(m_points, 0.0);
+    m_pmid.resize(m_points, 0.0);
+    m_xmid.resize(m_nsp*m_points, 0.0);
 
     if (m_transport_option == c_Mixav_Transport) {
         m_diff.resize(m_nsp*m_points);
@@ -153,6 +184,43 @@ void StFlow::setupGrid(size_t n, const doublereal* z)
         m_z[j] = z[j];
         m_dz[j-1] = m_z[j] - m_z[j-1];
     }
+    updateTurbulenceProfiles();
+}
+
+void StFlow::setTKEProfile(const vector_fp& zfixed, const vector_fp& TKE)
+{
+    if (zfixed.empty() || zfixed.size() != TKE.size()) {
+        throw CanteraError("StFlow::setTKEProfile",
+                           "position and value arrays must have the same "
+                           "nonzero length.");
+    }
+    m_zTKE = zfixed;
+    m_TKEprof = TKE;
+    updateTurbulenceProfiles();
+}
+
+void StFlow::setEDProfile(const vector_fp& zfixed, const vector_fp& ED)
+{
+    if (zfixed.empty() || zfixed.size() != ED.size()) {
+        throw CanteraError("StFlow::setEDProfile",
+                           "position and value arrays must have the same "
+                           "nonzero length.");
+    }
+    m_zED = zfixed;
+    m_EDprof = ED;
+    updateTurbulenceProfiles();
+}
+
+void StFlow::updateTurbulenceProfiles()
+{
+    // The profiles are stored in terms of the relative position, so they
+    // are simply re-interpolated when the grid is refined
+    doublereal dz = (m_points > 1) ? z(m_points - 1) - z(0) : 0.0;
+    for (size_t j = 0; j < m_points; j++) {
+        doublereal zz = (dz > 0.0) ? (z(j) - z(0))/dz : 0.0;
+        m_TKE[j] = m_zTKE.empty() ? 0.0 : linearInterp(zz, m_zTKE, m_TKEprof);
+        m_ED[j] = m_zED.empty() ? 0.0 : linearInterp(zz, m_zED, m_EDprof);
+    }
 }
 
 void StFlow::setTransport(Transport& trans, bool withSoret)
@@ -166,7 +234,8 @@ void StFlow::setTransport(Transport& trans, bool withSoret)
         m_multidiff.resize(m_nsp*m_nsp*m_points);
         m_diff.resize(m_nsp*m_points);
         m_dthermal.resize(m_nsp, m_points, 0.0);
-    } else if (model == cMixtureAveraged || model == CK_MixtureAveraged) {
+    } else if (model == cMixtureAveraged || model == CK_MixtureAveraged ||
+               model == cMixtureTabulated) {
         m_transport_option = c_Mixav_Transport;
         m_diff.resize(m_nsp*m_points);
         if (withSoret) {
@@ -192,17 +261,22 @@ void StFlow::enableSoret(bool withSoret)
 
 void StFlow::setGas(const doublereal* x, size_t j)
 {
-	m_thermo->setTemperature(T(x, j));
+	setGas(x, j, 0);
+}
+
+void StFlow::setGas(const doublereal* x, size_t j, size_t thread)
+{
+	IdealGasPhase& thermo = threadThermo(thread);
+	thermo.setTemperature(T(x, j));
 	const doublereal* yy = x + m_nv*j + c_offset_Y;
-	m_thermo->setMassFractions_NoNorm(yy);
-	m_thermo->setPressure(m_press);
-	viscTurb[j] = m_rho[j] * 0.09* (m_TKE*m_TKE / m_ED);
+	thermo.setMassFractions_NoNorm(yy);
+	thermo.setPressure(m_press);
 	doublereal TempPrime = sqrt(TT(x, j));
 	doublereal TprimeOverT = TempPrime / T(x, j);
 	doublereal T_inverse = 1 / T(x, j);
 
 
-	TurbulentKinetics* turbKin = dynamic_cast<TurbulentKinetics*>(m_kin);
+	TurbulentKinetics* turbKin = dynamic_cast<TurbulentKinetics*>(&threadKinetics(thread));
 	if (turbKin) {
 		turbKin->setTprime(TempPrime);
 		TT_Out[j] = m_arrh->Cc_Out(T_inverse, TprimeOverT);
@@ -221,6 +295,47 @@ void StFlow::getTT_Out(doublereal* TT_Out){
 	}
 }
 
+void StFlow::updateThermo(const doublereal* x, size_t j0, size_t j1)
+{
+    forEachPoint(j0, j1 + 1, [&](size_t j, size_t thread) {
+        setGas(x, j, thread);
+        IdealGasPhase& thermo = threadThermo(thread);
+        m_rho[j] = thermo.density();
+        m_wtm[j] = thermo.meanMolecularWeight();
+        m_cp[j] = thermo.cp_mass();
+    });
+}
+
+void StFlow::forEachPoint(size_t j0, size_t j1,
+                          const std::function<void(size_t, size_t)>& f)
+{
+    ThreadPool* pool = m_container ? m_container->threadPool() : 0;
+    if (!pool || j1 < j0 + 2*pool->size()) {
+        for (size_t j = j0; j < j1; j++) {
+            f(j, 0);
+        }
+        return;
+    }
+
+    if (m_threadThermo.size() + 1 != pool->size()) {
+        // copies of the phase and kinetics objects for each additional thread
+        m_threadThermo.clear();
+        m_threadKin.clear();
+        for (size_t i = 1; i < pool->size(); i++) {
+            m_threadThermo.emplace_back(
+                dynamic_cast<IdealGasPhase*>(m_thermo->duplMyselfAsThermoPhase()));
+            std::vector<thermo_t*> phases{m_threadThermo.back().get()};
+            m_threadKin.emplace_back(m_kin->duplMyselfAsKinetics(phases));
+        }
+    }
+
+    pool->parallelFor(j0, j1, [&](size_t i0, size_t i1, size_t thread) {
+        for (size_t j = i0; j < i1; j++) {
+            f(j, thread);
+        }
+    });
+}
+
 void StFlow::setGasAtMidpoint(const doublereal* x, size_t j)
 {
     m_thermo->setTemperature(0.5*(T(x,j)+T(x,j+1)));
@@ -235,6 +350,14 @@ void StFlow::setGasAtMidpoint(const doublereal* x, size_t j)
 
 void StFlow::_finalize(const doublereal* x)
 {
+    // The phase or kinetics objects may have been modified since the copies
+    // used by additional threads were made
+    m_threadThermo.clear();
+    m_threadKin.clear();
+
+    // Never carry frozen production rates over from an interrupted Jacobian
+    // evaluation
+    m_frozenWdot = false;
 
     size_t j;
     doublereal zz, tt;
@@ -286,15 +409,155 @@ void StFlow::eval(size_t jg, doublereal* xg,
         jmax = std::min(jpt+1,m_points-1);
     }
 
+    evalPoints(x, rsd, diag, rdt, jmin, jmax, jg == npos, false);
+}
+
+void StFlow::evalPerturbed(doublereal* xg, doublereal* rg, integer* diagg)
+{
+    // Evaluate the steady-state residual at all points with the transport
+    // properties held fixed, as for a single point. The radiative fluxes
+    // from the boundaries are also held fixed, since they would otherwise
+    // couple the boundary points to the points perturbed with them.
+    evalPoints(xg + loc(), rg + loc(), diagg + loc(), 0.0, 0, m_points - 1,
+               false, true);
+}
+
+void StFlow::startJacobian(doublereal* xg)
+{
+    // The production rates from the last evaluation of the full residual are
+    // used for all of the perturbed residuals
+    m_frozenWdot = m_do_chemJac;
+}
+
+void StFlow::finishJacobian(doublereal* xg, MultiJac& jac)
+{
+    if (!m_frozenWdot) {
+        return;
+    }
+    m_frozenWdot = false;
+
+    doublereal* x = xg + loc();
+    size_t nr = m_nsp + 1;
+    size_t nc = m_nsp + 2;
+    m_chemJac.resize(nr*nc, m_points);
+    ThreadPool* pool = m_container ? m_container->threadPool() : 0;
+    m_chemWork.resize(pool ? pool->size() : 1);
+    forEachPoint(1, m_points - 1, [&](size_t j, size_t thread) {
+        evalChemicalJacobian(x, j, thread, &m_chemJac(0,j));
+    });
+
+    // add the derivatives of the source terms to the diagonal blocks
+    for (size_t j = 1; j < m_points - 1; j++) {
+        for (size_t n = 0; n < nc; n++) {
+            size_t col;
+            if (n < m_nsp) {
+                col = loc() + index(c_offset_Y + n, j);
+            } else if (n == m_nsp) {
+                col = loc() + index(c_offset_T, j);
+            } else {
+                col = loc() + index(c_offset_TT, j);
+            }
+            const doublereal* dr = &m_chemJac(n*nr, j);
+            for (size_t k = 0; k < m_nsp; k++) {
+                jac.value(loc() + index(c_offset_Y + k, j), col) += dr[k];
+            }
+            if (m_do_energy[j]) {
+                jac.value(loc() + index(c_offset_T, j), col) += dr[m_nsp];
+            }
+        }
+    }
+}
+
+void StFlow::abortJacobian()
+{
+    m_frozenWdot = false;
+}
+
+void StFlow::evalChemicalJacobian(doublereal* x, size_t j, size_t thread,
+                                  doublereal* jac)
+{
+    IdealGasPhase& thermo = threadThermo(thread);
+    Kinetics& kin = threadKinetics(thread);
+    vector_fp& work = m_chemWork[thread];
+    work.resize(m_nsp*(m_nsp + 2));
+    doublereal* ddC = work.data();
+    doublereal* X = ddC + m_nsp*m_nsp;
+    doublereal* wdot1 = X + m_nsp;
+    size_t nr = m_nsp + 1;
+
+    // The concentrations are C_m = ctot*X_m, with the derivatives of the
+    // mole fractions with respect to the mass fractions
+    // dX_m/dY_n = (W_mix/W_n)*(delta_mn - X_m)
+    setGas(x, j, thread);
+    kin.getNetProductionRates_ddC(ddC);
+    thermo.getMoleFractions(X);
+    doublereal rho = thermo.density();
+    doublereal cp = thermo.cp_mass();
+    doublereal c = thermo.molarDensity() * thermo.meanMolecularWeight();
+    for (size_t k = 0; k < m_nsp; k++) {
+        wdot1[k] = 0.0;
+        for (size_t m = 0; m < m_nsp; m++) {
+            wdot1[k] += ddC[k + m*m_nsp] * X[m];
+        }
+    }
+    for (size_t n = 0; n < m_nsp; n++) {
+        for (size_t k = 0; k < m_nsp; k++) {
+            jac[k + n*nr] = c / m_wt[n] * (ddC[k + n*m_nsp] - wdot1[k]);
+        }
+    }
+
+    // The derivatives with respect to the temperature and the temperature
+    // fluctuation are found by perturbing them in the same way as MultiJac
+    // does. The rates at the unperturbed state are those in m_wdot.
+    doublereal T0 = T(x,j);
+    doublereal dT = 1.0e-5 * T0 + 1.0e-8;
+    thermo.setTemperature(T0 + dT);
+    thermo.setPressure(m_press);
+    kin.getNetProductionRates(wdot1);
+    for (size_t k = 0; k < m_nsp; k++) {
+        jac[k + m_nsp*nr] = (wdot1[k] - wdot(k,j)) / dT;
+    }
+
+    TurbulentKinetics* turbKin = dynamic_cast<TurbulentKinetics*>(&kin);
+    if (turbKin) {
+        doublereal dTT = 1.0e-5 * fabs(TT(x,j)) + 1.0e-8;
+        thermo.setTemperature(T0);
+        thermo.setPressure(m_press);
+        turbKin->setTprime(sqrt(TT(x,j) + dTT));
+        kin.getNetProductionRates(wdot1);
+        for (size_t k = 0; k < m_nsp; k++) {
+            jac[k + (m_nsp+1)*nr] = (wdot1[k] - wdot(k,j)) / dTT;
+        }
+    } else {
+        fill(jac + (m_nsp+1)*nr, jac + (m_nsp+2)*nr, 0.0);
+    }
+    setGas(x, j, thread);
+
+    // derivatives of the source terms in the species and energy equations
+    const vector_fp& h_RT = thermo.enthalpy_RT_ref();
+    for (size_t n = 0; n < m_nsp + 2; n++) {
+        doublereal* col = jac + n*nr;
+        doublereal sum = 0.0;
+        for (size_t k = 0; k < m_nsp; k++) {
+            sum += col[k] * h_RT[k];
+            col[k] *= m_wt[k] / rho;
+        }
+        col[m_nsp] = - GasConstant * T0 * sum / (rho * cp);
+    }
+}
+
+void StFlow::evalPoints(doublereal* x, doublereal* rsd, integer* diag,
+                        doublereal rdt, size_t jmin, size_t jmax,
+                        bool updateTrans, bool fixedRad)
+{
     // properties are computed for grid points from j0 to j1
     size_t j0 = std::max<size_t>(jmin, 1) - 1;
     size_t j1 = std::min(jmax+1,m_points-1);
-    size_t j, k;
 	
     // ------------ update properties ------------
     updateThermo(x, j0, j1);
     // update transport properties only if a Jacobian is not being evaluated
-    if (jg == npos) {
+    if (updateTrans) {
         updateTransport(x, j0, j1);
     }
     // update the species diffusive mass fluxes whether or not a
@@ -306,8 +569,6 @@ void StFlow::eval(size_t jg, doublereal* xg,
     // grid points
     //----------------------------------------------------
 
-    doublereal sum, sum2, dtdzj;
-
     // calculation of qdotRadiation
 
     // The simple radiation model used was established by Y. Liu and B. Rogg [Y.
@@ -335,8 +596,12 @@ void StFlow::eval(size_t jg, doublereal* xg,
                                      56.310, -5.8169};
 
         // calculation of the two boundary values
-        double boundary_Rad_left = m_epsilon_left * StefanBoltz * pow(T(x, 0), 4);
-        double boundary_Rad_right = m_epsilon_right * StefanBoltz * pow(T(x, m_points - 1), 4);
+        if (!fixedRad) {
+            m_boundaryRad[0] = m_epsilon_left * StefanBoltz * pow(T(x, 0), 4);
+            m_boundaryRad[1] = m_epsilon_right * StefanBoltz * pow(T(x, m_points - 1), 4);
+        }
+        double boundary_Rad_left = m_boundaryRad[0];
+        double boundary_Rad_right = m_boundaryRad[1];
 
         // loop over all grid points
         for (size_t j = jmin; j < jmax; j++) {
@@ -373,77 +638,94 @@ void StFlow::eval(size_t jg, doublereal* xg,
         }
     }
 
-    for (j = jmin; j <= jmax; j++) {
-        //----------------------------------------------
-        //         left boundary
-        //----------------------------------------------
+    forEachPoint(jmin, jmax + 1, [&](size_t j, size_t thread) {
+        evalPoint(j, x, rsd, diag, rdt, thread);
+    });
+}
 
-        if (j == 0) {
+void StFlow::evalPoint(size_t j, doublereal* x, doublereal* rsd,
+                       integer* diag, doublereal rdt, size_t thread)
+{
+    size_t k;
+    doublereal sum, sum2, dtdzj;
 
-            // these may be modified by a boundary object
+    //----------------------------------------------
+    //         left boundary
+    //----------------------------------------------
 
-            // Continuity. This propagates information right-to-left, since
-            // rho_u at point 0 is dependent on rho_u at point 1, but not on
-            // mdot from the inlet.
-            rsd[index(c_offset_U,0)] =
-                -(rho_u(x,1) - rho_u(x,0))/m_dz[0]
-                -(density(1)*V(x,1) + density(0)*V(x,0));
+    if (j == 0) {
 
-            // the inlet (or other) object connected to this one will modify
+        // these may be modified by a boundary object
 
-            // these equations by subtracting its values for V, T, and mdot. As
-            // a result, these residual equations will force the solution
-            // variables to the values for the boundary object
+        // Continuity. This propagates information right-to-left, since
+        // rho_u at point 0 is dependent on rho_u at point 1, but not on
+        // mdot from the inlet.
+        rsd[index(c_offset_U,0)] =
+            -(rho_u(x,1) - rho_u(x,0))/m_dz[0]
+            -(density(1)*V(x,1) + density(0)*V(x,0));
 
-            rsd[index(c_offset_V,0)] = V(x,0);
-            rsd[index(c_offset_T,0)] = T(x,0);
-            rsd[index(c_offset_L,0)] = -rho_u(x,0);
-            rsd[index(c_offset_TT,0)] = TT(x,0);
+        // the inlet (or other) object connected to this one will modify
 
-            // The default boundary condition for species is zero flux. However,
+        // these equations by subtracting its values for V, T, and mdot. As
+        // a result, these residual equations will force the solution
+        // variables to the values for the boundary object
 
-            // the boundary object may modify this.
+        rsd[index(c_offset_V,0)] = V(x,0);
+        rsd[index(c_offset_T,0)] = T(x,0);
+        rsd[index(c_offset_L,0)] = -rho_u(x,0);
+        rsd[index(c_offset_TT,0)] = TT(x,0);
+        rsd[index(c_offset_K,0)] = K(x,0);
+        rsd[index(c_offset_E,0)] = Eps(x,0);
 
-            sum = 0.0;
-            for (k = 0; k < m_nsp; k++) {
-                sum += Y(x,k,0);
-                rsd[index(c_offset_Y + k, 0)] =
-                    -(m_flux(k,0) + rho_u(x,0)* Y(x,k,0));
-            }
-            rsd[index(c_offset_Y, 0)] = 1.0 - sum;
+        // The default boundary condition for species is zero flux. However,
 
+        // the boundary object may modify this.
+
+        sum = 0.0;
+        for (k = 0; k < m_nsp; k++) {
+            sum += Y(x,k,0);
+            rsd[index(c_offset_Y + k, 0)] =
+                -(m_flux(k,0) + rho_u(x,0)* Y(x,k,0));
+        }
+        rsd[index(c_offset_Y, 0)] = 1.0 - sum;
 
-        } else if (j == m_points - 1) {
-            evalRightBoundary(x, rsd, diag, rdt);
 
-        } else { // interior points
-            evalContinuity(j, x, rsd, diag, rdt);
+    } else if (j == m_points - 1) {
+        evalRightBoundary(x, rsd, diag, rdt);
 
-            //------------------------------------------------
-            //    Radial momentum equation
-            //
-            //    \rho dV/dt + \rho u dV/dz + \rho V^2
-            //       = d(\mu dV/dz)/dz - lambda
+    } else { // interior points
+        evalContinuity(j, x, rsd, diag, rdt);
 
-            //-------------------------------------------------
-            rsd[index(c_offset_V,j)]
-            = (shear(x,j) - lambda(x,j) - rho_u(x,j)*dVdz(x,j)
-               - m_rho[j]*V(x,j)*V(x,j))/m_rho[j]
-              - rdt*(V(x,j) - V_prev(j));
-            diag[index(c_offset_V, j)] = 1;
+        //------------------------------------------------
+        //    Radial momentum equation
+        //
+        //    \rho dV/dt + \rho u dV/dz + \rho V^2
+        //       = d(\mu dV/dz)/dz - lambda
 
-            //-------------------------------------------------
-            //    Species equations
-            //
-            //   \rho dY_k/dt + \rho u dY_k/dz + dJ_k/dz
-            //   = M_k\omega_k
+        //-------------------------------------------------
+        rsd[index(c_offset_V,j)]
+        = (shear(x,j) - lambda(x,j) - rho_u(x,j)*dVdz(x,j)
+           - m_rho[j]*V(x,j)*V(x,j))/m_rho[j]
+          - rdt*(V(x,j) - V_prev(j));
+        diag[index(c_offset_V, j)] = 1;
 
-            //-------------------------------------------------
-            getWdot(x,j);
+        //-------------------------------------------------
+        //    Species equations
+        //
+        //   \rho dY_k/dt + \rho u dY_k/dz + dJ_k/dz
+        //   = M_k\omega_k
+
+        //-------------------------------------------------
+        if (!m_frozenWdot) {
+            getWdot(x, j, thread);
+        }
 
 			//Calculate the Eddy Dissapation Concept Values
 			
-			doublereal  EDC = ((2.1337*(sqrt(sqrt(((m_visc[j]*m_ED)/(m_rho[j]*m_TKE*m_TKE)))))));
+			doublereal EDC = 1.0;
+			if (m_TKE[j] > 0.0) {
+				EDC = 2.1337*sqrt(sqrt((m_visc[j]*m_ED[j])/(m_rho[j]*m_TKE[j]*m_TKE[j])));
+			}
 
 			if (EDC>1) {
 				 EDC = 1;
@@ -451,64 +733,65 @@ void StFlow::eval(size_t jg, doublereal* xg,
 			if (EDC<0.1){
 				EDC=0.1;
 			}
-            doublereal convec, diffus;
-            for (k = 0; k < m_nsp; k++) {
-                convec = rho_u(x,j)*dYdz(x,k,j);
-                diffus = 2.0*(m_flux(k,j) - m_flux(k,j-1))
-                         /(z(j+1) - z(j-1));
-                rsd[index(c_offset_Y + k, j)]
-                = ((m_wt[k] * wdot(k, j))
+        doublereal convec, diffus;
+        for (k = 0; k < m_nsp; k++) {
+            convec = rho_u(x,j)*dYdz(x,k,j);
+            diffus = 2.0*(m_flux(k,j) - m_flux(k,j-1))
+                     /(z(j+1) - z(j-1));
+            rsd[index(c_offset_Y + k, j)]
+            = ((m_wt[k] * wdot(k, j))
 				//= (((m_wt[k] * (wdot(k, j)))*EDC)
-                   - convec - diffus)/m_rho[j]
-                  - rdt*(Y(x,k,j) - Y_prev(k,j));
-                diag[index(c_offset_Y + k, j)] = 1;
-            }
+               - convec - diffus)/m_rho[j]
+              - rdt*(Y(x,k,j) - Y_prev(k,j));
+            diag[index(c_offset_Y + k, j)] = 1;
+        }
 
-            //-----------------------------------------------
-            //    energy equation
-            //
-            //    \rho c_p dT/dt + \rho c_p u dT/dz
-            //    = d(k dT/dz)/dz
-            //      - sum_k(\omega_k h_k_ref)
-            //      - sum_k(J_k c_p_k / M_k) dT/dz
-            //-----------------------------------------------
+        //-----------------------------------------------
+        //    energy equation
+        //
+        //    \rho c_p dT/dt + \rho c_p u dT/dz
+        //    = d(k dT/dz)/dz
+        //      - sum_k(\omega_k h_k_ref)
+        //      - sum_k(J_k c_p_k / M_k) dT/dz
+        //-----------------------------------------------
 
-            if (m_do_energy[j]) {
+        if (m_do_energy[j]) {
 
-                setGas(x,j);
+            setGas(x, j, thread);
 
-                // heat release term
-                const vector_fp& h_RT = m_thermo->enthalpy_RT_ref();
-                const vector_fp& cp_R = m_thermo->cp_R_ref();
+            // heat release term
+            IdealGasPhase& thermo = threadThermo(thread);
+            const vector_fp& h_RT = thermo.enthalpy_RT_ref();
+            const vector_fp& cp_R = thermo.cp_R_ref();
 
-                sum = 0.0;
-                sum2 = 0.0;
-                doublereal flxk;
-                for (k = 0; k < m_nsp; k++) {
-                    flxk = 0.5*(m_flux(k,j-1) + m_flux(k,j));
-                    sum += wdot(k,j)*h_RT[k];
-                    sum2 += flxk*cp_R[k]/m_wt[k];
-                }
-                sum *= GasConstant * T(x,j);
-                dtdzj = dTdz(x,j);
-                sum2 *= GasConstant * dtdzj;
+            sum = 0.0;
+            sum2 = 0.0;
+            doublereal flxk;
+            for (k = 0; k < m_nsp; k++) {
+                flxk = 0.5*(m_flux(k,j-1) + m_flux(k,j));
+                sum += wdot(k,j)*h_RT[k];
+                sum2 += flxk*cp_R[k]/m_wt[k];
+            }
+            sum *= GasConstant * T(x,j);
+            dtdzj = dTdz(x,j);
+            sum2 *= GasConstant * dtdzj;
 
-                rsd[index(c_offset_T, j)] = 
+            rsd[index(c_offset_T, j)] = 
 				- m_cp[j]*rho_u(x,j)*dtdzj
-                - divHeatFlux(x,j) - sum - sum2;
-                rsd[index(c_offset_T, j)] /= (m_rho[j]*m_cp[j]);
+            - divHeatFlux(x,j) - sum - sum2;
+            rsd[index(c_offset_T, j)] /= (m_rho[j]*m_cp[j]);
 
-                rsd[index(c_offset_T, j)] -= rdt*(T(x,j) - T_prev(j));
-                rsd[index(c_offset_T, j)] -= (m_qdotRadiation[j] / (m_rho[j] * m_cp[j]));
-                diag[index(c_offset_T, j)] = 1;
-            } else {
-                // residual equations if the energy equation is disabled
-                rsd[index(c_offset_T, j)] = T(x,j) - T_fixed(j);
-                diag[index(c_offset_T, j)] = 0;
-            }
+            rsd[index(c_offset_T, j)] -= rdt*(T(x,j) - T_prev(j));
+            rsd[index(c_offset_T, j)] -= (m_qdotRadiation[j] / (m_rho[j] * m_cp[j]));
+            diag[index(c_offset_T, j)] = 1;
+        } else {
+            // residual equations if the energy equation is disabled
+            rsd[index(c_offset_T, j)] = T(x,j) - T_fixed(j);
+            diag[index(c_offset_T, j)] = 0;
+        }
 
-            rsd[index(c_offset_L, j)] = lambda(x,j) - lambda(x,j-1);
-            diag[index(c_offset_L, j)] = 0;
+        rsd[index(c_offset_L, j)] = lambda(x,j) - lambda(x,j-1);
+        diag[index(c_offset_L, j)] = 0;
 
 			//-----------------------------------------------
 			// Temperature Fluctuation
@@ -539,24 +822,90 @@ void StFlow::eval(size_t jg, doublereal* xg,
 					
 			//convec_TT = (dttdzj*rho_u(x, j));// +(TT(x, j) * ((m_rho[j] * dudz(x, j)) + (u(x, j) * drhodz(x, j))));
 			//TT_sink = -2.86 * viscTurb[j] * dTdz(x, j) * dTdz(x, j);
-			TT_src = 2 * m_rho[j] * (m_ED / m_TKE) * TT(x,j);
+			if (m_TKE[j] > 0.0) {
+				TT_src = 2 * m_rho[j] * (m_ED[j] / m_TKE[j]) * TT(x,j);
+			}
 
 			rsd[index(c_offset_TT, j)] = - divFlux_TT(x, j) - convec_TT - TT_sink - TT_src;// 
 			rsd[index(c_offset_TT, j)] /=  m_rho[j];
 			rsd[index(c_offset_TT, j)] -= rdt*(TT(x, j) - TT_prev(j));
 			diag[index(c_offset_TT, j)] = 1; 
+
+        if (m_do_turbulence) {
+            evalTurbulence(j, x, rsd, diag, rdt);
         }
     }
+
+    if (!m_do_turbulence) {
+        // hold k and epsilon to the specified profiles
+        rsd[index(c_offset_K, j)] = K(x,j) - m_TKE[j];
+        diag[index(c_offset_K, j)] = 0;
+        rsd[index(c_offset_E, j)] = Eps(x,j) - m_ED[j];
+        diag[index(c_offset_E, j)] = 0;
+    }
+}
+
+void StFlow::evalTurbulence(size_t j, doublereal* x, doublereal* rsd,
+                            integer* diag, doublereal rdt)
+{
+    //-----------------------------------------------
+    //    k-epsilon equations
+    //
+    //    \rho dk/dt + \rho u dk/dz
+    //    = d((\mu + \mu_t/\sigma_k) dk/dz)/dz + P_k - \rho\epsilon
+    //
+    //    \rho d\epsilon/dt + \rho u d\epsilon/dz
+    //    = d((\mu + \mu_t/\sigma_\epsilon) d\epsilon/dz)/dz
+    //      + (C_1 P_k - C_2 \rho\epsilon) \epsilon/k
+    //
+    //    The production P_k = \mu_t (2 (du/dz)^2 + 4 V^2) is evaluated on
+    //    the axis, where the radial velocity is V r.
+    //-----------------------------------------------
+    doublereal tke = std::max(K(x,j), Tiny);
+    doublereal ed = std::max(Eps(x,j), Tiny);
+    doublereal mut = m_rho[j]*C_mu*tke*tke/ed;
+    doublereal dudz_c = (u(x,j+1) - u(x,j-1))/(z(j+1) - z(j-1));
+    doublereal prod = mut*(2.0*dudz_c*dudz_c + 4.0*V(x,j)*V(x,j));
+
+    rsd[index(c_offset_K, j)] =
+        (-rho_u(x,j)*dKdz(x,j) - divTurbFlux(x, c_offset_K, sigma_k, j)
+         + prod - m_rho[j]*Eps(x,j))/m_rho[j]
+        - rdt*(K(x,j) - K_prev(j));
+    diag[index(c_offset_K, j)] = 1;
+
+    rsd[index(c_offset_E, j)] =
+        (-rho_u(x,j)*dEpsdz(x,j) - divTurbFlux(x, c_offset_E, sigma_eps, j)
+         + (C_eps1*prod - C_eps2*m_rho[j]*Eps(x,j))*ed/tke)/m_rho[j]
+        - rdt*(Eps(x,j) - Eps_prev(j));
+    diag[index(c_offset_E, j)] = 1;
 }
 
 void StFlow::updateTransport(doublereal* x, size_t j0, size_t j1)
 {
     if (m_transport_option == c_Mixav_Transport) {
+        // evaluate the properties at all midpoints in a single call
         for (size_t j = j0; j < j1; j++) {
-            setGasAtMidpoint(x,j);
-            m_visc[j] = (m_dovisc ? m_trans->viscosity() : 0.0);
-            m_trans->getMixDiffCoeffs(&m_diff[j*m_nsp]);
-            m_tcon[j] = m_trans->thermalConductivity();
+            m_tmid[j] = 0.5*(T(x,j) + T(x,j+1));
+            m_pmid[j] = m_press;
+            const doublereal* yyj = x + m_nv*j + c_offset_Y;
+            const doublereal* yyjp = x + m_nv*(j+1) + c_offset_Y;
+            doublereal* xx = &m_xmid[j*m_nsp];
+            doublereal sum = 0.0;
+            for (size_t k = 0; k < m_nsp; k++) {
+                xx[k] = 0.5*(yyj[k] + yyjp[k]) / m_wt[k];
+                sum += xx[k];
+            }
+            for (size_t k = 0; k < m_nsp; k++) {
+                xx[k] /= sum;
+            }
+            if (!m_dovisc) {
+                m_visc[j] = 0.0;
+            }
+        }
+        if (j1 > j0) {
+            m_trans->getMixTransportProperties(j1 - j0, &m_tmid[j0],
+                &m_pmid[j0], &m_xmid[j0*m_nsp], m_dovisc ? &m_visc[j0] : 0,
+                &m_tcon[j0], &m_diff[j0*m_nsp]);
         }
     } else if (m_transport_option == c_Multi_Transport) {
         for (size_t j = j0; j < j1; j++) {
@@ -577,6 +926,27 @@ void StFlow::updateTransport(doublereal* x, size_t j0, size_t j1)
             }
         }
     }
+
+    // turbulent viscosity at the grid points, and turbulent conductivity and
+    // eddy diffusivity at the midpoints, from the TKE and epsilon profiles
+    // or, if the k-epsilon equations are solved, from the solution
+    if (m_do_turbulence) {
+        for (size_t j = j0; j <= j1; j++) {
+            m_TKE[j] = std::max(K(x,j), 0.0);
+            m_ED[j] = std::max(Eps(x,j), 0.0);
+        }
+    }
+    for (size_t j = j0; j <= j1; j++) {
+        viscTurb[j] = (m_ED[j] > 0.0) ?
+            m_rho[j]*C_mu*m_TKE[j]*m_TKE[j]/m_ED[j] : 0.0;
+    }
+    for (size_t j = j0; j < j1; j++) {
+        doublereal tke = 0.5*(m_TKE[j] + m_TKE[j+1]);
+        doublereal ed = 0.5*(m_ED[j] + m_ED[j+1]);
+        doublereal nut = (ed > 0.0) ? C_mu*tke*tke/ed : 0.0;
+        m_tconTurb[j] = m_cp[j]*m_rho[j]*nut/Pr_turb;
+        m_diffTurb[j] = nut/Sc_turb;
+    }
 }
 
 void StFlow::showSolution(const doublereal* x)
@@ -658,7 +1028,7 @@ void StFlow::updateDiffFluxes(const doublereal* x, size_t j0, size_t j1)
 
             for (k = 0; k < m_nsp; k++) {
 
-                m_flux(k,j) =  m_wt[k]*(rho*((m_diff[k+m_nsp*j])+((0.09*m_TKE*m_TKE)/(0.7*m_ED)))/wtm);
+                m_flux(k,j) = m_wt[k]*(rho*(m_diff[k+m_nsp*j] + m_diffTurb[j])/wtm);
                 //m_flux(k,j) = m_wt[k]*(rho*m_diff[k+m_nsp*j]/wtm);
                 m_flux(k,j) *= (X(x,k,j) - X(x,k,j+1))/dz;
                 sum -= m_flux(k,j);
@@ -680,7 +1050,7 @@ void StFlow::updateDiffFluxes(const doublereal* x, size_t j0, size_t j1)
                     sum += m_wt[m] * m_multidiff[mindex(k,m,j)] * (X(x,m,j+1)-X(x,m,j));
                 }
 
-                m_flux(k,j) = sum * ((m_diff[k+j*m_nsp])+((0.09*m_TKE*m_TKE)/(0.7*m_ED))) / dz;
+                m_flux(k,j) = sum * (m_diff[k+j*m_nsp] + m_diffTurb[j]) / dz;
 				//m_flux(k, j) = sum * m_diff[k + j*m_nsp] / dz;           
 			}
         }
@@ -714,6 +1084,10 @@ string StFlow::componentName(size_t n) const
         return "lambda";
 	case 4:
 		return "T_Prime";
+    case c_offset_K:
+        return "TKE";
+    case c_offset_E:
+        return "ED";
     default:
         if (n >= c_offset_Y && n < (c_offset_Y + m_nsp)) {
             return m_thermo->speciesName(n - c_offset_Y);
@@ -735,6 +1109,10 @@ size_t StFlow::componentIndex(const std::string& name) const
         return 3;
     } else if (name=="T_Prime") {
         return 4;
+    } else if (name=="TKE") {
+        return c_offset_K;
+    } else if (name=="ED") {
+        return c_offset_E;
     } else {
         for (size_t n=c_offset_Y; n<m_nsp+c_offset_Y; n++) {
             if (componentName(n)==name) {
@@ -770,6 +1148,7 @@ void StFlow::restore(const XML_Node& dom, doublereal* soln, int loglevel)
     size_t n, np = 0, j, ks, k;
     string nm;
     bool readgrid = false, wrote_header = false;
+    bool did_tke = false, did_ed = false;
     for (n = 0; n < nd; n++) {
         const XML_Node& fa = *d[n];
         nm = fa["title"];
@@ -844,6 +1223,28 @@ void StFlow::restore(const XML_Node& dom, doublereal* soln, int loglevel)
             for (j = 0; j < np; j++) {
                 soln[index(3,j)] = x[j];
             }
+        } else if (nm == "TKE" || nm == "ED") {
+            debuglog(nm+"   ", loglevel >= 2);
+            if (x.size() != np) {
+                throw CanteraError("StFlow::restore",
+                                   "{} array size error", nm);
+            }
+            size_t nc = (nm == "TKE") ? c_offset_K : c_offset_E;
+            vector_fp zz(np);
+            for (j = 0; j < np; j++) {
+                soln[index(nc,j)] = x[j];
+                zz[j] = (grid(j) - zmin())/(zmax() - zmin());
+            }
+
+            // Also use the imported profile when the k-epsilon equations
+            // are disabled
+            if (nc == c_offset_K) {
+                setTKEProfile(zz, x);
+                did_tke = true;
+            } else {
+                setEDProfile(zz, x);
+                did_ed = true;
+            }
         } else if (m_thermo->speciesIndex(nm) != npos) {
             debuglog(nm+"   ", loglevel >= 2);
             if (x.size() == np) {
@@ -858,6 +1259,17 @@ void StFlow::restore(const XML_Node& dom, doublereal* soln, int loglevel)
         }
     }
 
+    // Solutions saved before the k-epsilon equations were added have no
+    // TKE or ED data. Start those components from the current profiles.
+    for (j = 0; j < np; j++) {
+        if (!did_tke) {
+            soln[index(c_offset_K,j)] = m_TKE[j];
+        }
+        if (!did_ed) {
+            soln[index(c_offset_E,j)] = m_ED[j];
+        }
+    }
+
     if (loglevel >=2 && !ignored.empty()) {
         writelog("\n\n");
         writelog("Ignoring datasets:\n");
@@ -893,6 +1305,10 @@ void StFlow::restore(const XML_Node& dom, doublereal* soln, int loglevel)
         }
     }
 
+    if (dom.hasChild("turbulence_enabled")) {
+        solveTurbulence(getFloat(dom, "turbulence_enabled") != 0.0);
+    }
+
     if (dom.hasChild("species_enabled")) {
         getFloatArray(dom, x, false, "", "species_enabled");
         if (x.size() == m_nsp) {
@@ -953,6 +1369,12 @@ XML_Node& StFlow::save(XML_Node& o, const doublereal* const sol)
     soln.getRow(3, x.data());
     addFloatArray(gv,"L",x.size(),x.data(),"N/m^4");
 
+    soln.getRow(c_offset_K, x.data());
+    addFloatArray(gv,"TKE",x.size(),x.data(),"m^2/s^2");
+
+    soln.getRow(c_offset_E, x.data());
+    addFloatArray(gv,"ED",x.size(),x.data(),"m^2/s^3");
+
     for (k = 0; k < m_nsp; k++) {
         soln.getRow(c_offset_Y+k, x.data());
         addFloatArray(gv,m_thermo->speciesName(k),
@@ -969,6 +1391,7 @@ XML_Node& StFlow::save(XML_Node& o, const doublereal* const sol)
     }
 
     addNamedFloatArray(flow, "energy_enabled", nPoints(), &values[0]);
+    addFloat(flow, "turbulence_enabled", m_do_turbulence);
 
     values.resize(m_nsp);
     for (size_t i = 0; i < m_nsp; i++) {
@@ -1003,6 +1426,8 @@ void AxiStagnFlow::evalRightBoundary(doublereal* x, doublereal* rsd,
     rsd[index(1,j)] = V(x,j);
     rsd[index(2,j)] = T(x,j);
 	rsd[index(c_offset_TT,j)] = TT(x,j);
+    rsd[index(c_offset_K,j)] = K(x,j);
+    rsd[index(c_offset_E,j)] = Eps(x,j);
     rsd[index(c_offset_L, j)] = lambda(x,j) - lambda(x,j-1);
     diag[index(c_offset_L, j)] = 0;
     doublereal sum = 0.0;
@@ -1059,6 +1484,8 @@ void FreeFlame::evalRightBoundary(doublereal* x, doublereal* rsd,
     rsd[index(1,j)] = V(x,j);
     rsd[index(2,j)] = T(x,j) - T(x,j-1);
 	rsd[index(c_offset_TT,j)] = TT(x,j) - TT(x,j-1);
+    rsd[index(c_offset_K,j)] = K(x,j) - K(x,j-1);
+    rsd[index(c_offset_E,j)] = Eps(x,j) - Eps(x,j-1);
     doublereal sum = 0.0;
     rsd[index(c_offset_L, j)] = lambda(x,j) - lambda(x,j-1);
     diag[index(c_offset_L, j)] = 0;
@@ -0,0 +1,112 @@
+//! @file ThreadPool.cpp Implementation file for class ThreadPool
+
+#include "cantera/oneD/ThreadPool.h"
+
+using namespace std;
+
+namespace Cantera
+{
+
+ThreadPool::ThreadPool(size_t nThreads) :
+    m_func(0),
+    m_begin(0),
+    m_end(0),
+    m_blockSize(0),
+    m_generation(0),
+    m_pending(0),
+    m_stop(false)
+{
+    for (size_t i = 1; i < nThreads; i++) {
+        m_threads.emplace_back(&ThreadPool::work, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        unique_lock<mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_start.notify_all();
+    for (auto& t : m_threads) {
+        t.join();
+    }
+}
+
+void ThreadPool::parallelFor(size_t begin, size_t end,
+                             const function<void(size_t, size_t, size_t)>& f)
+{
+    if (end <= begin) {
+        return;
+    }
+    size_t n = end - begin;
+    size_t blockSize = (n + size() - 1) / size();
+    if (m_threads.empty() || blockSize == n) {
+        f(begin, end, 0);
+        return;
+    }
+
+    {
+        unique_lock<mutex> lock(m_mutex);
+        m_func = &f;
+        m_begin = begin;
+        m_end = end;
+        m_blockSize = blockSize;
+        m_pending = m_threads.size();
+        m_error = nullptr;
+        m_generation++;
+    }
+    m_start.notify_all();
+
+    runBlock(0);
+
+    unique_lock<mutex> lock(m_mutex);
+    m_done.wait(lock, [this] { return m_pending == 0; });
+    m_func = 0;
+    if (m_error) {
+        exception_ptr err = m_error;
+        m_error = nullptr;
+        rethrow_exception(err);
+    }
+}
+
+void ThreadPool::work(size_t thread)
+{
+    size_t generation = 0;
+    while (true) {
+        {
+            unique_lock<mutex> lock(m_mutex);
+            m_start.wait(lock, [&] {
+                return m_stop || m_generation != generation;
+            });
+            if (m_stop) {
+                return;
+            }
+            generation = m_generation;
+        }
+        runBlock(thread);
+        unique_lock<mutex> lock(m_mutex);
+        if (--m_pending == 0) {
+            m_done.notify_one();
+        }
+    }
+}
+
+void ThreadPool::runBlock(size_t thread)
+{
+    size_t i0 = m_begin + thread * m_blockSize;
+    size_t i1 = std::min(i0 + m_blockSize, m_end);
+    if (i0 >= i1) {
+        return;
+    }
+    try {
+        (*m_func)(i0, i1, thread);
+    } catch (...) {
+        unique_lock<mutex> lock(m_mutex);
+        if (!m_error) {
+            m_error = current_exception();
+        }
+    }
+}
+
+}
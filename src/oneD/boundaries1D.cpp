@@ -195,6 +195,13 @@ void Inlet1D::eval(size_t jg, doublereal* xg, doublereal* rg,
         // flow rate.
         rb[3] += x[0];
 
+        // The flow domain sets k and epsilon to their values at point 0 if
+        // the k-epsilon equations are enabled.
+        if (m_flow->turbulenceEnabled()) {
+            rb[c_offset_K] -= m_tke;
+            rb[c_offset_E] -= m_ed;
+        }
+
         // add the convective term to the species residual equations
         for (size_t k = 1; k < m_nsp; k++) {
             rb[c_offset_Y+k] += x[0]*m_yin[k];
@@ -216,6 +223,10 @@ void Inlet1D::eval(size_t jg, doublereal* xg, doublereal* rg,
         rb[2] -= x[1]; // T
 		rb[4] -= x[2]; // T'
         rb[0] += x[0]; // u
+        if (m_flow->turbulenceEnabled()) {
+            rb[c_offset_K] -= m_tke;
+            rb[c_offset_E] -= m_ed;
+        }
         for (size_t k = 1; k < m_nsp; k++) {
             rb[c_offset_Y+k] += x[0]*m_yin[k];
         }
@@ -230,6 +241,8 @@ XML_Node& Inlet1D::save(XML_Node& o, const doublereal* const soln)
     for (size_t k = 0; k < nComponents(); k++) {
         addFloat(inlt, componentName(k), s[k]);
     }
+    addFloat(inlt, "TKE", m_tke, "m^2/s^2");
+    addFloat(inlt, "ED", m_ed, "m^2/s^3");
     for (size_t k=0; k < m_nsp; k++) {
         addFloat(inlt, "massFraction", m_yin[k], "",
                        m_flow->phase().speciesName(k));
@@ -242,6 +255,8 @@ void Inlet1D::restore(const XML_Node& dom, doublereal* soln, int loglevel)
     Domain1D::restore(dom, soln, loglevel);
     soln[0] = m_mdot = getFloat(dom, "mdot", "massflowrate");
     soln[1] = m_temp = getFloat(dom, "temperature", "temperature");
+    getOptionalFloat(dom, "TKE", m_tke);
+    getOptionalFloat(dom, "ED", m_ed);
 
     m_yin.assign(m_nsp, 0.0);
 
@@ -358,6 +373,10 @@ void Symm1D::eval(size_t jg, doublereal* xg, doublereal* rg, integer* diagg,
         db[2] = 0;
         rb[1] = xb[1] - xb[1 + nc]; // zero dV/dz
         rb[2] = xb[2] - xb[2 + nc]; // zero dT/dz
+        if (m_flow_right->turbulenceEnabled()) {
+            rb[c_offset_K] = xb[c_offset_K] - xb[c_offset_K + nc];
+            rb[c_offset_E] = xb[c_offset_E] - xb[c_offset_E + nc];
+        }
     }
 
     if (m_flow_left) {
@@ -369,6 +388,10 @@ void Symm1D::eval(size_t jg, doublereal* xg, doublereal* rg, integer* diagg,
         db[2] = 0;
         rb[1] = xb[1] - xb[1 - nc]; // zero dV/dz
         rb[2] = xb[2] - xb[2 - nc]; // zero dT/dz
+        if (m_flow_left->turbulenceEnabled()) {
+            rb[c_offset_K] = xb[c_offset_K] - xb[c_offset_K - nc];
+            rb[c_offset_E] = xb[c_offset_E] - xb[c_offset_E - nc];
+        }
     }
 }
 
@@ -439,6 +462,10 @@ void Outlet1D::eval(size_t jg, doublereal* xg, doublereal* rg, integer* diagg,
         db = diag + 1;
         rb[0] = xb[3];
         rb[2] = xb[2] - xb[2 + nc];
+        if (m_flow_right->turbulenceEnabled()) {
+            rb[c_offset_K] = xb[c_offset_K] - xb[c_offset_K + nc];
+            rb[c_offset_E] = xb[c_offset_E] - xb[c_offset_E + nc];
+        }
         for (k = c_offset_Y; k < nc; k++) {
             rb[k] = xb[k] - xb[k + nc];
         }
@@ -456,7 +483,11 @@ void Outlet1D::eval(size_t jg, doublereal* xg, doublereal* rg, integer* diagg,
         }
 
         rb[2] = xb[2] - xb[2 - nc]; // zero T gradient
-        for (k = 5; k < nc; k++) {
+        if (m_flow_left->turbulenceEnabled()) {
+            rb[c_offset_K] = xb[c_offset_K] - xb[c_offset_K - nc];
+            rb[c_offset_E] = xb[c_offset_E] - xb[c_offset_E - nc];
+        }
+        for (k = c_offset_Y; k < nc; k++) {
             rb[k] = xb[k] - xb[k - nc]; // zero mass fraction gradient
             db[k] = 0;
         }
@@ -567,6 +598,12 @@ void OutletRes1D::eval(size_t jg, doublereal* xg, doublereal* rg,
         // zero gradient for T
         rb[2] = xb[2] - xb[2 + nc];
 
+        // zero gradient for k and epsilon
+        if (m_flow_right->turbulenceEnabled()) {
+            rb[c_offset_K] = xb[c_offset_K] - xb[c_offset_K + nc];
+            rb[c_offset_E] = xb[c_offset_E] - xb[c_offset_E + nc];
+        }
+
         // specified mass fractions
         for (k = c_offset_Y; k < nc; k++) {
             rb[k] = xb[k] - m_yres[k-c_offset_Y];
@@ -585,7 +622,11 @@ void OutletRes1D::eval(size_t jg, doublereal* xg, doublereal* rg,
             rb[0] = xb[3]; // zero Lambda
         }
         rb[2] = xb[2] - m_temp; // zero dT/dz
-        for (k = 5; k < nc; k++) {
+        if (m_flow_left->turbulenceEnabled()) {
+            rb[c_offset_K] = xb[c_offset_K] - xb[c_offset_K - nc];
+            rb[c_offset_E] = xb[c_offset_E] - xb[c_offset_E - nc];
+        }
+        for (k = c_offset_Y; k < nc; k++) {
             rb[k] = xb[k] - m_yres[k-c_offset_Y]; // fixed Y
             db[k] = 0;
         }
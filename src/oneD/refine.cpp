@@ -68,6 +68,10 @@ int Refiner::analyze(size_t n, const doublereal* z,
     // find locations where cell size ratio is too large.
     vector_fp v(n), s(n-1);
 
+    // points which may be removed without violating the refinement criteria
+    // by more than the fraction 'prune'
+    std::vector<bool> removable(n, true);
+
     vector_fp dz(n-1);
     for (size_t j = 0; j < n-1; j++) {
         dz[j] = z[j+1] - z[j];
@@ -110,11 +114,14 @@ int Refiner::analyze(size_t n, const doublereal* z,
                         m_loc[j] = 1;
                         m_c[name] = 1;
                     }
-                    if (r >= m_prune) {
-                        m_keep[j] = 1;
-                        m_keep[j+1] = 1;
-                    } else if (m_keep[j] == 0) {
-                        m_keep[j] = -1;
+                }
+
+                // the value may change across the interval formed by removing
+                // point j by only a fraction 'prune' of its range
+                doublereal dprune = m_prune*(vmax - vmin) + m_thresh;
+                for (size_t j = 1; j < n-1; j++) {
+                    if (fabs(v[j+1] - v[j-1]) > dprune) {
+                        removable[j] = false;
                     }
                 }
             }
@@ -135,10 +142,19 @@ int Refiner::analyze(size_t n, const doublereal* z,
                         m_loc[j] = 1;
                         m_loc[j+1] = 1;
                     }
-                    if (r >= m_prune) {
-                        m_keep[j+1] = 1;
-                    } else if (m_keep[j+1] == 0) {
-                        m_keep[j+1] = -1;
+                }
+
+                // the slope of the interval formed by removing point j may
+                // differ from the slopes of the adjacent intervals, and the
+                // slopes on either side of point j from each other, by only a
+                // fraction 'prune' of the range of slopes
+                dmax = m_prune*(smax - smin);
+                for (size_t j = 1; j < n-1; j++) {
+                    doublereal sj = (v[j+1] - v[j-1])/(z[j+1] - z[j-1]);
+                    if (fabs(s[j] - s[j-1]) > dmax + m_thresh/dz[j-1] ||
+                        (j > 1 && fabs(sj - s[j-2]) > dmax + m_thresh/dz[j-2]) ||
+                        (j < n-2 && fabs(s[j+1] - sj) > dmax + m_thresh/dz[j+1])) {
+                        removable[j] = false;
                     }
                 }
             }
@@ -187,11 +203,17 @@ int Refiner::analyze(size_t n, const doublereal* z,
         }
     }
 
-    // Don't allow pruning to remove multiple adjacent grid points
-    // in a single pass.
-    for (size_t j = 2; j < n-1; j++) {
-        if (m_keep[j] == -1 && m_keep[j-1] == -1) {
-            m_keep[j] = 1;
+    // Points are only removed if no new points are needed in this domain, so
+    // that points are not removed and inserted in the same pass. At least
+    // two points are kept between removed points, so that the tests above,
+    // which consider the neighbors of each point, remain valid after removal.
+    if (m_loc.empty() && m_prune > 0.0) {
+        size_t last = 0;
+        for (size_t j = 1; j < n-1; j++) {
+            if (removable[j] && m_keep[j] != 1 && (last == 0 || j > last + 2)) {
+                m_keep[j] = -1;
+                last = j;
+            }
         }
     }
 
@@ -67,6 +67,7 @@ HMWSoln::HMWSoln() :
     CROP_ln_gamma_k_min(-5.0),
     CROP_ln_gamma_k_max(15.0),
     m_last_is(-1.0),
+    m_lastPitzerCoeffT(-1.0),
     m_debugCalc(0)
 {
 }
@@ -112,6 +113,7 @@ HMWSoln::HMWSoln(const std::string& inputFile, const std::string& id_) :
     CROP_ln_gamma_k_min(-5.0),
     CROP_ln_gamma_k_max(15.0),
     m_last_is(-1.0),
+    m_lastPitzerCoeffT(-1.0),
     m_debugCalc(0)
 {
     initThermoFile(inputFile, id_);
@@ -158,6 +160,7 @@ HMWSoln::HMWSoln(XML_Node& phaseRoot, const std::string& id_) :
     CROP_ln_gamma_k_min(-5.0),
     CROP_ln_gamma_k_max(15.0),
     m_last_is(-1.0),
+    m_lastPitzerCoeffT(-1.0),
     m_debugCalc(0)
 {
     importPhase(phaseRoot, this);
@@ -204,6 +207,7 @@ HMWSoln::HMWSoln(const HMWSoln& b) :
     CROP_ln_gamma_k_min(-5.0),
     CROP_ln_gamma_k_max(15.0),
     m_last_is(-1.0),
+    m_lastPitzerCoeffT(-1.0),
     m_debugCalc(0)
 {
     // Use the assignment operator to do the brunt of the work for the copy
@@ -298,6 +302,11 @@ HMWSoln& HMWSoln::operator=(const HMWSoln& b)
         m_molalitiesCropped = b.m_molalitiesCropped;
         m_molalitiesAreCropped = b.m_molalitiesAreCropped;
         m_CounterIJ = b.m_CounterIJ;
+        m_PitzerPairList = b.m_PitzerPairList;
+        m_LambdaList = b.m_LambdaList;
+        m_PsiList = b.m_PsiList;
+        m_PsiSum = b.m_PsiSum;
+        m_lastPitzerCoeffT = -1.0;
         m_gfunc_IJ = b.m_gfunc_IJ;
         m_g2func_IJ = b.m_g2func_IJ;
         m_hfunc_IJ = b.m_hfunc_IJ;
@@ -916,6 +925,7 @@ void HMWSoln::initLengths()
     m_Psi_ijk_LL.resize(n, 0.0);
     m_Psi_ijk_P.resize(n, 0.0);
     m_Psi_ijk_coeff.resize(TCoeffLength, n, 0.0);
+    m_PsiSum.resize(m_kk, 0.0);
 
     m_Lambda_nj.resize(m_kk, m_kk, 0.0);
     m_Lambda_nj_L.resize(m_kk, m_kk, 0.0);
@@ -1221,6 +1231,12 @@ void HMWSoln::counterIJ_setup() const
 void HMWSoln::s_updatePitzer_CoeffWRTemp(int doDerivs) const
 {
     double T = temperature();
+    if (T == m_lastPitzerCoeffT) {
+        // The coefficients only depend on temperature. Nothing has changed
+        // since the last call.
+        return;
+    }
+    m_lastPitzerCoeffT = T;
     const double twoT = 2.0 * T;
     const double invT = 1.0 / T;
     const double invT2 = invT * invT;
@@ -1235,235 +1251,264 @@ void HMWSoln::s_updatePitzer_CoeffWRTemp(int doDerivs) const
         tinv = 1.0/T - 1.0/m_TempPitzerRef;
     }
 
-    for (size_t i = 1; i < (m_kk - 1); i++) {
-        for (size_t j = (i+1); j < m_kk; j++) {
-            // Find the counterIJ for the symmetric binary interaction
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-
-            const double* beta0MX_coeff = m_Beta0MX_ij_coeff.ptrColumn(counterIJ);
-            const double* beta1MX_coeff = m_Beta1MX_ij_coeff.ptrColumn(counterIJ);
-            const double* beta2MX_coeff = m_Beta2MX_ij_coeff.ptrColumn(counterIJ);
-            const double* CphiMX_coeff = m_CphiMX_ij_coeff.ptrColumn(counterIJ);
-            const double* Theta_coeff = m_Theta_ij_coeff.ptrColumn(counterIJ);
-
+    // Only the binary interactions with nonzero coefficients are visited. The
+    // coefficients of all other pairs are identically zero.
+    for (size_t counterIJ : m_PitzerPairList) {
+        const double* beta0MX_coeff = m_Beta0MX_ij_coeff.ptrColumn(counterIJ);
+        const double* beta1MX_coeff = m_Beta1MX_ij_coeff.ptrColumn(counterIJ);
+        const double* beta2MX_coeff = m_Beta2MX_ij_coeff.ptrColumn(counterIJ);
+        const double* CphiMX_coeff = m_CphiMX_ij_coeff.ptrColumn(counterIJ);
+        const double* Theta_coeff = m_Theta_ij_coeff.ptrColumn(counterIJ);
+
+        switch (m_formPitzerTemp) {
+        case PITZER_TEMP_CONSTANT:
+            break;
+        case PITZER_TEMP_LINEAR:
+
+            m_Beta0MX_ij[counterIJ] = beta0MX_coeff[0]
+                                      + beta0MX_coeff[1]*tlin;
+            m_Beta0MX_ij_L[counterIJ] = beta0MX_coeff[1];
+            m_Beta0MX_ij_LL[counterIJ] = 0.0;
+            m_Beta1MX_ij[counterIJ] = beta1MX_coeff[0]
+                                        + beta1MX_coeff[1]*tlin;
+            m_Beta1MX_ij_L[counterIJ] = beta1MX_coeff[1];
+            m_Beta1MX_ij_LL[counterIJ] = 0.0;
+            m_Beta2MX_ij[counterIJ] = beta2MX_coeff[0]
+                                         + beta2MX_coeff[1]*tlin;
+            m_Beta2MX_ij_L[counterIJ] = beta2MX_coeff[1];
+            m_Beta2MX_ij_LL[counterIJ] = 0.0;
+            m_CphiMX_ij[counterIJ] = CphiMX_coeff[0]
+                                         + CphiMX_coeff[1]*tlin;
+            m_CphiMX_ij_L[counterIJ] = CphiMX_coeff[1];
+            m_CphiMX_ij_LL[counterIJ] = 0.0;
+            m_Theta_ij[counterIJ] = Theta_coeff[0] + Theta_coeff[1]*tlin;
+            m_Theta_ij_L[counterIJ] = Theta_coeff[1];
+            m_Theta_ij_LL[counterIJ] = 0.0;
+            break;
+
+        case PITZER_TEMP_COMPLEX1:
+            m_Beta0MX_ij[counterIJ] = beta0MX_coeff[0]
+                                      + beta0MX_coeff[1]*tlin
+                                      + beta0MX_coeff[2]*tquad
+                                      + beta0MX_coeff[3]*tinv
+                                      + beta0MX_coeff[4]*tln;
+            m_Beta1MX_ij[counterIJ] = beta1MX_coeff[0]
+                                      + beta1MX_coeff[1]*tlin
+                                      + beta1MX_coeff[2]*tquad
+                                      + beta1MX_coeff[3]*tinv
+                                      + beta1MX_coeff[4]*tln;
+            m_Beta2MX_ij[counterIJ] = beta2MX_coeff[0]
+                                      + beta2MX_coeff[1]*tlin
+                                      + beta2MX_coeff[2]*tquad
+                                      + beta2MX_coeff[3]*tinv
+                                      + beta2MX_coeff[4]*tln;
+            m_CphiMX_ij[counterIJ] = CphiMX_coeff[0]
+                                     + CphiMX_coeff[1]*tlin
+                                     + CphiMX_coeff[2]*tquad
+                                     + CphiMX_coeff[3]*tinv
+                                     + CphiMX_coeff[4]*tln;
+            m_Theta_ij[counterIJ] = Theta_coeff[0]
+                                    + Theta_coeff[1]*tlin
+                                    + Theta_coeff[2]*tquad
+                                    + Theta_coeff[3]*tinv
+                                    + Theta_coeff[4]*tln;
+            m_Beta0MX_ij_L[counterIJ] = beta0MX_coeff[1]
+                                         + beta0MX_coeff[2]*twoT
+                                         - beta0MX_coeff[3]*invT2
+                                         + beta0MX_coeff[4]*invT;
+            m_Beta1MX_ij_L[counterIJ] = beta1MX_coeff[1]
+                                         + beta1MX_coeff[2]*twoT
+                                         - beta1MX_coeff[3]*invT2
+                                         + beta1MX_coeff[4]*invT;
+            m_Beta2MX_ij_L[counterIJ] = beta2MX_coeff[1]
+                                         + beta2MX_coeff[2]*twoT
+                                         - beta2MX_coeff[3]*invT2
+                                         + beta2MX_coeff[4]*invT;
+            m_CphiMX_ij_L[counterIJ] = CphiMX_coeff[1]
+                                        + CphiMX_coeff[2]*twoT
+                                        - CphiMX_coeff[3]*invT2
+                                        + CphiMX_coeff[4]*invT;
+            m_Theta_ij_L[counterIJ] = Theta_coeff[1]
+                                        + Theta_coeff[2]*twoT
+                                        - Theta_coeff[3]*invT2
+                                        + Theta_coeff[4]*invT;
+            doDerivs = 2;
+            if (doDerivs > 1) {
+                m_Beta0MX_ij_LL[counterIJ] =
+                    + beta0MX_coeff[2]*2.0
+                    + beta0MX_coeff[3]*twoinvT3
+                    - beta0MX_coeff[4]*invT2;
+                m_Beta1MX_ij_LL[counterIJ] =
+                    + beta1MX_coeff[2]*2.0
+                    + beta1MX_coeff[3]*twoinvT3
+                    - beta1MX_coeff[4]*invT2;
+                m_Beta2MX_ij_LL[counterIJ] =
+                    + beta2MX_coeff[2]*2.0
+                    + beta2MX_coeff[3]*twoinvT3
+                    - beta2MX_coeff[4]*invT2;
+                m_CphiMX_ij_LL[counterIJ] =
+                    + CphiMX_coeff[2]*2.0
+                    + CphiMX_coeff[3]*twoinvT3
+                    - CphiMX_coeff[4]*invT2;
+                m_Theta_ij_LL[counterIJ] =
+                    + Theta_coeff[2]*2.0
+                    + Theta_coeff[3]*twoinvT3
+                    - Theta_coeff[4]*invT2;
+            }
+            break;
+        }
+    }
+
+    // Lambda interactions. i must be neutral for this term to be nonzero.
+    for (size_t n : m_LambdaList) {
+        size_t i = n / m_kk;
+        size_t j = n % m_kk;
+        const double* Lambda_coeff = m_Lambda_nj_coeff.ptrColumn(n);
+        switch (m_formPitzerTemp) {
+        case PITZER_TEMP_CONSTANT:
+            m_Lambda_nj(i,j) = Lambda_coeff[0];
+            break;
+        case PITZER_TEMP_LINEAR:
+            m_Lambda_nj(i,j) = Lambda_coeff[0] + Lambda_coeff[1]*tlin;
+            m_Lambda_nj_L(i,j) = Lambda_coeff[1];
+            m_Lambda_nj_LL(i,j) = 0.0;
+            break;
+        case PITZER_TEMP_COMPLEX1:
+            m_Lambda_nj(i,j) = Lambda_coeff[0]
+                               + Lambda_coeff[1]*tlin
+                               + Lambda_coeff[2]*tquad
+                               + Lambda_coeff[3]*tinv
+                               + Lambda_coeff[4]*tln;
+
+            m_Lambda_nj_L(i,j) = Lambda_coeff[1]
+                                 + Lambda_coeff[2]*twoT
+                                 - Lambda_coeff[3]*invT2
+                                 + Lambda_coeff[4]*invT;
+
+            m_Lambda_nj_LL(i,j) =
+                Lambda_coeff[2]*2.0
+                + Lambda_coeff[3]*twoinvT3
+                - Lambda_coeff[4]*invT2;
+        }
+    }
+
+    // Mu_nnn interactions for the neutral species
+    for (size_t i = 1; i < m_kk; i++) {
+        if (charge(i) == 0.0) {
+            const double* Mu_coeff = m_Mu_nnn_coeff.ptrColumn(i);
             switch (m_formPitzerTemp) {
             case PITZER_TEMP_CONSTANT:
+                m_Mu_nnn[i] = Mu_coeff[0];
                 break;
             case PITZER_TEMP_LINEAR:
-
-                m_Beta0MX_ij[counterIJ] = beta0MX_coeff[0]
-                                          + beta0MX_coeff[1]*tlin;
-                m_Beta0MX_ij_L[counterIJ] = beta0MX_coeff[1];
-                m_Beta0MX_ij_LL[counterIJ] = 0.0;
-                m_Beta1MX_ij[counterIJ] = beta1MX_coeff[0]
-                                            + beta1MX_coeff[1]*tlin;
-                m_Beta1MX_ij_L[counterIJ] = beta1MX_coeff[1];
-                m_Beta1MX_ij_LL[counterIJ] = 0.0;
-                m_Beta2MX_ij[counterIJ] = beta2MX_coeff[0]
-                                             + beta2MX_coeff[1]*tlin;
-                m_Beta2MX_ij_L[counterIJ] = beta2MX_coeff[1];
-                m_Beta2MX_ij_LL[counterIJ] = 0.0;
-                m_CphiMX_ij[counterIJ] = CphiMX_coeff[0]
-                                             + CphiMX_coeff[1]*tlin;
-                m_CphiMX_ij_L[counterIJ] = CphiMX_coeff[1];
-                m_CphiMX_ij_LL[counterIJ] = 0.0;
-                m_Theta_ij[counterIJ] = Theta_coeff[0] + Theta_coeff[1]*tlin;
-                m_Theta_ij_L[counterIJ] = Theta_coeff[1];
-                m_Theta_ij_LL[counterIJ] = 0.0;
+                m_Mu_nnn[i] = Mu_coeff[0] + Mu_coeff[1]*tlin;
+                m_Mu_nnn_L[i] = Mu_coeff[1];
+                m_Mu_nnn_LL[i] = 0.0;
                 break;
-
             case PITZER_TEMP_COMPLEX1:
-                m_Beta0MX_ij[counterIJ] = beta0MX_coeff[0]
-                                          + beta0MX_coeff[1]*tlin
-                                          + beta0MX_coeff[2]*tquad
-                                          + beta0MX_coeff[3]*tinv
-                                          + beta0MX_coeff[4]*tln;
-                m_Beta1MX_ij[counterIJ] = beta1MX_coeff[0]
-                                          + beta1MX_coeff[1]*tlin
-                                          + beta1MX_coeff[2]*tquad
-                                          + beta1MX_coeff[3]*tinv
-                                          + beta1MX_coeff[4]*tln;
-                m_Beta2MX_ij[counterIJ] = beta2MX_coeff[0]
-                                          + beta2MX_coeff[1]*tlin
-                                          + beta2MX_coeff[2]*tquad
-                                          + beta2MX_coeff[3]*tinv
-                                          + beta2MX_coeff[4]*tln;
-                m_CphiMX_ij[counterIJ] = CphiMX_coeff[0]
-                                         + CphiMX_coeff[1]*tlin
-                                         + CphiMX_coeff[2]*tquad
-                                         + CphiMX_coeff[3]*tinv
-                                         + CphiMX_coeff[4]*tln;
-                m_Theta_ij[counterIJ] = Theta_coeff[0]
-                                        + Theta_coeff[1]*tlin
-                                        + Theta_coeff[2]*tquad
-                                        + Theta_coeff[3]*tinv
-                                        + Theta_coeff[4]*tln;
-                m_Beta0MX_ij_L[counterIJ] = beta0MX_coeff[1]
-                                             + beta0MX_coeff[2]*twoT
-                                             - beta0MX_coeff[3]*invT2
-                                             + beta0MX_coeff[4]*invT;
-                m_Beta1MX_ij_L[counterIJ] = beta1MX_coeff[1]
-                                             + beta1MX_coeff[2]*twoT
-                                             - beta1MX_coeff[3]*invT2
-                                             + beta1MX_coeff[4]*invT;
-                m_Beta2MX_ij_L[counterIJ] = beta2MX_coeff[1]
-                                             + beta2MX_coeff[2]*twoT
-                                             - beta2MX_coeff[3]*invT2
-                                             + beta2MX_coeff[4]*invT;
-                m_CphiMX_ij_L[counterIJ] = CphiMX_coeff[1]
-                                            + CphiMX_coeff[2]*twoT
-                                            - CphiMX_coeff[3]*invT2
-                                            + CphiMX_coeff[4]*invT;
-                m_Theta_ij_L[counterIJ] = Theta_coeff[1]
-                                            + Theta_coeff[2]*twoT
-                                            - Theta_coeff[3]*invT2
-                                            + Theta_coeff[4]*invT;
-                doDerivs = 2;
-                if (doDerivs > 1) {
-                    m_Beta0MX_ij_LL[counterIJ] =
-                        + beta0MX_coeff[2]*2.0
-                        + beta0MX_coeff[3]*twoinvT3
-                        - beta0MX_coeff[4]*invT2;
-                    m_Beta1MX_ij_LL[counterIJ] =
-                        + beta1MX_coeff[2]*2.0
-                        + beta1MX_coeff[3]*twoinvT3
-                        - beta1MX_coeff[4]*invT2;
-                    m_Beta2MX_ij_LL[counterIJ] =
-                        + beta2MX_coeff[2]*2.0
-                        + beta2MX_coeff[3]*twoinvT3
-                        - beta2MX_coeff[4]*invT2;
-                    m_CphiMX_ij_LL[counterIJ] =
-                        + CphiMX_coeff[2]*2.0
-                        + CphiMX_coeff[3]*twoinvT3
-                        - CphiMX_coeff[4]*invT2;
-                    m_Theta_ij_LL[counterIJ] =
-                        + Theta_coeff[2]*2.0
-                        + Theta_coeff[3]*twoinvT3
-                        - Theta_coeff[4]*invT2;
-                }
-                break;
-            }
-        }
-    }
-
-    // Lambda interactions and Mu_nnn
-    // i must be neutral for this term to be nonzero. We take advantage of this
-    // here to lower the operation count.
-    for (size_t i = 1; i < m_kk; i++) {
-        if (charge(i) == 0.0) {
-            for (size_t j = 1; j < m_kk; j++) {
-                size_t n = i * m_kk + j;
-                const double* Lambda_coeff = m_Lambda_nj_coeff.ptrColumn(n);
-                switch (m_formPitzerTemp) {
-                case PITZER_TEMP_CONSTANT:
-                    m_Lambda_nj(i,j) = Lambda_coeff[0];
-                    break;
-                case PITZER_TEMP_LINEAR:
-                    m_Lambda_nj(i,j) = Lambda_coeff[0] + Lambda_coeff[1]*tlin;
-                    m_Lambda_nj_L(i,j) = Lambda_coeff[1];
-                    m_Lambda_nj_LL(i,j) = 0.0;
-                    break;
-                case PITZER_TEMP_COMPLEX1:
-                    m_Lambda_nj(i,j) = Lambda_coeff[0]
-                                       + Lambda_coeff[1]*tlin
-                                       + Lambda_coeff[2]*tquad
-                                       + Lambda_coeff[3]*tinv
-                                       + Lambda_coeff[4]*tln;
-
-                    m_Lambda_nj_L(i,j) = Lambda_coeff[1]
-                                         + Lambda_coeff[2]*twoT
-                                         - Lambda_coeff[3]*invT2
-                                         + Lambda_coeff[4]*invT;
-
-                    m_Lambda_nj_LL(i,j) =
-                        Lambda_coeff[2]*2.0
-                        + Lambda_coeff[3]*twoinvT3
-                        - Lambda_coeff[4]*invT2;
-                }
-
-                if (j == i) {
-                    const double* Mu_coeff = m_Mu_nnn_coeff.ptrColumn(i);
-                    switch (m_formPitzerTemp) {
-                    case PITZER_TEMP_CONSTANT:
-                        m_Mu_nnn[i] = Mu_coeff[0];
-                        break;
-                    case PITZER_TEMP_LINEAR:
-                        m_Mu_nnn[i] = Mu_coeff[0] + Mu_coeff[1]*tlin;
-                        m_Mu_nnn_L[i] = Mu_coeff[1];
-                        m_Mu_nnn_LL[i] = 0.0;
-                        break;
-                    case PITZER_TEMP_COMPLEX1:
-                        m_Mu_nnn[i] = Mu_coeff[0]
-                                      + Mu_coeff[1]*tlin
-                                      + Mu_coeff[2]*tquad
-                                      + Mu_coeff[3]*tinv
-                                      + Mu_coeff[4]*tln;
-                        m_Mu_nnn_L[i] = Mu_coeff[1]
-                                        + Mu_coeff[2]*twoT
-                                        - Mu_coeff[3]*invT2
-                                        + Mu_coeff[4]*invT;
-                        m_Mu_nnn_LL[i] =
-                            Mu_coeff[2]*2.0
-                            + Mu_coeff[3]*twoinvT3
-                            - Mu_coeff[4]*invT2;
-                    }
-                }
+                m_Mu_nnn[i] = Mu_coeff[0]
+                              + Mu_coeff[1]*tlin
+                              + Mu_coeff[2]*tquad
+                              + Mu_coeff[3]*tinv
+                              + Mu_coeff[4]*tln;
+                m_Mu_nnn_L[i] = Mu_coeff[1]
+                                + Mu_coeff[2]*twoT
+                                - Mu_coeff[3]*invT2
+                                + Mu_coeff[4]*invT;
+                m_Mu_nnn_LL[i] =
+                    Mu_coeff[2]*2.0
+                    + Mu_coeff[3]*twoinvT3
+                    - Mu_coeff[4]*invT2;
             }
         }
     }
 
+    // Psi interactions. Only the triplets in the sparse list are visited.
     switch(m_formPitzerTemp) {
     case PITZER_TEMP_CONSTANT:
-      for (size_t i = 1; i < m_kk; i++) {
-          for (size_t j = 1; j < m_kk; j++) {
-              for (size_t k = 1; k < m_kk; k++) {
-                  size_t n = i * m_kk *m_kk + j * m_kk + k;
-                  const double* Psi_coeff = m_Psi_ijk_coeff.ptrColumn(n);
-                  m_Psi_ijk[n] = Psi_coeff[0];
-              }
-          }
-      }
-      break;
+        for (size_t n : m_PsiList) {
+            m_Psi_ijk[n] = m_Psi_ijk_coeff(0, n);
+        }
+        break;
     case PITZER_TEMP_LINEAR:
-      for (size_t i = 1; i < m_kk; i++) {
-          for (size_t j = 1; j < m_kk; j++) {
-              for (size_t k = 1; k < m_kk; k++) {
-                  size_t n = i * m_kk *m_kk + j * m_kk + k;
-                  const double* Psi_coeff = m_Psi_ijk_coeff.ptrColumn(n);
-                  m_Psi_ijk[n] = Psi_coeff[0] + Psi_coeff[1]*tlin;
-                  m_Psi_ijk_L[n] = Psi_coeff[1];
-                  m_Psi_ijk_LL[n] = 0.0;
-              }
-          }
-      }
-      break;
+        for (size_t n : m_PsiList) {
+            const double* Psi_coeff = m_Psi_ijk_coeff.ptrColumn(n);
+            m_Psi_ijk[n] = Psi_coeff[0] + Psi_coeff[1]*tlin;
+            m_Psi_ijk_L[n] = Psi_coeff[1];
+            m_Psi_ijk_LL[n] = 0.0;
+        }
+        break;
     case PITZER_TEMP_COMPLEX1:
-      for (size_t i = 1; i < m_kk; i++) {
-          for (size_t j = 1; j < m_kk; j++) {
-              for (size_t k = 1; k < m_kk; k++) {
-                  size_t n = i * m_kk *m_kk + j * m_kk + k;
-                  const double* Psi_coeff = m_Psi_ijk_coeff.ptrColumn(n);
-                  m_Psi_ijk[n] = Psi_coeff[0]
-                                 + Psi_coeff[1]*tlin
-                                 + Psi_coeff[2]*tquad
-                                 + Psi_coeff[3]*tinv
-                                 + Psi_coeff[4]*tln;
-                  m_Psi_ijk_L[n] = Psi_coeff[1]
-                                   + Psi_coeff[2]*twoT
-                                   - Psi_coeff[3]*invT2
-                                   + Psi_coeff[4]*invT;
-                  m_Psi_ijk_LL[n] =
-                      Psi_coeff[2]*2.0
-                      + Psi_coeff[3]*twoinvT3
-                      - Psi_coeff[4]*invT2;
-              }
-          }
-      }
-      break;
+        for (size_t n : m_PsiList) {
+            const double* Psi_coeff = m_Psi_ijk_coeff.ptrColumn(n);
+            m_Psi_ijk[n] = Psi_coeff[0]
+                           + Psi_coeff[1]*tlin
+                           + Psi_coeff[2]*tquad
+                           + Psi_coeff[3]*tinv
+                           + Psi_coeff[4]*tln;
+            m_Psi_ijk_L[n] = Psi_coeff[1]
+                             + Psi_coeff[2]*twoT
+                             - Psi_coeff[3]*invT2
+                             + Psi_coeff[4]*invT;
+            m_Psi_ijk_LL[n] =
+                Psi_coeff[2]*2.0
+                + Psi_coeff[3]*twoinvT3
+                - Psi_coeff[4]*invT2;
+        }
+        break;
     }
 }
 
+double HMWSoln::s_updatePitzer_PsiSums(const vector_fp& psi,
+                                       const double* molality) const
+{
+    // The triplet list only contains the Psi and Zeta entries that show up
+    // in the activity coefficient expressions. The mapping from the triplet
+    // (i,j,k) onto the species whose activity coefficient it contributes to
+    // follows the structure of the dense loops of Pitzer's eqns. (62)-(65).
+    std::fill(m_PsiSum.begin(), m_PsiSum.end(), 0.0);
+    double sumOsmotic = 0.0;
+    const size_t kk2 = m_kk * m_kk;
+    for (size_t n : m_PsiList) {
+        double psi_ijk = psi[n];
+        size_t i = n / kk2;
+        size_t j = (n / m_kk) % m_kk;
+        size_t k = n % m_kk;
+        double zi = charge(i);
+        double zj = charge(j);
+        double zk = charge(k);
+        if (zi > 0.0) {
+            // Cation i: interactions with pairs of anions (j < k), and with a
+            // cation j and an anion k
+            if ((zj < 0.0 && zk < 0.0 && k > j) || (zj > 0.0 && zk < 0.0)) {
+                m_PsiSum[i] += molality[j]*molality[k]*psi_ijk;
+            }
+            // Osmotic coefficient: pairs of cations (i < j) with anion k
+            if (zj > 0.0 && zk < 0.0 && j > i) {
+                sumOsmotic += molality[i]*molality[j]*molality[k]*psi_ijk;
+            }
+        } else if (zi < 0.0) {
+            // Anion i: interactions with pairs of cations (j < k), and with an
+            // anion j and a cation k
+            if ((zj > 0.0 && zk > 0.0 && k > j) || (zj < 0.0 && zk > 0.0)) {
+                m_PsiSum[i] += molality[j]*molality[k]*psi_ijk;
+            }
+            // Osmotic coefficient: pairs of anions (i < j) with cation k
+            if (zj < 0.0 && zk > 0.0 && j > i) {
+                sumOsmotic += molality[i]*molality[j]*molality[k]*psi_ijk;
+            }
+        } else if (zj > 0.0 && zk < 0.0) {
+            // Zeta term for the neutral i, cation j and anion k. It
+            // contributes to all three species.
+            m_PsiSum[i] += molality[j]*molality[k]*psi_ijk;
+            m_PsiSum[j] += molality[i]*molality[k]*psi_ijk;
+            m_PsiSum[k] += molality[i]*molality[j]*psi_ijk;
+            sumOsmotic += molality[i]*molality[j]*molality[k]*psi_ijk;
+        }
+    }
+    return sumOsmotic;
+}
+
 void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
 {
     // HKM -> Assumption is made that the solvent is species 0.
@@ -1716,6 +1761,10 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
     debuglog(" Step 8: Summing in All Contributions to Activity Coefficients \n",
              m_debugCalc);
 
+    // Ternary Psi and Zeta interactions, evaluated from the sparse list
+    // of nonzero triplets
+    double sumPsi = s_updatePitzer_PsiSums(m_Psi_ijk, &molality[0]);
+
     for (size_t i = 1; i < m_kk; i++) {
 
         // SUBSECTION FOR CALCULATING THE ACTCOEFF FOR CATIONS
@@ -1751,23 +1800,6 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
                         writelogf("                                                   m_j Z CMX = %10.5f\n",
                                molality[j]* molarcharge*m_CMX_IJ[counterIJ]);
                     }
-                    if (j < m_kk-1) {
-                        // This term is the ternary interaction involving the
-                        // non-duplicate sum over double anions, j, k, with
-                        // respect to the cation, i.
-                        for (size_t k = j+1; k < m_kk; k++) {
-                            // an inner sum over all anions
-                            if (charge(k) < 0.0) {
-                                n = k + j * m_kk + i * m_kk * m_kk;
-                                sum3 += molality[j]*molality[k]*m_Psi_ijk[n];
-                                if (m_debugCalc && m_Psi_ijk[n] != 0.0) {
-                                    std::string snj = speciesName(j) + "," + speciesName(k) + ":";
-                                    writelogf("      Psi term on %-16s           m_j m_k psi_ijk = %10.5f\n", snj,
-                                              molality[j]*molality[k]*m_Psi_ijk[n]);
-                                }
-                            }
-                        }
-                    }
                 }
 
                 if (charge(j) > 0.0) {
@@ -1782,15 +1814,6 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
                     }
                     for (size_t k = 1; k < m_kk; k++) {
                         if (charge(k) < 0.0) {
-                            // two inner sums over anions
-                            n = k + j * m_kk + i * m_kk * m_kk;
-                            sum2 += molality[j]*molality[k]*m_Psi_ijk[n];
-                            if (m_debugCalc && m_Psi_ijk[n] != 0.0) {
-                                std::string snj = speciesName(j) + "," + speciesName(k) + ":";
-                                writelogf("      Psi term on %-16s           m_j m_k psi_ijk = %10.5f\n", snj,
-                                          molality[j]*molality[k]*m_Psi_ijk[n]);
-                            }
-
                             // Find the counterIJ for the j,k interaction
                             n = m_kk*j + k;
                             size_t counterIJ2 = m_CounterIJ[n];
@@ -1813,27 +1836,15 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
                         writelogf("      Lambda term with %-12s                 2 m_j lam_ji = %10.5f\n", snj,
                                   molality[j]*2.0*m_Lambda_nj(j,i));
                     }
-
-                    // Zeta interaction term
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) < 0.0) {
-                            size_t izeta = j;
-                            size_t jzeta = i;
-                            n = izeta * m_kk * m_kk + jzeta * m_kk + k;
-                            double zeta = m_Psi_ijk[n];
-                            if (zeta != 0.0) {
-                                sum5 += molality[j]*molality[k]*zeta;
-                                if (m_debugCalc) {
-                                    std::string snj = speciesName(j) + "," + speciesName(k) + ":";
-                                    writelogf("      Zeta term on %-16s         m_n m_a zeta_nMa = %10.5f\n", snj,
-                                              molality[j]*molality[k]*m_Psi_ijk[n]);
-                                }
-                            }
-                        }
-                    }
                 }
             }
 
+            sum3 += m_PsiSum[i];
+            if (m_debugCalc && m_PsiSum[i] != 0.0) {
+                writelogf("      Psi and Zeta terms               sum m_j m_k psi_ijk = %10.5f\n",
+                          m_PsiSum[i]);
+            }
+
             // Add all of the contributions up to yield the log of the solute
             // activity coefficients (molality scale)
             m_lnActCoeffMolal_Unscaled[i] = zsqF + sum1 + sum2 + sum3 + sum4 + sum5;
@@ -1877,20 +1888,6 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
                         writelogf("                                                   m_j Z CMX = %10.5f\n",
                                molality[j]* molarcharge*m_CMX_IJ[counterIJ]);
                     }
-                    if (j < m_kk-1) {
-                        for (size_t k = j+1; k < m_kk; k++) {
-                            // an inner sum over all cations
-                            if (charge(k) > 0) {
-                                n = k + j * m_kk + i * m_kk * m_kk;
-                                sum3 += molality[j]*molality[k]*m_Psi_ijk[n];
-                                if (m_debugCalc && m_Psi_ijk[n] != 0.0) {
-                                    std::string snj = speciesName(j) + "," + speciesName(k) + ":";
-                                    writelogf("      Psi term on %-16s           m_j m_k psi_ijk = %10.5f\n", snj,
-                                              molality[j]*molality[k]*m_Psi_ijk[n]);
-                                }
-                            }
-                        }
-                    }
                 }
 
                 // For Anions, do the other anion interactions.
@@ -1906,14 +1903,6 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
                     }
                     for (size_t k = 1; k < m_kk; k++) {
                         if (charge(k) > 0.0) {
-                            // two inner sums over cations
-                            n = k + j * m_kk + i * m_kk * m_kk;
-                            sum2 += molality[j]*molality[k]*m_Psi_ijk[n];
-                            if (m_debugCalc && m_Psi_ijk[n] != 0.0) {
-                                std::string snj = speciesName(j) + "," + speciesName(k) + ":";
-                                writelogf("      Psi term on %-16s           m_j m_k psi_ijk = %10.5f\n", snj,
-                                          molality[j]*molality[k]*m_Psi_ijk[n]);
-                            }
                             // Find the counterIJ for the symmetric binary interaction
                             n = m_kk*j + k;
                             size_t counterIJ2 = m_CounterIJ[n];
@@ -1936,26 +1925,13 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
                         writelogf("      Lambda term with %-12s                 2 m_j lam_ji = %10.5f\n", snj,
                                   molality[j]*2.0*m_Lambda_nj(j,i));
                     }
-                    // Zeta interaction term
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) > 0.0) {
-                            size_t izeta = j;
-                            size_t jzeta = k;
-                            size_t kzeta = i;
-                            n = izeta * m_kk * m_kk + jzeta * m_kk + kzeta;
-                            double zeta = m_Psi_ijk[n];
-                            if (zeta != 0.0) {
-                                sum5 += molality[j]*molality[k]*zeta;
-                                if (m_debugCalc) {
-                                    std::string snj = speciesName(j) + "," + speciesName(k) + ":";
-                                    writelogf("      Zeta term on %-16s         m_n m_c zeta_ncX = %10.5f\n", snj,
-                                              molality[j]*molality[k]*m_Psi_ijk[n]);
-                                }
-                            }
-                        }
-                    }
                 }
             }
+            sum3 += m_PsiSum[i];
+            if (m_debugCalc && m_PsiSum[i] != 0.0) {
+                writelogf("      Psi and Zeta terms               sum m_j m_k psi_ijk = %10.5f\n",
+                          m_PsiSum[i]);
+            }
             m_lnActCoeffMolal_Unscaled[i] = zsqF + sum1 + sum2 + sum3 + sum4 + sum5;
             gamma_Unscaled[i] = exp(m_lnActCoeffMolal_Unscaled[i]);
             if (m_debugCalc) {
@@ -1972,7 +1948,7 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
                 writelogf("  Contributions to ln(ActCoeff_%s):\n", speciesName(i));
             }
             double sum1 = 0.0;
-            double sum3 = 0.0;
+            double sum3 = m_PsiSum[i];
             for (size_t j = 1; j < m_kk; j++) {
                 sum1 += molality[j]*2.0*m_Lambda_nj(i,j);
                 if (m_debugCalc && m_Lambda_nj(i,j) != 0.0) {
@@ -1980,20 +1956,6 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
                     writelogf("      Lambda_n term on %-16s     2 m_j lambda_n_j = %10.5f\n", snj,
                               molality[j]*2.0*m_Lambda_nj(i,j));
                 }
-                // Zeta term -> we piggyback on the psi term
-                if (charge(j) > 0.0) {
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) < 0.0) {
-                            size_t n = k + j * m_kk + i * m_kk * m_kk;
-                            sum3 += molality[j]*molality[k]*m_Psi_ijk[n];
-                            if (m_debugCalc && m_Psi_ijk[n] != 0.0) {
-                                std::string snj = speciesName(j) + "," + speciesName(k) + ":";
-                                writelogf("      Zeta term on %-16s           m_j m_k psi_ijk = %10.5f\n", snj,
-                                          molality[j]*molality[k]*m_Psi_ijk[n]);
-                            }
-                        }
-                    }
-                }
             }
             double sum2 = 3.0 * molality[i]* molality[i] * m_Mu_nnn[i];
             if (m_debugCalc && m_Mu_nnn[i] != 0.0) {
@@ -2054,13 +2016,6 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
                     size_t n = m_kk*j + k;
                     size_t counterIJ = m_CounterIJ[n];
                     sum2 += molality[j]*molality[k]*m_PhiPhi_IJ[counterIJ];
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) < 0.0) {
-                            // species m is an anion
-                            n = m + k * m_kk + j * m_kk * m_kk;
-                            sum2 += molality[j]*molality[k]*molality[m]*m_Psi_ijk[n];
-                        }
-                    }
                 }
             }
         }
@@ -2079,12 +2034,6 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
                     size_t n = m_kk*j + k;
                     size_t counterIJ = m_CounterIJ[n];
                     sum3 += molality[j]*molality[k]*m_PhiPhi_IJ[counterIJ];
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) > 0.0) {
-                            n = m + k * m_kk + j * m_kk * m_kk;
-                            sum3 += molality[j]*molality[k]*molality[m]*m_Psi_ijk[n];
-                        }
-                    }
                 }
             }
         }
@@ -2105,25 +2054,12 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
                         sum6 += 0.5 * molality[j]*molality[k]*m_Lambda_nj(j,k);
                     }
                 }
-                if (charge(k) < 0.0) {
-                    size_t izeta = j;
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) > 0.0) {
-                            size_t jzeta = m;
-                            size_t n = k + jzeta * m_kk + izeta * m_kk * m_kk;
-                            double zeta = m_Psi_ijk[n];
-                            if (zeta != 0.0) {
-                                sum7 += molality[izeta]*molality[jzeta]*molality[k]*zeta;
-                            }
-                        }
-                    }
-                }
             }
             sum7 += molality[j]*molality[j]*molality[j]*m_Mu_nnn[j];
         }
     }
     double sum_m_phi_minus_1 = 2.0 *
-                        (term1 + sum1 + sum2 + sum3 + sum4 + sum5 + sum6 + sum7);
+                        (term1 + sum1 + sum2 + sum3 + sum4 + sum5 + sum6 + sum7 + sumPsi);
     // Calculate the osmotic coefficient from
     //     osmotic_coeff = 1 + dGex/d(M0noRT) / sum(molality_i)
     double osmotic_coef;
@@ -2439,6 +2375,10 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
     }
     debuglog(" Step 8: \n", m_debugCalc);
 
+    // Ternary Psi and Zeta interactions, evaluated from the sparse list
+    // of nonzero triplets
+    double sumPsi = s_updatePitzer_PsiSums(m_Psi_ijk_L, &molality[0]);
+
     for (size_t i = 1; i < m_kk; i++) {
         // -------- SUBSECTION FOR CALCULATING THE dACTCOEFFdT FOR CATIONS -----
         if (charge(i) > 0) {
@@ -2458,18 +2398,6 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
                     // sum over all anions
                     sum1 += molality[j]*
                             (2.0*m_BMX_IJ_L[counterIJ] + molarcharge*m_CMX_IJ_L[counterIJ]);
-                    if (j < m_kk-1) {
-                        // This term is the ternary interaction involving the
-                        // non-duplicate sum over double anions, j, k, with
-                        // respect to the cation, i.
-                        for (size_t k = j+1; k < m_kk; k++) {
-                            // an inner sum over all anions
-                            if (charge(k) < 0.0) {
-                                n = k + j * m_kk + i * m_kk * m_kk;
-                                sum3 += molality[j]*molality[k]*m_Psi_ijk_L[n];
-                            }
-                        }
-                    }
                 }
 
                 if (charge(j) > 0.0) {
@@ -2479,10 +2407,6 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
                     }
                     for (size_t k = 1; k < m_kk; k++) {
                         if (charge(k) < 0.0) {
-                            // two inner sums over anions
-                            n = k + j * m_kk + i * m_kk * m_kk;
-                            sum2 += molality[j]*molality[k]*m_Psi_ijk_L[n];
-
                             // Find the counterIJ for the j,k interaction
                             n = m_kk*j + k;
                             size_t counterIJ2 = m_CounterIJ[n];
@@ -2496,21 +2420,10 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
                 if (charge(j) == 0) {
                     sum5 += molality[j]*2.0*m_Lambda_nj_L(j,i);
                 }
-
-                // Zeta interaction term
-                for (size_t k = 1; k < m_kk; k++) {
-                    if (charge(k) < 0.0) {
-                        size_t izeta = j;
-                        size_t jzeta = i;
-                        n = izeta * m_kk * m_kk + jzeta * m_kk + k;
-                        double zeta_L = m_Psi_ijk_L[n];
-                        if (zeta_L != 0.0) {
-                            sum5 += molality[j]*molality[k]*zeta_L;
-                        }
-                    }
-                }
             }
 
+            sum3 += m_PsiSum[i];
+
             // Add all of the contributions up to yield the log of the
             // solute activity coefficients (molality scale)
             m_dlnActCoeffMolaldT_Unscaled[i] =
@@ -2542,15 +2455,6 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
                 if (charge(j) > 0) {
                     sum1 += molality[j]*
                             (2.0*m_BMX_IJ_L[counterIJ] + molarcharge*m_CMX_IJ_L[counterIJ]);
-                    if (j < m_kk-1) {
-                        for (size_t k = j+1; k < m_kk; k++) {
-                            // an inner sum over all cations
-                            if (charge(k) > 0) {
-                                n = k + j * m_kk + i * m_kk * m_kk;
-                                sum3 += molality[j]*molality[k]*m_Psi_ijk_L[n];
-                            }
-                        }
-                    }
                 }
 
                 // For Anions, do the other anion interactions.
@@ -2561,9 +2465,6 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
                     }
                     for (size_t k = 1; k < m_kk; k++) {
                         if (charge(k) > 0.0) {
-                            // two inner sums over cations
-                            n = k + j * m_kk + i * m_kk * m_kk;
-                            sum2 += molality[j]*molality[k]*m_Psi_ijk_L[n];
                             // Find the counterIJ for the symmetric binary interaction
                             n = m_kk*j + k;
                             size_t counterIJ2 = m_CounterIJ[n];
@@ -2576,20 +2477,9 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
                 // for Anions, do the neutral species interaction
                 if (charge(j) == 0.0) {
                     sum5 += molality[j]*2.0*m_Lambda_nj_L(j,i);
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) > 0.0) {
-                            size_t izeta = j;
-                            size_t jzeta = k;
-                            size_t kzeta = i;
-                            n = izeta * m_kk * m_kk + jzeta * m_kk + kzeta;
-                            double zeta_L = m_Psi_ijk_L[n];
-                            if (zeta_L != 0.0) {
-                                sum5 += molality[j]*molality[k]*zeta_L;
-                            }
-                        }
-                    }
                 }
             }
+            sum3 += m_PsiSum[i];
             m_dlnActCoeffMolaldT_Unscaled[i] =
                 zsqdFdT + sum1 + sum2 + sum3 + sum4 + sum5;
             d_gamma_dT_Unscaled[i] = exp(m_dlnActCoeffMolaldT_Unscaled[i]);
@@ -2606,18 +2496,9 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
         // Equations agree with Pitzer,
         if (charge(i) == 0.0) {
             double sum1 = 0.0;
-            double sum3 = 0.0;
+            double sum3 = m_PsiSum[i];
             for (size_t j = 1; j < m_kk; j++) {
                 sum1 += molality[j]*2.0*m_Lambda_nj_L(i,j);
-                // Zeta term -> we piggyback on the psi term
-                if (charge(j) > 0.0) {
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) < 0.0) {
-                            size_t n = k + j * m_kk + i * m_kk * m_kk;
-                            sum3 += molality[j]*molality[k]*m_Psi_ijk_L[n];
-                        }
-                    }
-                }
             }
             double sum2 = 3.0 * molality[i] * molality[i] * m_Mu_nnn_L[i];
             m_dlnActCoeffMolaldT_Unscaled[i] = sum1 + sum2 + sum3;
@@ -2671,13 +2552,6 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
                     size_t n = m_kk*j + k;
                     size_t counterIJ = m_CounterIJ[n];
                     sum2 += molality[j]*molality[k]*m_PhiPhi_IJ_L[counterIJ];
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) < 0.0) {
-                            // species m is an anion
-                            n = m + k * m_kk + j * m_kk * m_kk;
-                            sum2 += molality[j]*molality[k]*molality[m]*m_Psi_ijk_L[n];
-                        }
-                    }
                 }
             }
         }
@@ -2696,12 +2570,6 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
                     size_t n = m_kk*j + k;
                     size_t counterIJ = m_CounterIJ[n];
                     sum3 += molality[j]*molality[k]*m_PhiPhi_IJ_L[counterIJ];
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) > 0.0) {
-                            n = m + k * m_kk + j * m_kk * m_kk;
-                            sum3 += molality[j]*molality[k]*molality[m]*m_Psi_ijk_L[n];
-                        }
-                    }
                 }
             }
         }
@@ -2722,25 +2590,12 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
                         sum6 += 0.5 * molality[j]*molality[k]*m_Lambda_nj_L(j,k);
                     }
                 }
-                if (charge(k) < 0.0) {
-                    size_t izeta = j;
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) > 0.0) {
-                            size_t jzeta = m;
-                            size_t n = k + jzeta * m_kk + izeta * m_kk * m_kk;
-                            double zeta_L = m_Psi_ijk_L[n];
-                            if (zeta_L != 0.0) {
-                                sum7 += molality[izeta]*molality[jzeta]*molality[k]*zeta_L;
-                            }
-                        }
-                    }
-                }
             }
             sum7 += molality[j]*molality[j]*molality[j]*m_Mu_nnn_L[j];
         }
     }
     double sum_m_phi_minus_1 = 2.0 *
-                        (term1 + sum1 + sum2 + sum3 + sum4 + sum5 + sum6 + sum7);
+                        (term1 + sum1 + sum2 + sum3 + sum4 + sum5 + sum6 + sum7 + sumPsi);
     // Calculate the osmotic coefficient from
     //     osmotic_coeff = 1 + dGex/d(M0noRT) / sum(molality_i)
     double d_osmotic_coef_dT;
@@ -3045,6 +2900,10 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
     }
     debuglog(" Step 8: \n", m_debugCalc);
 
+    // Ternary Psi and Zeta interactions, evaluated from the sparse list
+    // of nonzero triplets
+    double sumPsi = s_updatePitzer_PsiSums(m_Psi_ijk_LL, &molality[0]);
+
     for (size_t i = 1; i < m_kk; i++) {
         // -------- SUBSECTION FOR CALCULATING THE dACTCOEFFdT FOR CATIONS -----
         if (charge(i) > 0) {
@@ -3064,18 +2923,6 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
                     // sum over all anions
                     sum1 += molality[j]*
                             (2.0*m_BMX_IJ_LL[counterIJ] + molarcharge*m_CMX_IJ_LL[counterIJ]);
-                    if (j < m_kk-1) {
-                        // This term is the ternary interaction involving the
-                        // non-duplicate sum over double anions, j, k, with
-                        // respect to the cation, i.
-                        for (size_t k = j+1; k < m_kk; k++) {
-                            // an inner sum over all anions
-                            if (charge(k) < 0.0) {
-                                n = k + j * m_kk + i * m_kk * m_kk;
-                                sum3 += molality[j]*molality[k]*m_Psi_ijk_LL[n];
-                            }
-                        }
-                    }
                 }
 
                 if (charge(j) > 0.0) {
@@ -3085,10 +2932,6 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
                     }
                     for (size_t k = 1; k < m_kk; k++) {
                         if (charge(k) < 0.0) {
-                            // two inner sums over anions
-                            n = k + j * m_kk + i * m_kk * m_kk;
-                            sum2 += molality[j]*molality[k]*m_Psi_ijk_LL[n];
-
                             // Find the counterIJ for the j,k interaction
                             n = m_kk*j + k;
                             size_t counterIJ2 = m_CounterIJ[n];
@@ -3101,20 +2944,10 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
                 // Handle neutral j species
                 if (charge(j) == 0) {
                     sum5 += molality[j]*2.0*m_Lambda_nj_LL(j,i);
-                    // Zeta interaction term
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) < 0.0) {
-                            size_t izeta = j;
-                            size_t jzeta = i;
-                            n = izeta * m_kk * m_kk + jzeta * m_kk + k;
-                            double zeta_LL = m_Psi_ijk_LL[n];
-                            if (zeta_LL != 0.0) {
-                                sum5 += molality[j]*molality[k]*zeta_LL;
-                            }
-                        }
-                    }
                 }
             }
+            sum3 += m_PsiSum[i];
+
             // Add all of the contributions up to yield the log of the
             // solute activity coefficients (molality scale)
             m_d2lnActCoeffMolaldT2_Unscaled[i] =
@@ -3145,15 +2978,6 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
                 if (charge(j) > 0) {
                     sum1 += molality[j]*
                             (2.0*m_BMX_IJ_LL[counterIJ] + molarcharge*m_CMX_IJ_LL[counterIJ]);
-                    if (j < m_kk-1) {
-                        for (size_t k = j+1; k < m_kk; k++) {
-                            // an inner sum over all cations
-                            if (charge(k) > 0) {
-                                n = k + j * m_kk + i * m_kk * m_kk;
-                                sum3 += molality[j]*molality[k]*m_Psi_ijk_LL[n];
-                            }
-                        }
-                    }
                 }
 
                 // For Anions, do the other anion interactions.
@@ -3164,9 +2988,6 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
                     }
                     for (size_t k = 1; k < m_kk; k++) {
                         if (charge(k) > 0.0) {
-                            // two inner sums over cations
-                            n = k + j * m_kk + i * m_kk * m_kk;
-                            sum2 += molality[j]*molality[k]*m_Psi_ijk_LL[n];
                             // Find the counterIJ for the symmetric binary interaction
                             n = m_kk*j + k;
                             size_t counterIJ2 = m_CounterIJ[n];
@@ -3179,21 +3000,9 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
                 // for Anions, do the neutral species interaction
                 if (charge(j) == 0.0) {
                     sum5 += molality[j]*2.0*m_Lambda_nj_LL(j,i);
-                    // Zeta interaction term
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) > 0.0) {
-                            size_t izeta = j;
-                            size_t jzeta = k;
-                            size_t kzeta = i;
-                            n = izeta * m_kk * m_kk + jzeta * m_kk + kzeta;
-                            double zeta_LL = m_Psi_ijk_LL[n];
-                            if (zeta_LL != 0.0) {
-                                sum5 += molality[j]*molality[k]*zeta_LL;
-                            }
-                        }
-                    }
                 }
             }
+            sum3 += m_PsiSum[i];
             m_d2lnActCoeffMolaldT2_Unscaled[i] =
                 zsqd2FdT2 + sum1 + sum2 + sum3 + sum4 + sum5;
             if (m_debugCalc) {
@@ -3209,18 +3018,9 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
         // Equations agree with Pitzer,
         if (charge(i) == 0.0) {
             double sum1 = 0.0;
-            double sum3 = 0.0;
+            double sum3 = m_PsiSum[i];
             for (size_t j = 1; j < m_kk; j++) {
                 sum1 += molality[j]*2.0*m_Lambda_nj_LL(i,j);
-                // Zeta term -> we piggyback on the psi term
-                if (charge(j) > 0.0) {
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) < 0.0) {
-                            size_t n = k + j * m_kk + i * m_kk * m_kk;
-                            sum3 += molality[j]*molality[k]*m_Psi_ijk_LL[n];
-                        }
-                    }
-                }
             }
             double sum2 = 3.0 * molality[i] * molality[i] * m_Mu_nnn_LL[i];
             m_d2lnActCoeffMolaldT2_Unscaled[i] = sum1 + sum2 + sum3;
@@ -3275,13 +3075,6 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
                     size_t n = m_kk*j + k;
                     size_t counterIJ = m_CounterIJ[n];
                     sum2 += molality[j]*molality[k]*m_PhiPhi_IJ_LL[counterIJ];
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) < 0.0) {
-                            // species m is an anion
-                            n = m + k * m_kk + j * m_kk * m_kk;
-                            sum2 += molality[j]*molality[k]*molality[m]*m_Psi_ijk_LL[n];
-                        }
-                    }
                 }
             }
         }
@@ -3301,12 +3094,6 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
                     size_t counterIJ = m_CounterIJ[n];
 
                     sum3 += molality[j]*molality[k]*m_PhiPhi_IJ_LL[counterIJ];
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) > 0.0) {
-                            n = m + k * m_kk + j * m_kk * m_kk;
-                            sum3 += molality[j]*molality[k]*molality[m]*m_Psi_ijk_LL[n];
-                        }
-                    }
                 }
             }
         }
@@ -3327,26 +3114,13 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
                         sum6 += 0.5 * molality[j]*molality[k]*m_Lambda_nj_LL(j,k);
                     }
                 }
-                if (charge(k) < 0.0) {
-                    size_t izeta = j;
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) > 0.0) {
-                            size_t jzeta = m;
-                            size_t n = k + jzeta * m_kk + izeta * m_kk * m_kk;
-                            double zeta_LL = m_Psi_ijk_LL[n];
-                            if (zeta_LL != 0.0) {
-                                sum7 += molality[izeta]*molality[jzeta]*molality[k]*zeta_LL;
-                            }
-                        }
-                    }
-                }
             }
 
             sum7 += molality[j] * molality[j] * molality[j] * m_Mu_nnn_LL[j];
         }
     }
     double sum_m_phi_minus_1 = 2.0 *
-                        (term1 + sum1 + sum2 + sum3 + sum4 + sum5 + sum6 + sum7);
+                        (term1 + sum1 + sum2 + sum3 + sum4 + sum5 + sum6 + sum7 + sumPsi);
     // Calculate the osmotic coefficient from
     //     osmotic_coeff = 1 + dGex/d(M0noRT) / sum(molality_i)
     double d2_osmotic_coef_dT2;
@@ -3651,6 +3425,10 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
     }
     debuglog(" Step 8: \n", m_debugCalc);
 
+    // Ternary Psi and Zeta interactions, evaluated from the sparse list
+    // of nonzero triplets
+    double sumPsi = s_updatePitzer_PsiSums(m_Psi_ijk_P, &molality[0]);
+
     for (size_t i = 1; i < m_kk; i++) {
         // -------- SUBSECTION FOR CALCULATING THE dACTCOEFFdP FOR CATIONS -----
         if (charge(i) > 0) {
@@ -3670,18 +3448,6 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
                     // sum over all anions
                     sum1 += molality[j]*
                             (2.0*m_BMX_IJ_P[counterIJ] + molarcharge*m_CMX_IJ_P[counterIJ]);
-                    if (j < m_kk-1) {
-                        // This term is the ternary interaction involving the
-                        // non-duplicate sum over double anions, j, k, with
-                        // respect to the cation, i.
-                        for (size_t k = j+1; k < m_kk; k++) {
-                            // an inner sum over all anions
-                            if (charge(k) < 0.0) {
-                                n = k + j * m_kk + i * m_kk * m_kk;
-                                sum3 += molality[j]*molality[k]*m_Psi_ijk_P[n];
-                            }
-                        }
-                    }
                 }
 
                 if (charge(j) > 0.0) {
@@ -3691,10 +3457,6 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
                     }
                     for (size_t k = 1; k < m_kk; k++) {
                         if (charge(k) < 0.0) {
-                            // two inner sums over anions
-                            n = k + j * m_kk + i * m_kk * m_kk;
-                            sum2 += molality[j]*molality[k]*m_Psi_ijk_P[n];
-
                             // Find the counterIJ for the j,k interaction
                             n = m_kk*j + k;
                             size_t counterIJ2 = m_CounterIJ[n];
@@ -3707,21 +3469,11 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
                 // for Anions, do the neutral species interaction
                 if (charge(j) == 0) {
                     sum5 += molality[j]*2.0*m_Lambda_nj_P(j,i);
-                    // Zeta interaction term
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) < 0.0) {
-                            size_t izeta = j;
-                            size_t jzeta = i;
-                            n = izeta * m_kk * m_kk + jzeta * m_kk + k;
-                            double zeta_P = m_Psi_ijk_P[n];
-                            if (zeta_P != 0.0) {
-                                sum5 += molality[j]*molality[k]*zeta_P;
-                            }
-                        }
-                    }
                 }
             }
 
+            sum3 += m_PsiSum[i];
+
             // Add all of the contributions up to yield the log of the
             // solute activity coefficients (molality scale)
             m_dlnActCoeffMolaldP_Unscaled[i] =
@@ -3753,15 +3505,6 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
                 if (charge(j) > 0) {
                     sum1 += molality[j] *
                             (2.0*m_BMX_IJ_P[counterIJ] + molarcharge*m_CMX_IJ_P[counterIJ]);
-                    if (j < m_kk-1) {
-                        for (size_t k = j+1; k < m_kk; k++) {
-                            // an inner sum over all cations
-                            if (charge(k) > 0) {
-                                n = k + j * m_kk + i * m_kk * m_kk;
-                                sum3 += molality[j]*molality[k]*m_Psi_ijk_P[n];
-                            }
-                        }
-                    }
                 }
 
                 // For Anions, do the other anion interactions.
@@ -3772,9 +3515,6 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
                     }
                     for (size_t k = 1; k < m_kk; k++) {
                         if (charge(k) > 0.0) {
-                            // two inner sums over cations
-                            n = k + j * m_kk + i * m_kk * m_kk;
-                            sum2 += molality[j]*molality[k]*m_Psi_ijk_P[n];
                             // Find the counterIJ for the symmetric binary interaction
                             n = m_kk*j + k;
                             size_t counterIJ2 = m_CounterIJ[n];
@@ -3787,21 +3527,9 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
                 // for Anions, do the neutral species interaction
                 if (charge(j) == 0.0) {
                     sum5 += molality[j]*2.0*m_Lambda_nj_P(j,i);
-                    // Zeta interaction term
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) > 0.0) {
-                            size_t izeta = j;
-                            size_t jzeta = k;
-                            size_t kzeta = i;
-                            n = izeta * m_kk * m_kk + jzeta * m_kk + kzeta;
-                            double zeta_P = m_Psi_ijk_P[n];
-                            if (zeta_P != 0.0) {
-                                sum5 += molality[j]*molality[k]*zeta_P;
-                            }
-                        }
-                    }
                 }
             }
+            sum3 += m_PsiSum[i];
             m_dlnActCoeffMolaldP_Unscaled[i] =
                 zsqdFdP + sum1 + sum2 + sum3 + sum4 + sum5;
             if (m_debugCalc) {
@@ -3815,18 +3543,9 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
         // ------ SUBSECTION FOR CALCULATING d NEUTRAL SOLUTE ACT COEFF dP -----
         if (charge(i) == 0.0) {
             double sum1 = 0.0;
-            double sum3 = 0.0;
+            double sum3 = m_PsiSum[i];
             for (size_t j = 1; j < m_kk; j++) {
                 sum1 += molality[j]*2.0*m_Lambda_nj_P(i,j);
-                // Zeta term -> we piggyback on the psi term
-                if (charge(j) > 0.0) {
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) < 0.0) {
-                            size_t n = k + j * m_kk + i * m_kk * m_kk;
-                            sum3 += molality[j]*molality[k]*m_Psi_ijk_P[n];
-                        }
-                    }
-                }
             }
             double sum2 = 3.0 * molality[i] * molality[i] * m_Mu_nnn_P[i];
             m_dlnActCoeffMolaldP_Unscaled[i] = sum1 + sum2 + sum3;
@@ -3879,13 +3598,6 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
                     size_t n = m_kk*j + k;
                     size_t counterIJ = m_CounterIJ[n];
                     sum2 += molality[j]*molality[k]*m_PhiPhi_IJ_P[counterIJ];
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) < 0.0) {
-                            // species m is an anion
-                            n = m + k * m_kk + j * m_kk * m_kk;
-                            sum2 += molality[j]*molality[k]*molality[m]*m_Psi_ijk_P[n];
-                        }
-                    }
                 }
             }
         }
@@ -3905,12 +3617,6 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
                     size_t counterIJ = m_CounterIJ[n];
 
                     sum3 += molality[j]*molality[k]*m_PhiPhi_IJ_P[counterIJ];
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) > 0.0) {
-                            n = m + k * m_kk + j * m_kk * m_kk;
-                            sum3 += molality[j]*molality[k]*molality[m]*m_Psi_ijk_P[n];
-                        }
-                    }
                 }
             }
         }
@@ -3931,26 +3637,13 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
                         sum6 += 0.5 * molality[j]*molality[k]*m_Lambda_nj_P(j,k);
                     }
                 }
-                if (charge(k) < 0.0) {
-                    size_t izeta = j;
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) > 0.0) {
-                            size_t jzeta = m;
-                            size_t n = k + jzeta * m_kk + izeta * m_kk * m_kk;
-                            double zeta_P = m_Psi_ijk_P[n];
-                            if (zeta_P != 0.0) {
-                                sum7 += molality[izeta]*molality[jzeta]*molality[k]*zeta_P;
-                            }
-                        }
-                    }
-                }
             }
 
             sum7 += molality[j] * molality[j] * molality[j] * m_Mu_nnn_P[j];
         }
     }
     double sum_m_phi_minus_1 = 2.0 *
-                        (term1 + sum1 + sum2 + sum3 + sum4 + sum5 + sum6 + sum7);
+                        (term1 + sum1 + sum2 + sum3 + sum4 + sum5 + sum6 + sum7 + sumPsi);
 
     // Calculate the osmotic coefficient from
     //     osmotic_coeff = 1 + dGex/d(M0noRT) / sum(molality_i)
@@ -1441,6 +1441,10 @@ void HMWSoln::initThermoXML(XML_Node& phaseNode, const std::string& id_)
         }
     }
 
+    // Now that all of the Pitzer parameters are known, compile the lists of
+    // the interactions which are actually present
+    compilePitzerInteractionLists_();
+
     IMS_typeCutoff_ = 2;
     if (IMS_typeCutoff_ == 2) {
         calcIMSCutoffParams_();
@@ -1515,6 +1519,97 @@ void HMWSoln::initThermoXML(XML_Node& phaseNode, const std::string& id_)
     }
 }
 
+void HMWSoln::compilePitzerInteractionLists_()
+{
+    // Binary interactions with at least one nonzero coefficient
+    m_PitzerPairList.clear();
+    for (size_t i = 1; i < (m_kk - 1); i++) {
+        for (size_t j = (i+1); j < m_kk; j++) {
+            size_t counterIJ = m_CounterIJ[m_kk*i + j];
+            // Values which were set directly, without temperature
+            // coefficients, are reset by the temperature update as well.
+            bool found = (m_Beta0MX_ij[counterIJ] != 0.0 ||
+                          m_Beta1MX_ij[counterIJ] != 0.0 ||
+                          m_Beta2MX_ij[counterIJ] != 0.0 ||
+                          m_CphiMX_ij[counterIJ] != 0.0 ||
+                          m_Theta_ij[counterIJ] != 0.0);
+            for (size_t m = 0; m < m_Beta0MX_ij_coeff.nRows(); m++) {
+                if (m_Beta0MX_ij_coeff(m, counterIJ) != 0.0 ||
+                    m_Beta1MX_ij_coeff(m, counterIJ) != 0.0 ||
+                    m_Beta2MX_ij_coeff(m, counterIJ) != 0.0 ||
+                    m_CphiMX_ij_coeff(m, counterIJ) != 0.0 ||
+                    m_Theta_ij_coeff(m, counterIJ) != 0.0) {
+                    found = true;
+                    break;
+                }
+            }
+            if (found) {
+                m_PitzerPairList.push_back(counterIJ);
+            }
+        }
+    }
+
+    // Lambda interactions. The first species must be neutral.
+    m_LambdaList.clear();
+    for (size_t i = 1; i < m_kk; i++) {
+        if (charge(i) != 0.0) {
+            continue;
+        }
+        for (size_t j = 1; j < m_kk; j++) {
+            size_t n = i * m_kk + j;
+            for (size_t m = 0; m < m_Lambda_nj_coeff.nRows(); m++) {
+                if (m_Lambda_nj_coeff(m, n) != 0.0) {
+                    m_LambdaList.push_back(n);
+                    break;
+                }
+            }
+        }
+    }
+
+    // Psi and Zeta interactions. Only the orderings of the indices that are
+    // used in the activity coefficient expressions are kept.
+    m_PsiList.clear();
+    for (size_t i = 1; i < m_kk; i++) {
+        for (size_t j = 1; j < m_kk; j++) {
+            for (size_t k = 1; k < m_kk; k++) {
+                double zi = charge(i);
+                double zj = charge(j);
+                double zk = charge(k);
+                bool used;
+                if (zi > 0.0) {
+                    used = (zk < 0.0 && (zj > 0.0 || (zj < 0.0 && k > j)));
+                } else if (zi < 0.0) {
+                    used = (zk > 0.0 && (zj < 0.0 || (zj > 0.0 && k > j)));
+                } else {
+                    used = (zj > 0.0 && zk < 0.0);
+                }
+                if (!used) {
+                    continue;
+                }
+                size_t n = i * m_kk * m_kk + j * m_kk + k;
+                for (size_t m = 0; m < m_Psi_ijk_coeff.nRows(); m++) {
+                    if (m_Psi_ijk_coeff(m, n) != 0.0) {
+                        m_PsiList.push_back(n);
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    // Force the reevaluation of the temperature dependent coefficients
+    m_lastPitzerCoeffT = -1.0;
+
+    if (m_debugCalc) {
+        size_t nPairs = (m_kk - 1) * (m_kk - 2) / 2;
+        writelogf("HMWSoln::compilePitzerInteractionLists_: %d of %d binary "
+                  "interactions, %d of %d Lambda interactions, %d of %d "
+                  "Psi interactions are nonzero\n", m_PitzerPairList.size(),
+                  nPairs, m_LambdaList.size(), (m_kk - 1) * (m_kk - 1),
+                  m_PsiList.size(), (m_kk - 1) * (m_kk - 1) * (m_kk - 1));
+    }
+}
+
 void HMWSoln::calcIMSCutoffParams_()
 {
     IMS_afCut_ = 1.0 / (std::exp(1.0) * IMS_gamma_k_min_);
@@ -21,14 +21,25 @@ namespace Cantera
 PureFluidPhase::PureFluidPhase() :
     m_subflag(0),
     m_mw(-1.0),
-    m_verbose(false)
+    m_verbose(false),
+    m_tabulated(false)
+{
+}
+
+PureFluidPhase::PureFluidPhase(bool tabulated, const std::string& cacheFile) :
+    m_subflag(0),
+    m_mw(-1.0),
+    m_verbose(false),
+    m_tabulated(tabulated),
+    m_tableFile(cacheFile)
 {
 }
 
 PureFluidPhase::PureFluidPhase(const PureFluidPhase& right) :
     m_subflag(0),
     m_mw(-1.0),
-    m_verbose(false)
+    m_verbose(false),
+    m_tabulated(false)
 {
     *this = right;
 }
@@ -41,6 +52,11 @@ PureFluidPhase& PureFluidPhase::operator=(const PureFluidPhase& right)
         m_sub.reset(tpx::GetSub(m_subflag));
         m_mw = right.m_mw;
         m_verbose = right.m_verbose;
+        m_tabulated = right.m_tabulated;
+        m_tableFile = right.m_tableFile;
+        if (m_sub) {
+            m_sub->setTabulated(m_tabulated, m_tableFile);
+        }
     }
     return *this;
 }
@@ -57,6 +73,7 @@ void PureFluidPhase::initThermo()
         throw CanteraError("PureFluidPhase::initThermo",
                            "could not create new substance object.");
     }
+    m_sub->setTabulated(m_tabulated, m_tableFile);
     m_mw = m_sub->MolWt();
     setMolecularWeight(0,m_mw);
     double one = 1.0;
@@ -88,6 +105,9 @@ void PureFluidPhase::setParametersFromXML(const XML_Node& eosdata)
         throw CanteraError("PureFluidPhase::setParametersFromXML",
                            "missing or negative substance flag");
     }
+    if (eosdata.hasAttrib("tabulated")) {
+        m_tabulated = (eosdata["tabulated"] == "true");
+    }
 }
 
 doublereal PureFluidPhase::enthalpy_mole() const
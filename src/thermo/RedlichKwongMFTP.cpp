@@ -33,6 +33,10 @@ RedlichKwongMFTP::RedlichKwongMFTP() :
     m_formTempParam(0),
     m_b_current(0.0),
     m_a_current(0.0),
+    m_aijTemp(-1.0),
+    m_a0_current(0.0),
+    m_aT_current(0.0),
+    m_abStateNum(-2),
     NSolns_(0),
     dpdV_(0.0),
     dpdT_(0.0)
@@ -44,6 +48,10 @@ RedlichKwongMFTP::RedlichKwongMFTP(const std::string& infile, const std::string&
     m_formTempParam(0),
     m_b_current(0.0),
     m_a_current(0.0),
+    m_aijTemp(-1.0),
+    m_a0_current(0.0),
+    m_aT_current(0.0),
+    m_abStateNum(-2),
     NSolns_(0),
     dpdV_(0.0),
     dpdT_(0.0)
@@ -56,6 +64,10 @@ RedlichKwongMFTP::RedlichKwongMFTP(XML_Node& phaseRefRoot, const std::string& id
     m_formTempParam(0),
     m_b_current(0.0),
     m_a_current(0.0),
+    m_aijTemp(-1.0),
+    m_a0_current(0.0),
+    m_aT_current(0.0),
+    m_abStateNum(-2),
     NSolns_(0),
     dpdV_(0.0),
     dpdT_(0.0)
@@ -68,6 +80,10 @@ RedlichKwongMFTP::RedlichKwongMFTP(const RedlichKwongMFTP& b) :
     m_formTempParam(0),
     m_b_current(0.0),
     m_a_current(0.0),
+    m_aijTemp(-1.0),
+    m_a0_current(0.0),
+    m_aT_current(0.0),
+    m_abStateNum(-2),
     NSolns_(0),
     dpdV_(0.0),
     dpdT_(0.0)
@@ -90,6 +106,12 @@ RedlichKwongMFTP& RedlichKwongMFTP::operator=(const RedlichKwongMFTP& b)
         a_vec_Curr_ = b.a_vec_Curr_;
         b_vec_Curr_ = b.b_vec_Curr_;
         a_coeff_vec = b.a_coeff_vec;
+        m_aijTemp = b.m_aijTemp;
+        m_a0_current = b.m_a0_current;
+        m_aT_current = b.m_aT_current;
+        // The state number is reset by Phase::operator=, so the composition
+        // dependent sums are recomputed on the next state change
+        m_abStateNum = -2;
 
         m_pc_Species = b.m_pc_Species;
         m_tc_Species = b.m_tc_Species;
@@ -182,6 +204,28 @@ doublereal RedlichKwongMFTP::pressure() const
     return m_Pcurrent;
 }
 
+void RedlichKwongMFTP::getStateProperties(size_t nStates, const doublereal* T,
+                                          const doublereal* P, const doublereal* X,
+                                          doublereal* rho, doublereal* h,
+                                          doublereal* cp)
+{
+    for (size_t n = 0; n < nStates; n++) {
+        // Only changing the composition invalidates the mixing sums
+        if (X && (n == 0 || !std::equal(X + n * m_kk, X + (n+1) * m_kk,
+                                        X + (n-1) * m_kk))) {
+            setMoleFractions_NoState(X + n * m_kk);
+        }
+        setState_TP(T[n], P[n]);
+        rho[n] = density();
+        if (h) {
+            h[n] = enthalpy_mass();
+        }
+        if (cp) {
+            cp[n] = cp_mass();
+        }
+    }
+}
+
 void RedlichKwongMFTP::calcDensity()
 {
     // Calculate the molarVolume of the solution (m**3 kmol-1)
@@ -247,6 +291,7 @@ doublereal RedlichKwongMFTP::standardConcentration(size_t k) const
 
 void RedlichKwongMFTP::getActivityCoefficients(doublereal* ac) const
 {
+    updateAij();
     doublereal mv = molarVolume();
     doublereal sqt = sqrt(temperature());
     doublereal vpb = mv + m_b_current;
@@ -287,6 +332,7 @@ void RedlichKwongMFTP::getChemPotentials_RT(doublereal* muRT) const
 
 void RedlichKwongMFTP::getChemPotentials(doublereal* mu) const
 {
+    updateAij();
     getGibbs_ref(mu);
     for (size_t k = 0; k < m_kk; k++) {
         double xx = std::max(SmallNumber, moleFraction(k));
@@ -321,6 +367,7 @@ void RedlichKwongMFTP::getChemPotentials(doublereal* mu) const
 
 void RedlichKwongMFTP::getPartialMolarEnthalpies(doublereal* hbar) const
 {
+    updateAij();
     // First we get the reference state contributions
     getEnthalpy_RT_ref(hbar);
     scale(hbar, hbar+m_kk, hbar, RT());
@@ -366,6 +413,7 @@ void RedlichKwongMFTP::getPartialMolarEnthalpies(doublereal* hbar) const
 
 void RedlichKwongMFTP::getPartialMolarEntropies(doublereal* sbar) const
 {
+    updateAij();
     getEntropy_R_ref(sbar);
     scale(sbar, sbar+m_kk, sbar, GasConstant);
     doublereal TKelvin = temperature();
@@ -429,6 +477,7 @@ void RedlichKwongMFTP::getPartialMolarCp(doublereal* cpbar) const
 
 void RedlichKwongMFTP::getPartialMolarVolumes(doublereal* vbar) const
 {
+    updateAij();
     for (size_t k = 0; k < m_kk; k++) {
         m_pp[k] = 0.0;
         for (size_t i = 0; i < m_kk; i++) {
@@ -463,80 +512,40 @@ void RedlichKwongMFTP::getPartialMolarVolumes(doublereal* vbar) const
 doublereal RedlichKwongMFTP::critTemperature() const
 {
     double pc, tc, vc;
-    double a0 = 0.0;
-    double aT = 0.0;
-    for (size_t i = 0; i < m_kk; i++) {
-        for (size_t j = 0; j <m_kk; j++) {
-            size_t counter = i + m_kk * j;
-            a0 += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(0, counter);
-            aT += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(1, counter);
-        }
-    }
-    calcCriticalConditions(m_a_current, m_b_current, a0, aT, pc, tc, vc);
+    calcCriticalConditions(m_a_current, m_b_current, m_a0_current, m_aT_current,
+                           pc, tc, vc);
     return tc;
 }
 
 doublereal RedlichKwongMFTP::critPressure() const
 {
     double pc, tc, vc;
-    double a0 = 0.0;
-    double aT = 0.0;
-    for (size_t i = 0; i < m_kk; i++) {
-        for (size_t j = 0; j <m_kk; j++) {
-            size_t counter = i + m_kk * j;
-            a0 += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(0, counter);
-            aT += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(1, counter);
-        }
-    }
-    calcCriticalConditions(m_a_current, m_b_current, a0, aT, pc, tc, vc);
+    calcCriticalConditions(m_a_current, m_b_current, m_a0_current, m_aT_current,
+                           pc, tc, vc);
     return pc;
 }
 
 doublereal RedlichKwongMFTP::critVolume() const
 {
     double pc, tc, vc;
-    double a0 = 0.0;
-    double aT = 0.0;
-    for (size_t i = 0; i < m_kk; i++) {
-        for (size_t j = 0; j <m_kk; j++) {
-            size_t counter = i + m_kk * j;
-            a0 += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(0, counter);
-            aT += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(1, counter);
-        }
-    }
-    calcCriticalConditions(m_a_current, m_b_current, a0, aT, pc, tc, vc);
+    calcCriticalConditions(m_a_current, m_b_current, m_a0_current, m_aT_current,
+                           pc, tc, vc);
     return vc;
 }
 
 doublereal RedlichKwongMFTP::critCompressibility() const
 {
     double pc, tc, vc;
-    double a0 = 0.0;
-    double aT = 0.0;
-    for (size_t i = 0; i < m_kk; i++) {
-        for (size_t j = 0; j <m_kk; j++) {
-            size_t counter = i + m_kk * j;
-            a0 += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(0, counter);
-            aT += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(1, counter);
-        }
-    }
-    calcCriticalConditions(m_a_current, m_b_current, a0, aT, pc, tc, vc);
+    calcCriticalConditions(m_a_current, m_b_current, m_a0_current, m_aT_current,
+                           pc, tc, vc);
     return pc*vc/tc/GasConstant;
 }
 
 doublereal RedlichKwongMFTP::critDensity() const
 {
     double pc, tc, vc;
-    double a0 = 0.0;
-    double aT = 0.0;
-    for (size_t i = 0; i < m_kk; i++) {
-        for (size_t j = 0; j <m_kk; j++) {
-            size_t counter = i + m_kk * j;
-            a0 += moleFractions_[i] * moleFractions_[j] *a_coeff_vec(0, counter);
-            aT += moleFractions_[i] * moleFractions_[j] *a_coeff_vec(1, counter);
-        }
-    }
-    calcCriticalConditions(m_a_current, m_b_current, a0, aT, pc, tc, vc);
+    calcCriticalConditions(m_a_current, m_b_current, m_a0_current, m_aT_current,
+                           pc, tc, vc);
     double mmw = meanMolecularWeight();
     return mmw / vc;
 }
@@ -596,6 +605,8 @@ void RedlichKwongMFTP::initLengths()
     m_tmpV.resize(m_kk, 0.0);
     m_partialMolarVolumes.resize(m_kk, 0.0);
     dpdni_.resize(m_kk, 0.0);
+    m_aijTemp = -1.0;
+    m_abStateNum = -2;
 }
 
 void RedlichKwongMFTP::initThermoXML(XML_Node& phaseNode, const std::string& id)
@@ -660,6 +671,9 @@ void RedlichKwongMFTP::initThermoXML(XML_Node& phaseNode, const std::string& id)
         double bi = b_vec_Curr_[i];
         calcCriticalConditions(ai, bi, a0coeff, aTcoeff, m_pc_Species[i], m_tc_Species[i], m_vc_Species[i]);
     }
+    // The coefficients have changed, so the cached mixing sums are invalid
+    m_aijTemp = -1.0;
+    m_abStateNum = -2;
 
     MixtureFugacityTP::initThermoXML(phaseNode, id);
 }
@@ -903,7 +917,9 @@ doublereal RedlichKwongMFTP::densityCalc(doublereal TKelvin, doublereal presPa,
     }
 
     doublereal volguess = mmw / rhoguess;
-    NSolns_ = NicholsSolve(TKelvin, presPa, m_a_current, m_b_current, Vroot_);
+    // The previous volume root is a good starting point for the new one
+    NSolns_ = NicholsSolve(TKelvin, presPa, m_a_current, m_b_current, Vroot_,
+                           volguess);
 
     doublereal molarVolLast = Vroot_[0];
     if (NSolns_ >= 2) {
@@ -1026,63 +1042,65 @@ void RedlichKwongMFTP::updateMixingExpressions()
 
 void RedlichKwongMFTP::updateAB()
 {
-    double temp = temperature();
-    if (m_formTempParam == 1) {
+    // The mole fraction weighted sums only depend on the composition
+    if (stateMFNumber() != m_abStateNum) {
+        m_b_current = 0.0;
+        m_a0_current = 0.0;
+        m_aT_current = 0.0;
         for (size_t i = 0; i < m_kk; i++) {
+            m_b_current += moleFractions_[i] * b_vec_Curr_[i];
             for (size_t j = 0; j < m_kk; j++) {
                 size_t counter = i * m_kk + j;
-                a_vec_Curr_[counter] = a_coeff_vec(0,counter) + a_coeff_vec(1,counter) * temp;
+                doublereal xx = moleFractions_[i] * moleFractions_[j];
+                m_a0_current += a_coeff_vec(0,counter) * xx;
+                m_aT_current += a_coeff_vec(1,counter) * xx;
+            }
+        }
+        if (m_formTempParam == 0) {
+            m_a_current = 0.0;
+            for (size_t i = 0; i < m_kk; i++) {
+                for (size_t j = 0; j < m_kk; j++) {
+                    m_a_current += a_vec_Curr_[i * m_kk + j] * moleFractions_[i] * moleFractions_[j];
+                }
             }
         }
+        m_abStateNum = stateMFNumber();
     }
 
-    m_b_current = 0.0;
-    m_a_current = 0.0;
-    for (size_t i = 0; i < m_kk; i++) {
-        m_b_current += moleFractions_[i] * b_vec_Curr_[i];
-        for (size_t j = 0; j < m_kk; j++) {
-            m_a_current += a_vec_Curr_[i * m_kk + j] * moleFractions_[i] * moleFractions_[j];
+    // The a_ij are linear in T, so the mixture value follows from the sums
+    // without evaluating the individual a_ij
+    if (m_formTempParam == 1) {
+        m_a_current = m_a0_current + m_aT_current * temperature();
+    }
+}
+
+void RedlichKwongMFTP::updateAij() const
+{
+    double temp = temperature();
+    if (m_formTempParam == 1 && temp != m_aijTemp) {
+        for (size_t counter = 0; counter < m_kk * m_kk; counter++) {
+            a_vec_Curr_[counter] = a_coeff_vec(0,counter) + a_coeff_vec(1,counter) * temp;
         }
+        m_aijTemp = temp;
     }
 }
 
 void RedlichKwongMFTP::calculateAB(doublereal temp, doublereal& aCalc, doublereal& bCalc) const
 {
-    bCalc = 0.0;
-    aCalc = 0.0;
+    bCalc = m_b_current;
     if (m_formTempParam == 1) {
-        for (size_t i = 0; i < m_kk; i++) {
-            bCalc += moleFractions_[i] * b_vec_Curr_[i];
-            for (size_t j = 0; j < m_kk; j++) {
-                size_t counter = i * m_kk + j;
-                doublereal a_vec_Curr = a_coeff_vec(0,counter) + a_coeff_vec(1,counter) * temp;
-                aCalc += a_vec_Curr * moleFractions_[i] * moleFractions_[j];
-            }
-        }
+        aCalc = m_a0_current + m_aT_current * temp;
     } else {
-        for (size_t i = 0; i < m_kk; i++) {
-            bCalc += moleFractions_[i] * b_vec_Curr_[i];
-            for (size_t j = 0; j < m_kk; j++) {
-                size_t counter = i * m_kk + j;
-                doublereal a_vec_Curr = a_coeff_vec(0,counter);
-                aCalc += a_vec_Curr * moleFractions_[i] * moleFractions_[j];
-            }
-        }
+        aCalc = m_a0_current;
     }
 }
 
 doublereal RedlichKwongMFTP::da_dt() const
 {
-    doublereal dadT = 0.0;
     if (m_formTempParam == 1) {
-        for (size_t i = 0; i < m_kk; i++) {
-            for (size_t j = 0; j < m_kk; j++) {
-                size_t counter = i * m_kk + j;
-                dadT+= a_coeff_vec(1,counter) * moleFractions_[i] * moleFractions_[j];
-            }
-        }
+        return m_aT_current;
     }
-    return dadT;
+    return 0.0;
 }
 
 void RedlichKwongMFTP::calcCriticalConditions(doublereal a, doublereal b, doublereal a0_coeff, doublereal aT_coeff,
@@ -1128,7 +1146,7 @@ void RedlichKwongMFTP::calcCriticalConditions(doublereal a, doublereal b, double
 }
 
 int RedlichKwongMFTP::NicholsSolve(double TKelvin, double pres, doublereal a, doublereal b,
-                                   doublereal Vroot[3]) const
+                                   doublereal Vroot[3], doublereal Vguess) const
 {
     Vroot[0] = 0.0;
     Vroot[1] = 0.0;
@@ -1178,7 +1196,7 @@ int RedlichKwongMFTP::NicholsSolve(double TKelvin, double pres, doublereal a, do
         }
     }
 
-    int nSolnValues;
+    int nSolnValues = 0;
     double h2 = 4. * an * an * delta2 * delta2 * delta2;
     if (delta2 > 0.0) {
         delta = sqrt(delta2);
@@ -1205,8 +1223,31 @@ int RedlichKwongMFTP::NicholsSolve(double TKelvin, double pres, doublereal a, do
         nSolnValues = 1;
     }
 
+    // One real root -> if a starting estimate is given, try Newton's method
+    // before falling back on the closed-form solution
+    bool warmStart = false;
+    if (desc > 0.0 && Vguess > 0.0) {
+        doublereal v = Vguess;
+        for (int n = 0; n < 10; n++) {
+            doublereal res = ((an * v + bn) * v + cn) * v + dn;
+            doublereal dresdV = (3.0 * an * v + 2.0 * bn) * v + cn;
+            if (dresdV == 0.0) {
+                break;
+            }
+            doublereal del = - res / dresdV;
+            v += del;
+            if (fabs(del) < 1.0E-14 * fabs(v)) {
+                warmStart = (v > 0.0);
+                break;
+            }
+        }
+        if (warmStart) {
+            Vroot[0] = v;
+        }
+    }
+
     // One real root -> have to determine whether gas or liquid is the root
-    if (desc > 0.0) {
+    if (desc > 0.0 && !warmStart) {
         doublereal tmpD = sqrt(desc);
         doublereal tmp1 = (- yN + tmpD) / (2.0 * an);
         doublereal sgn1 = 1.0;
@@ -39,14 +39,33 @@ static const doublereal Rgas = 8.314371E3; // Joules kmol-1 K-1
 WaterPropsIAPWS::WaterPropsIAPWS() :
     tau(-1.0),
     delta(-1.0),
-    iState(-30000)
+    iState(-30000),
+    m_useDensityTable(false),
+    m_tabTmin(273.16),
+    m_tabTmax(1273.15),
+    m_tabLnPmin(log(611.0)),
+    m_tabLnPmax(log(1.0E8)),
+    m_tabNT(150),
+    m_tabNP(100)
 {
 }
 
 WaterPropsIAPWS::WaterPropsIAPWS(const WaterPropsIAPWS& b) :
     tau(b.tau),
     delta(b.delta),
-    iState(b.iState)
+    iState(b.iState),
+    m_useDensityTable(b.m_useDensityTable),
+    m_tabTmin(b.m_tabTmin),
+    m_tabTmax(b.m_tabTmax),
+    m_tabLnPmin(b.m_tabLnPmin),
+    m_tabLnPmax(b.m_tabLnPmax),
+    m_tabNT(b.m_tabNT),
+    m_tabNP(b.m_tabNP),
+    m_tabRho(b.m_tabRho),
+    m_tabRho_T(b.m_tabRho_T),
+    m_tabRho_P(b.m_tabRho_P),
+    m_tabRho_TP(b.m_tabRho_TP),
+    m_tabPhase(b.m_tabPhase)
 {
     m_phi.tdpolycalc(tau, delta);
 }
@@ -59,6 +78,18 @@ WaterPropsIAPWS& WaterPropsIAPWS::operator=(const WaterPropsIAPWS& b)
     tau = b.tau;
     delta = b.delta;
     iState = b.iState;
+    m_useDensityTable = b.m_useDensityTable;
+    m_tabTmin = b.m_tabTmin;
+    m_tabTmax = b.m_tabTmax;
+    m_tabLnPmin = b.m_tabLnPmin;
+    m_tabLnPmax = b.m_tabLnPmax;
+    m_tabNT = b.m_tabNT;
+    m_tabNP = b.m_tabNP;
+    m_tabRho = b.m_tabRho;
+    m_tabRho_T = b.m_tabRho_T;
+    m_tabRho_P = b.m_tabRho_P;
+    m_tabRho_TP = b.m_tabRho_TP;
+    m_tabPhase = b.m_tabPhase;
     m_phi.tdpolycalc(tau, delta);
     return *this;
 }
@@ -100,6 +131,24 @@ doublereal WaterPropsIAPWS::density(doublereal temperature, doublereal pressure,
                                     int phase, doublereal rhoguess)
 {
     doublereal deltaGuess = 0.0;
+    bool tableGuess = false;
+    if (m_useDensityTable && phase != WATER_UNSTABLELIQUID &&
+            phase != WATER_UNSTABLEGAS) {
+        if (m_tabRho.empty()) {
+            buildDensityTable();
+        }
+        // A density guess supplied by the caller selects the branch, so that
+        // the table does not move the iteration to a different root
+        int branch = phase;
+        if (rhoguess != -1.0) {
+            branch = (rhoguess > Rho_c) ? WATER_LIQUID : WATER_GAS;
+        }
+        doublereal rhoTable = densityTableGuess(temperature, pressure, branch);
+        if (rhoTable > 0.0) {
+            rhoguess = rhoTable;
+            tableGuess = true;
+        }
+    }
     if (rhoguess == -1.0) {
         if (phase != -1) {
             if (temperature > T_c) {
@@ -128,7 +177,15 @@ doublereal WaterPropsIAPWS::density(doublereal temperature, doublereal pressure,
     doublereal p_red = pressure * M_water / (Rgas * temperature * Rho_c);
     deltaGuess = rhoguess / Rho_c;
     setState_TR(temperature, rhoguess);
-    doublereal delta_retn = m_phi.dfind(p_red, tau, deltaGuess);
+    doublereal delta_retn = 0.0;
+    if (tableGuess) {
+        // The tabulated guess is close to the root, so use plain Newton
+        // steps, falling back to the damped iteration if that fails.
+        delta_retn = m_phi.dfind(p_red, tau, deltaGuess, false);
+    }
+    if (delta_retn <= 0.0) {
+        delta_retn = m_phi.dfind(p_red, tau, deltaGuess);
+    }
     doublereal density_retn;
     if (delta_retn >0.0) {
         delta = delta_retn;
@@ -145,6 +202,153 @@ doublereal WaterPropsIAPWS::density(doublereal temperature, doublereal pressure,
     return density_retn;
 }
 
+void WaterPropsIAPWS::setDensityTable(bool on, doublereal Tmin,
+                                      doublereal Tmax, doublereal Pmin,
+                                      doublereal Pmax, size_t nT, size_t nP)
+{
+    if (on && (Tmin >= Tmax || Pmin <= 0.0 || Pmin >= Pmax || nT < 2 || nP < 2)) {
+        throw CanteraError("WaterPropsIAPWS::setDensityTable",
+            "Bad table specification: T = [{}, {}], P = [{}, {}], "
+            "{} x {} nodes", Tmin, Tmax, Pmin, Pmax, nT, nP);
+    }
+    m_useDensityTable = on;
+    m_tabTmin = Tmin;
+    m_tabTmax = Tmax;
+    m_tabLnPmin = log(Pmin);
+    m_tabLnPmax = log(Pmax);
+    m_tabNT = nT;
+    m_tabNP = nP;
+    // The table is (re)built on the next call to density()
+    m_tabRho.clear();
+}
+
+void WaterPropsIAPWS::buildDensityTable()
+{
+    // Solve for the density at every node with the normal initial guesses.
+    // The table is turned off while doing this.
+    m_useDensityTable = false;
+    size_t nn = m_tabNT * m_tabNP;
+    m_tabRho.assign(nn, 0.0);
+    m_tabPhase.assign(nn, -1);
+    doublereal dT = (m_tabTmax - m_tabTmin) / (m_tabNT - 1);
+    doublereal dlnP = (m_tabLnPmax - m_tabLnPmin) / (m_tabNP - 1);
+    for (size_t i = 0; i < m_tabNT; i++) {
+        doublereal T = m_tabTmin + i * dT;
+        doublereal ps = (T < T_c) ? psat_est(T) : 0.0;
+        for (size_t j = 0; j < m_tabNP; j++) {
+            doublereal P = exp(m_tabLnPmin + j * dlnP);
+            int phase = WATER_SUPERCRIT;
+            if (T < T_c) {
+                phase = (P > ps) ? WATER_LIQUID : WATER_GAS;
+            }
+            doublereal rho = density(T, P, phase);
+            // Only keep nodes which converged onto the expected branch
+            if (rho > 0.0 && (phase == WATER_SUPERCRIT ||
+                              (phase == WATER_LIQUID && rho > Rho_c) ||
+                              (phase == WATER_GAS && rho < Rho_c))) {
+                m_tabRho[i*m_tabNP + j] = rho;
+                m_tabPhase[i*m_tabNP + j] = phase;
+            }
+        }
+    }
+
+    // Finite difference derivatives in index space. Differences are only
+    // taken between nodes of the same phase, so that the spline doesn't
+    // smear the jump in density across the saturation curve.
+    auto nodeDeriv = [&](const vector_fp& f, size_t i, size_t j,
+                         size_t di, size_t dj) {
+        size_t n = i*m_tabNP + j;
+        int ph = m_tabPhase[n];
+        bool hasLo = (di ? i > 0 : j > 0);
+        bool hasHi = (di ? i + 1 < m_tabNT : j + 1 < m_tabNP);
+        size_t nlo = n - di*m_tabNP - dj;
+        size_t nhi = n + di*m_tabNP + dj;
+        hasLo = hasLo && m_tabPhase[nlo] == ph;
+        hasHi = hasHi && m_tabPhase[nhi] == ph;
+        if (hasLo && hasHi) {
+            return 0.5 * (f[nhi] - f[nlo]);
+        } else if (hasHi) {
+            return f[nhi] - f[n];
+        } else if (hasLo) {
+            return f[n] - f[nlo];
+        }
+        return 0.0;
+    };
+    m_tabRho_T.assign(nn, 0.0);
+    m_tabRho_P.assign(nn, 0.0);
+    m_tabRho_TP.assign(nn, 0.0);
+    for (size_t i = 0; i < m_tabNT; i++) {
+        for (size_t j = 0; j < m_tabNP; j++) {
+            if (m_tabPhase[i*m_tabNP + j] != -1) {
+                m_tabRho_T[i*m_tabNP + j] = nodeDeriv(m_tabRho, i, j, 1, 0);
+                m_tabRho_P[i*m_tabNP + j] = nodeDeriv(m_tabRho, i, j, 0, 1);
+            }
+        }
+    }
+    for (size_t i = 0; i < m_tabNT; i++) {
+        for (size_t j = 0; j < m_tabNP; j++) {
+            if (m_tabPhase[i*m_tabNP + j] != -1) {
+                m_tabRho_TP[i*m_tabNP + j] = nodeDeriv(m_tabRho_P, i, j, 1, 0);
+            }
+        }
+    }
+    m_useDensityTable = true;
+}
+
+doublereal WaterPropsIAPWS::densityTableGuess(doublereal temperature,
+        doublereal pressure, int phase) const
+{
+    if (m_tabRho.empty() || pressure <= 0.0) {
+        return -1.0;
+    }
+    doublereal x = (temperature - m_tabTmin) / (m_tabTmax - m_tabTmin)
+                   * (m_tabNT - 1);
+    doublereal y = (log(pressure) - m_tabLnPmin) / (m_tabLnPmax - m_tabLnPmin)
+                   * (m_tabNP - 1);
+    if (x < 0.0 || y < 0.0 || x > m_tabNT - 1 || y > m_tabNP - 1) {
+        return -1.0;
+    }
+
+    // Determine which branch is wanted. This follows the initial guesses
+    // used in density(): above the critical temperature everything is
+    // supercritical, and below it an unspecified phase means the gas branch.
+    int wanted = phase;
+    if (temperature >= T_c) {
+        wanted = WATER_SUPERCRIT;
+    } else if (phase == -1 || phase == WATER_SUPERCRIT) {
+        wanted = WATER_GAS;
+    }
+
+    size_t i = std::min(static_cast<size_t>(x), m_tabNT - 2);
+    size_t j = std::min(static_cast<size_t>(y), m_tabNP - 2);
+    size_t n[4] = {i*m_tabNP + j, (i+1)*m_tabNP + j,
+                   i*m_tabNP + j + 1, (i+1)*m_tabNP + j + 1};
+    for (int c = 0; c < 4; c++) {
+        if (m_tabPhase[n[c]] != wanted) {
+            return -1.0;
+        }
+    }
+
+    // Bicubic Hermite interpolation within the cell
+    doublereal u = x - i;
+    doublereal v = y - j;
+    doublereal hu[4] = {(1.0 + 2.0*u)*(1.0 - u)*(1.0 - u), u*u*(3.0 - 2.0*u),
+                        u*(1.0 - u)*(1.0 - u), u*u*(u - 1.0)};
+    doublereal hv[4] = {(1.0 + 2.0*v)*(1.0 - v)*(1.0 - v), v*v*(3.0 - 2.0*v),
+                        v*(1.0 - v)*(1.0 - v), v*v*(v - 1.0)};
+    doublereal rho = 0.0;
+    for (int a = 0; a < 2; a++) {
+        for (int b = 0; b < 2; b++) {
+            size_t m = n[a + 2*b];
+            rho += hu[a] * hv[b] * m_tabRho[m]
+                   + hu[a+2] * hv[b] * m_tabRho_T[m]
+                   + hu[a] * hv[b+2] * m_tabRho_P[m]
+                   + hu[a+2] * hv[b+2] * m_tabRho_TP[m];
+        }
+    }
+    return rho;
+}
+
 doublereal WaterPropsIAPWS::density_const(doublereal pressure,
         int phase, doublereal rhoguess) const
 {
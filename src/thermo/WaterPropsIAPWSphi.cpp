@@ -878,13 +878,15 @@ doublereal WaterPropsIAPWSphi::phiR_dt() const
     return val;
 }
 
-doublereal WaterPropsIAPWSphi::dfind(doublereal p_red, doublereal tau, doublereal deltaGuess)
+doublereal WaterPropsIAPWSphi::dfind(doublereal p_red, doublereal tau,
+                                     doublereal deltaGuess, bool damped)
 {
     doublereal dd = deltaGuess;
     bool conv = false;
     doublereal deldd = dd;
     doublereal pcheck = 1.0E-30 + 1.0E-8 * p_red;
-    for (int n = 0; n < 200; n++) {
+    int nmax = (damped) ? 200 : 8;
+    for (int n = 0; n < nmax; n++) {
 
         // Calculate the internal polynomials, and then calculate the phi deriv
         // functions needed by this routine.
@@ -904,6 +906,9 @@ doublereal WaterPropsIAPWSphi::dfind(doublereal p_red, doublereal tau, doublerea
         // region, beyond the stability curve. We need to adjust the initial
         // guess outwards and start a new iteration.
         if (dpddelta <= 0.0) {
+            if (!damped) {
+                break;
+            }
             if (deltaGuess > 1.0) {
                 dd = dd * 1.05;
             }
@@ -921,7 +926,7 @@ doublereal WaterPropsIAPWSphi::dfind(doublereal p_red, doublereal tau, doublerea
 
         // Dampen and crop the update
         doublereal dpdx = dpddelta;
-        if (n < 10) {
+        if (n < 10 && damped) {
             dpdx = dpddelta * 1.1;
         }
         dpdx = std::max(dpdx, 0.001);
@@ -929,7 +934,7 @@ doublereal WaterPropsIAPWSphi::dfind(doublereal p_red, doublereal tau, doublerea
         // Formulate the update to reduced density using Newton's method. Then,
         // crop it to a max value of 0.02
         deldd = - (pred0 - p_red) / dpdx;
-        if (fabs(deldd) > 0.05) {
+        if (fabs(deldd) > 0.05 && damped) {
             deldd = deldd * 0.05 / fabs(deldd);
         }
 
@@ -6,6 +6,8 @@
 #include "cantera/tpx/Sub.h"
 #include "cantera/base/stringUtils.h"
 #include "cantera/base/global.h"
+#include <fstream>
+#include <cstdio>
 
 using std::string;
 using namespace Cantera;
@@ -13,6 +15,23 @@ using namespace Cantera;
 namespace {
 // these correspond to ordering withing propertyFlag::type
 std::string propertySymbols[] = {"H", "S", "U", "V", "P", "T"};
+
+// cubic Hermite interpolation between nodes k and k+1 of a uniformly spaced
+// table, with slopes estimated by finite differences of the nodal values
+double hermite(const std::vector<double>& y, size_t k, double s)
+{
+    size_t n = y.size();
+    double m0 = (k == 0) ? y[1] - y[0] : 0.5*(y[k+1] - y[k-1]);
+    double m1 = (k + 2 == n) ? y[k+1] - y[k] : 0.5*(y[k+2] - y[k]);
+    double s1 = 1.0 - s;
+    return (1.0 + 2.0*s)*s1*s1*y[k] + s*s1*s1*m0
+           + s*s*(3.0 - 2.0*s)*y[k+1] - s*s*s1*m1;
+}
+
+// number of nodes in the saturation and single-phase tables
+const size_t nSatTable = 200;
+const size_t nTTable = 80;
+const size_t nPTable = 60;
 }
 
 namespace tpx
@@ -26,7 +45,17 @@ Substance::Substance() :
     Pst(Undef),
     m_energy_offset(0.0),
     m_entropy_offset(0.0),
-    kbr(0)
+    kbr(0),
+    m_tabulated(false),
+    m_tableBuilt(false),
+    m_satT0(0.0),
+    m_satDT(0.0),
+    m_tabNT(0),
+    m_tabNP(0),
+    m_tabT0(0.0),
+    m_tabDT(0.0),
+    m_tabLnP0(0.0),
+    m_tabDLnP(0.0)
 {
 }
 
@@ -88,6 +117,15 @@ double Substance::Tsat(double p)
     if (T >= Tcrit()) {
         T = 0.5*(Tcrit() - Tmin());
     }
+    if (m_tabulated) {
+        if (!m_tableBuilt) {
+            buildTables();
+        }
+        double tguess;
+        if (TsatGuess(p, tguess)) {
+            T = tguess;
+        }
+    }
     double dp = 10*tol;
     while (fabs(dp) > tol) {
         if (T > Tcrit()) {
@@ -134,109 +172,154 @@ void Substance::Set(PropertyPair::type XY, double x0, double y0)
         XY = static_cast<PropertyPair::type>(-XY);
     }
 
-    switch (XY) {
-    case PropertyPair::TV:
-        set_T(x0);
-        set_v(y0);
-        break;
-    case PropertyPair::HP:
-        if (Lever(Pgiven, y0, x0, propertyFlag::H)) {
-            return;
-        }
-        set_xy(propertyFlag::H, propertyFlag::P,
-               x0, y0, TolAbsH, TolAbsP, TolRel, TolRel);
-        break;
-    case PropertyPair::SP:
-        if (Lever(Pgiven, y0, x0, propertyFlag::S)) {
-            return;
-        }
-        set_xy(propertyFlag::S, propertyFlag::P,
-               x0, y0, TolAbsS, TolAbsP, TolRel, TolRel);
-        break;
-    case PropertyPair::PV:
-        if (Lever(Pgiven, x0, y0, propertyFlag::V)) {
-            return;
-        }
-        set_xy(propertyFlag::P, propertyFlag::V,
-               x0, y0, TolAbsP, TolAbsV, TolRel, TolRel);
-        break;
-    case PropertyPair::TP:
-        if (x0 < Tcrit()) {
+    if (m_tabulated && !m_tableBuilt) {
+        buildTables();
+    }
+    // In tabulated mode, the iteration is started from an interpolated
+    // state. If it fails from there, repeat it from the usual starting point.
+    double Tprev = T;
+    double Rhoprev = Rho;
+    bool seeded = false;
+    try {
+        switch (XY) {
+        case PropertyPair::TV:
             set_T(x0);
-            if (y0 < Ps()) {
-                Set(PropertyPair::TX, x0, 1.0);
+            set_v(y0);
+            break;
+        case PropertyPair::HP:
+            if (Lever(Pgiven, y0, x0, propertyFlag::H)) {
+                return;
+            }
+            seeded = m_tabulated && seedState(Pgiven, y0, propertyFlag::H, x0);
+            set_xy(propertyFlag::H, propertyFlag::P,
+                   x0, y0, TolAbsH, TolAbsP, TolRel, TolRel);
+            break;
+        case PropertyPair::SP:
+            if (Lever(Pgiven, y0, x0, propertyFlag::S)) {
+                return;
+            }
+            seeded = m_tabulated && seedState(Pgiven, y0, propertyFlag::S, x0);
+            set_xy(propertyFlag::S, propertyFlag::P,
+                   x0, y0, TolAbsS, TolAbsP, TolRel, TolRel);
+            break;
+        case PropertyPair::PV:
+            if (Lever(Pgiven, x0, y0, propertyFlag::V)) {
+                return;
+            }
+            seeded = m_tabulated && seedState(Pgiven, x0, propertyFlag::V, y0);
+            set_xy(propertyFlag::P, propertyFlag::V,
+                   x0, y0, TolAbsP, TolAbsV, TolRel, TolRel);
+            break;
+        case PropertyPair::TP:
+            if (x0 < Tcrit()) {
+                set_T(x0);
+                if (y0 < Ps()) {
+                    seeded = m_tabulated && seedTP(x0, y0, 1);
+                    if (!seeded) {
+                        Set(PropertyPair::TX, x0, 1.0);
+                    }
+                } else {
+                    seeded = m_tabulated && seedTP(x0, y0, 0);
+                    if (!seeded) {
+                        Set(PropertyPair::TX, x0, 0.0);
+                    }
+                }
             } else {
-                Set(PropertyPair::TX, x0, 0.0);
+                set_T(x0);
+                seeded = m_tabulated && seedTP(x0, y0, 2);
             }
-        } else {
-            set_T(x0);
+            set_xy(propertyFlag::T, propertyFlag::P,
+                   x0, y0, TolAbsT, TolAbsP, TolRel, TolRel);
+            break;
+        case PropertyPair::UV:
+            set_xy(propertyFlag::U, propertyFlag::V,
+                   x0, y0, TolAbsU, TolAbsV, TolRel, TolRel);
+            break;
+        case PropertyPair::ST:
+            if (Lever(Tgiven, y0, x0, propertyFlag::S)) {
+                return;
+            }
+            seeded = m_tabulated && seedState(Tgiven, y0, propertyFlag::S, x0);
+            set_xy(propertyFlag::S, propertyFlag::T,
+                   x0, y0, TolAbsS, TolAbsT, TolRel, TolRel);
+            break;
+        case PropertyPair::SV:
+            set_xy(propertyFlag::S, propertyFlag::V,
+                   x0, y0, TolAbsS, TolAbsV, TolRel, TolRel);
+            break;
+        case PropertyPair::UP:
+            if (Lever(Pgiven, y0, x0, propertyFlag::U)) {
+                return;
+            }
+            seeded = m_tabulated && seedState(Pgiven, y0, propertyFlag::U, x0);
+            set_xy(propertyFlag::U, propertyFlag::P,
+                   x0, y0, TolAbsU, TolAbsP, TolRel, TolRel);
+            break;
+        case PropertyPair::VH:
+            set_xy(propertyFlag::V, propertyFlag::H,
+                   x0, y0, TolAbsV, TolAbsH, TolRel, TolRel);
+            break;
+        case PropertyPair::TH:
+            set_xy(propertyFlag::T, propertyFlag::H,
+                   x0, y0, TolAbsT, TolAbsH, TolRel, TolRel);
+            break;
+        case PropertyPair::SH:
+            set_xy(propertyFlag::S, propertyFlag::H,
+                   x0, y0, TolAbsS, TolAbsH, TolRel, TolRel);
+            break;
+        case PropertyPair::PX:
+            temp = Tsat(x0);
+            if (y0 > 1.0 || y0 < 0.0) {
+                throw CanteraError("Substance::Set",
+                                   "Invalid vapor fraction, {}", y0);
+            } else if (temp >= Tcrit()) {
+                throw CanteraError("Substance::Set",
+                                   "Can't set vapor fraction above the critical point");
+            } else {
+                set_T(temp);
+                update_sat();
+                Rho = 1.0/((1.0 - y0)/Rhf + y0/Rhv);
+            }
+            break;
+        case PropertyPair::TX:
+            if (y0 > 1.0 || y0 < 0.0) {
+                throw CanteraError("Substance::Set",
+                                   "Invalid vapor fraction, {}", y0);
+            } else if (x0 >= Tcrit()) {
+                throw CanteraError("Substance::Set",
+                                   "Can't set vapor fraction above the critical point");
+            } else {
+                set_T(x0);
+                update_sat();
+                Rho = 1.0/((1.0 - y0)/Rhf + y0/Rhv);
+            }
+            break;
+        default:
+            throw CanteraError("Substance::Set", "Invalid input.");
         }
-        set_xy(propertyFlag::T, propertyFlag::P,
-               x0, y0, TolAbsT, TolAbsP, TolRel, TolRel);
-        break;
-    case PropertyPair::UV:
-        set_xy(propertyFlag::U, propertyFlag::V,
-               x0, y0, TolAbsU, TolAbsV, TolRel, TolRel);
-        break;
-    case PropertyPair::ST:
-        if (Lever(Tgiven, y0, x0, propertyFlag::S)) {
-            return;
-        }
-        set_xy(propertyFlag::S, propertyFlag::T,
-               x0, y0, TolAbsS, TolAbsT, TolRel, TolRel);
-        break;
-    case PropertyPair::SV:
-        set_xy(propertyFlag::S, propertyFlag::V,
-               x0, y0, TolAbsS, TolAbsV, TolRel, TolRel);
-        break;
-    case PropertyPair::UP:
-        if (Lever(Pgiven, y0, x0, propertyFlag::U)) {
-            return;
-        }
-        set_xy(propertyFlag::U, propertyFlag::P,
-               x0, y0, TolAbsU, TolAbsP, TolRel, TolRel);
-        break;
-    case PropertyPair::VH:
-        set_xy(propertyFlag::V, propertyFlag::H,
-               x0, y0, TolAbsV, TolAbsH, TolRel, TolRel);
-        break;
-    case PropertyPair::TH:
-        set_xy(propertyFlag::T, propertyFlag::H,
-               x0, y0, TolAbsT, TolAbsH, TolRel, TolRel);
-        break;
-    case PropertyPair::SH:
-        set_xy(propertyFlag::S, propertyFlag::H,
-               x0, y0, TolAbsS, TolAbsH, TolRel, TolRel);
-        break;
-    case PropertyPair::PX:
-        temp = Tsat(x0);
-        if (y0 > 1.0 || y0 < 0.0) {
-            throw CanteraError("Substance::Set",
-                               "Invalid vapor fraction, {}", y0);
-        } else if (temp >= Tcrit()) {
-            throw CanteraError("Substance::Set",
-                               "Can't set vapor fraction above the critical point");
-        } else {
-            set_T(temp);
-            update_sat();
-            Rho = 1.0/((1.0 - y0)/Rhf + y0/Rhv);
-        }
-        break;
-    case PropertyPair::TX:
-        if (y0 > 1.0 || y0 < 0.0) {
-            throw CanteraError("Substance::Set",
-                               "Invalid vapor fraction, {}", y0);
-        } else if (x0 >= Tcrit()) {
-            throw CanteraError("Substance::Set",
-                               "Can't set vapor fraction above the critical point");
-        } else {
-            set_T(x0);
-            update_sat();
-            Rho = 1.0/((1.0 - y0)/Rhf + y0/Rhv);
+    } catch (CanteraError&) {
+        if (!seeded) {
+            throw;
         }
-        break;
-    default:
-        throw CanteraError("Substance::Set", "Invalid input.");
+        T = Tprev;
+        Rho = Rhoprev;
+        m_tabulated = false;
+        try {
+            Set(XY, x0, y0);
+        } catch (CanteraError&) {
+            m_tabulated = true;
+            throw;
+        }
+        m_tabulated = true;
+    }
+}
+
+void Substance::setTabulated(bool on, const std::string& cacheFile)
+{
+    m_tabulated = on;
+    if (cacheFile != m_tableFile) {
+        m_tableFile = cacheFile;
+        m_tableBuilt = false;
     }
 }
 
@@ -283,14 +366,23 @@ double Substance::Ps()
 void Substance::update_sat()
 {
     if ((T != Tslast) && (T < Tcrit())) {
+        if (m_tabulated && !m_tableBuilt) {
+            buildTables();
+        }
         double Rho_save = Rho;
-        double pp = Psat();
+        double pp, rhf0, rhv0;
+        // trial values interpolated from the saturation table, if available
+        bool tabulated = m_tabulated && satGuess(T, pp, rhf0, rhv0);
+        if (!tabulated) {
+            // trial value = Psat from correlation
+            pp = Psat();
+        }
         double lps = log(pp);
-        // trial value = Psat from correlation
         int i;
         for (i = 0; i<20; i++) {
             if (i==0) {
-                Rho = ldens(); // trial value = liquid density
+                // trial value = liquid density
+                Rho = tabulated ? rhf0 : ldens();
             } else {
                 Rho = Rhf;
             }
@@ -299,7 +391,8 @@ void Substance::update_sat()
 
             double gf = hp() - T*sp();
             if (i==0) {
-                Rho = pp*MolWt()/(8314.0*T); // trial value = ideal gas
+                // trial value = ideal gas
+                Rho = tabulated ? rhv0 : pp*MolWt()/(8314.0*T);
             } else {
                 Rho = Rhv;
             }
@@ -645,4 +738,382 @@ void Substance::set_TPp(double Temp, double Pressure)
     }
     Set(PropertyPair::TV, Temp,v_here);
 }
+
+void Substance::buildTables()
+{
+    // Restores the current state and the tabulation flag on every exit path,
+    // including when building the tables throws
+    struct StateGuard {
+        StateGuard(Substance& sub) : s(sub), T(sub.T), Rho(sub.Rho),
+            Tslast(sub.Tslast), Rhf(sub.Rhf), Rhv(sub.Rhv), Pst(sub.Pst),
+            tabulated(sub.m_tabulated) {}
+        ~StateGuard() {
+            s.T = T;
+            s.Rho = Rho;
+            s.Tslast = Tslast;
+            s.Rhf = Rhf;
+            s.Rhv = Rhv;
+            s.Pst = Pst;
+            s.m_tabulated = tabulated;
+        }
+        Substance& s;
+        double T, Rho, Tslast, Rhf, Rhv, Pst;
+        bool tabulated;
+    } guard(*this);
+
+    // The tables are computed using the untabulated iterations
+    m_tabulated = false;
+
+    if (m_tableFile.empty() || !readTables(m_tableFile)) {
+        // saturation properties, from Tmin up to the critical temperature
+        m_satLnP.clear();
+        m_satRhf.clear();
+        m_satRhv.clear();
+        m_satDT = (Tcrit() - Tmin())/nSatTable;
+        m_satT0 = Tmin();
+        for (size_t k = 0; k < nSatTable; k++) {
+            T = Tmin() + k*m_satDT;
+            Tslast = Undef;
+            try {
+                update_sat();
+            } catch (CanteraError&) {
+                if (m_satLnP.empty()) {
+                    // start the table at the first temperature that works
+                    m_satT0 = T + m_satDT;
+                    continue;
+                }
+                break;
+            }
+            m_satLnP.push_back(log(Pst));
+            m_satRhf.push_back(Rhf);
+            m_satRhv.push_back(Rhv);
+        }
+
+        // single-phase states
+        m_tabNT = nTTable;
+        m_tabNP = nPTable;
+        m_tabT0 = Tmin();
+        m_tabDT = (Tmax() - Tmin())/(m_tabNT - 1);
+        m_tabLnP0 = log(1.0e-6*Pcrit());
+        m_tabDLnP = (log(10.0*Pcrit()) - m_tabLnP0)/(m_tabNP - 1);
+        size_t nn = m_tabNT*m_tabNP;
+        m_tabLnRho.assign(nn, 0.0);
+        m_tabH.assign(nn, 0.0);
+        m_tabS.assign(nn, 0.0);
+        m_tabU.assign(nn, 0.0);
+        m_tabPhase.assign(nn, -1);
+        for (size_t i = 0; i < m_tabNT; i++) {
+            // Each isotherm is computed by continuation in pressure, starting
+            // from the ideal gas density in the vapor or supercritical region
+            // and from the saturated liquid density in the liquid region.
+            T = m_tabT0 + i*m_tabDT;
+            double ps = 0.0;
+            if (T < Tcrit()) {
+                try {
+                    ps = Ps();
+                } catch (CanteraError&) {
+                    continue;
+                }
+            }
+            int lastPhase = -1;
+            double lastRho = Undef;
+            for (size_t j = 0; j < m_tabNP; j++) {
+                double p = exp(m_tabLnP0 + j*m_tabDLnP);
+                int phase = (ps == 0.0) ? 2 : (p < ps ? 1 : 0);
+                if (phase == lastPhase) {
+                    Rho = lastRho;
+                } else if (phase == 0) {
+                    Rho = Rhf;
+                } else {
+                    Rho = p*MolWt()/(8314.0*T);
+                }
+                lastPhase = -1;
+                try {
+                    set_TPp(T, p);
+                } catch (CanteraError&) {
+                    continue;
+                }
+                // reject metastable or wrong-phase roots
+                if ((phase == 0 && Rho < Rhf) || (phase == 1 && Rho > Rhv)) {
+                    continue;
+                }
+                size_t n = i*m_tabNP + j;
+                m_tabPhase[n] = phase;
+                m_tabLnRho[n] = log(Rho);
+                m_tabH[n] = hp() - m_energy_offset;
+                m_tabS[n] = sp() - m_entropy_offset;
+                m_tabU[n] = up() - m_energy_offset;
+                lastPhase = phase;
+                lastRho = Rho;
+            }
+        }
+        if (!m_tableFile.empty()) {
+            // The tables are usable even if they cannot be cached
+            try {
+                writeTables(m_tableFile);
+            } catch (CanteraError& err) {
+                writelog("Warning: Substance::buildTables: could not write "
+                         "table cache:\n" + err.getMessage() + "\n");
+            }
+        }
+    }
+    m_tableBuilt = true;
+}
+
+bool Substance::readTables(const std::string& fname)
+{
+    std::ifstream f(fname);
+    if (!f) {
+        return false;
+    }
+    std::string tag, sname;
+    int version = 0;
+    f >> tag >> version >> sname;
+    if (!f || tag != "tpx-table" || version != 1 || sname != m_name) {
+        return false;
+    }
+    double check[6] = {MolWt(), Tcrit(), Pcrit(), Vcrit(), Tmin(), Tmax()};
+    for (size_t k = 0; k < 6; k++) {
+        double c;
+        f >> c;
+        if (!f || fabs(c - check[k]) > 1.0e-12*fabs(check[k])) {
+            return false;
+        }
+    }
+
+    size_t nsat, nt, np;
+    double satT0, satDT;
+    f >> satT0 >> satDT >> nsat;
+    if (!f || nsat > nSatTable) {
+        return false;
+    }
+    std::vector<double> lnp(nsat), rhf(nsat), rhv(nsat);
+    for (size_t k = 0; k < nsat; k++) {
+        f >> lnp[k] >> rhf[k] >> rhv[k];
+    }
+    double T0, DT, lnP0, DLnP;
+    f >> nt >> np >> T0 >> DT >> lnP0 >> DLnP;
+    if (!f || nt != nTTable || np != nPTable) {
+        return false;
+    }
+    size_t nn = nt*np;
+    std::vector<double> lnrho(nn), h(nn), s(nn), u(nn);
+    std::vector<int> phase(nn);
+    for (size_t n = 0; n < nn; n++) {
+        f >> phase[n] >> lnrho[n] >> h[n] >> s[n] >> u[n];
+    }
+    if (!f) {
+        return false;
+    }
+
+    m_satT0 = satT0;
+    m_satDT = satDT;
+    m_satLnP.swap(lnp);
+    m_satRhf.swap(rhf);
+    m_satRhv.swap(rhv);
+    m_tabNT = nt;
+    m_tabNP = np;
+    m_tabT0 = T0;
+    m_tabDT = DT;
+    m_tabLnP0 = lnP0;
+    m_tabDLnP = DLnP;
+    m_tabLnRho.swap(lnrho);
+    m_tabH.swap(h);
+    m_tabS.swap(s);
+    m_tabU.swap(u);
+    m_tabPhase.swap(phase);
+    return true;
+}
+
+void Substance::writeTables(const std::string& fname)
+{
+    // Write to a temporary file which replaces the cache only once it is
+    // complete, so that a partially written cache is never read
+    std::string tmpName = fname + fmt::format(".{}.tmp",
+                                              static_cast<const void*>(this));
+    {
+        std::ofstream f(tmpName);
+        if (!f) {
+            throw CanteraError("Substance::writeTables",
+                               "could not open file '{}' for writing", tmpName);
+        }
+        f.precision(17);
+        f << "tpx-table 1 " << m_name << "\n";
+        f << MolWt() << " " << Tcrit() << " " << Pcrit() << " " << Vcrit()
+          << " " << Tmin() << " " << Tmax() << "\n";
+        f << m_satT0 << " " << m_satDT << " " << m_satLnP.size() << "\n";
+        for (size_t k = 0; k < m_satLnP.size(); k++) {
+            f << m_satLnP[k] << " " << m_satRhf[k] << " " << m_satRhv[k]
+              << "\n";
+        }
+        f << m_tabNT << " " << m_tabNP << " " << m_tabT0 << " " << m_tabDT
+          << " " << m_tabLnP0 << " " << m_tabDLnP << "\n";
+        for (size_t n = 0; n < m_tabNT*m_tabNP; n++) {
+            f << m_tabPhase[n] << " " << m_tabLnRho[n] << " " << m_tabH[n]
+              << " " << m_tabS[n] << " " << m_tabU[n] << "\n";
+        }
+        f.close();
+        if (!f) {
+            std::remove(tmpName.c_str());
+            throw CanteraError("Substance::writeTables",
+                               "error writing file '{}'", tmpName);
+        }
+    }
+    if (std::rename(tmpName.c_str(), fname.c_str()) != 0) {
+        std::remove(tmpName.c_str());
+        throw CanteraError("Substance::writeTables",
+                           "could not rename '{}' to '{}'", tmpName, fname);
+    }
+}
+
+bool Substance::satGuess(double t, double& pp, double& rhf, double& rhv) const
+{
+    size_t n = m_satLnP.size();
+    if (n < 2) {
+        return false;
+    }
+    double u = (t - m_satT0)/m_satDT;
+    if (u < 0.0 || u > n - 1) {
+        return false;
+    }
+    size_t k = std::min(static_cast<size_t>(u), n - 2);
+    double s = u - k;
+    pp = exp(hermite(m_satLnP, k, s));
+    rhf = hermite(m_satRhf, k, s);
+    rhv = hermite(m_satRhv, k, s);
+    return (rhf > rhv && rhv > 0.0);
+}
+
+bool Substance::TsatGuess(double p, double& t) const
+{
+    size_t n = m_satLnP.size();
+    if (n < 2 || p <= 0.0) {
+        return false;
+    }
+    double lnp = log(p);
+    if (lnp < m_satLnP[0] || lnp > m_satLnP[n-1]) {
+        return false;
+    }
+    size_t k = std::upper_bound(m_satLnP.begin(), m_satLnP.end(), lnp)
+               - m_satLnP.begin();
+    k = std::min(std::max<size_t>(k, 1), n - 1) - 1;
+    double s = (lnp - m_satLnP[k])/(m_satLnP[k+1] - m_satLnP[k]);
+    t = m_satT0 + (k + s)*m_satDT;
+    return true;
+}
+
+double Substance::tableValue(propertyFlag::type ifunc, size_t i, size_t j) const
+{
+    size_t n = i*m_tabNP + j;
+    switch (ifunc) {
+    case propertyFlag::H:
+        return m_tabH[n];
+    case propertyFlag::S:
+        return m_tabS[n];
+    case propertyFlag::U:
+        return m_tabU[n];
+    case propertyFlag::V:
+        return exp(-m_tabLnRho[n]);
+    default:
+        throw CanteraError("Substance::tableValue", "invalid job index");
+    }
+}
+
+bool Substance::seedTP(double t, double p, int phase)
+{
+    if (m_tabNT < 2 || m_tabNP < 2 || p <= 0.0) {
+        return false;
+    }
+    double u = (t - m_tabT0)/m_tabDT;
+    double w = (log(p) - m_tabLnP0)/m_tabDLnP;
+    if (u < 0.0 || w < 0.0 || u > m_tabNT - 1 || w > m_tabNP - 1) {
+        return false;
+    }
+    size_t i = std::min(static_cast<size_t>(u), m_tabNT - 2);
+    size_t j = std::min(static_cast<size_t>(w), m_tabNP - 2);
+    size_t n00 = i*m_tabNP + j;
+    size_t n10 = n00 + m_tabNP;
+    if (m_tabPhase[n00] != phase || m_tabPhase[n00+1] != phase ||
+        m_tabPhase[n10] != phase || m_tabPhase[n10+1] != phase) {
+        return false;
+    }
+    double fu = u - i;
+    double fw = w - j;
+    double lnrho = (1.0 - fu)*((1.0 - fw)*m_tabLnRho[n00] + fw*m_tabLnRho[n00+1])
+                   + fu*((1.0 - fw)*m_tabLnRho[n10] + fw*m_tabLnRho[n10+1]);
+    T = t;
+    Rho = exp(lnrho);
+    return true;
+}
+
+bool Substance::seedState(int itp, double sat, propertyFlag::type ifunc,
+                          double val)
+{
+    if (m_tabNT < 2 || m_tabNP < 2) {
+        return false;
+    }
+    // position on the fixed axis
+    double w;
+    size_t nscan;
+    if (itp == Pgiven) {
+        if (sat <= 0.0) {
+            return false;
+        }
+        w = (log(sat) - m_tabLnP0)/m_tabDLnP;
+        nscan = m_tabNT;
+        if (w < 0.0 || w > m_tabNP - 1) {
+            return false;
+        }
+    } else {
+        w = (sat - m_tabT0)/m_tabDT;
+        nscan = m_tabNP;
+        if (w < 0.0 || w > m_tabNT - 1) {
+            return false;
+        }
+    }
+    size_t nfix = (itp == Pgiven) ? m_tabNP : m_tabNT;
+    size_t jf = std::min(static_cast<size_t>(w), nfix - 2);
+    double fw = w - jf;
+
+    if (ifunc == propertyFlag::H || ifunc == propertyFlag::U) {
+        val -= m_energy_offset;
+    } else if (ifunc == propertyFlag::S) {
+        val -= m_entropy_offset;
+    }
+
+    // scan along the other axis for a pair of adjacent nodes in the same
+    // phase that bracket the requested value
+    double f0 = 0.0, lr0 = 0.0;
+    int ph0 = -1;
+    for (size_t k = 0; k < nscan; k++) {
+        size_t i0 = (itp == Pgiven) ? k : jf;
+        size_t j0 = (itp == Pgiven) ? jf : k;
+        size_t i1 = (itp == Pgiven) ? k : jf + 1;
+        size_t j1 = (itp == Pgiven) ? jf + 1 : k;
+        size_t n0 = i0*m_tabNP + j0;
+        size_t n1 = i1*m_tabNP + j1;
+        int ph = m_tabPhase[n0];
+        if (ph < 0 || ph != m_tabPhase[n1]) {
+            ph0 = -1;
+            continue;
+        }
+        double f = (1.0 - fw)*tableValue(ifunc, i0, j0)
+                   + fw*tableValue(ifunc, i1, j1);
+        double lr = (1.0 - fw)*m_tabLnRho[n0] + fw*m_tabLnRho[n1];
+        if (ph == ph0 && f != f0 && (val - f0)*(val - f) <= 0.0) {
+            double a = (val - f0)/(f - f0);
+            if (itp == Pgiven) {
+                T = m_tabT0 + (k - 1 + a)*m_tabDT;
+            } else {
+                T = sat;
+            }
+            Rho = exp((1.0 - a)*lr0 + a*lr);
+            return true;
+        }
+        f0 = f;
+        lr0 = lr;
+        ph0 = ph;
+    }
+    return false;
+}
 }
@@ -18,9 +18,13 @@ namespace Cantera
 DustyGasTransport::DustyGasTransport(thermo_t* thermo) :
     Transport(thermo),
     m_temp(-1.0),
+    m_pres(-1.0),
     m_gradP(0.0),
     m_knudsen_ok(false),
     m_bulk_ok(false),
+    m_hfactor_ok(false),
+    m_multidiff_ok(false),
+    m_nfactor(0),
     m_porosity(0.0),
     m_tortuosity(1.0),
     m_pore_radius(0.0),
@@ -31,9 +35,13 @@ DustyGasTransport::DustyGasTransport(thermo_t* thermo) :
 
 DustyGasTransport::DustyGasTransport(const DustyGasTransport& right) :
     m_temp(-1.0),
+    m_pres(-1.0),
     m_gradP(0.0),
     m_knudsen_ok(false),
     m_bulk_ok(false),
+    m_hfactor_ok(false),
+    m_multidiff_ok(false),
+    m_nfactor(0),
     m_porosity(0.0),
     m_tortuosity(1.0),
     m_pore_radius(0.0),
@@ -51,16 +59,23 @@ DustyGasTransport& DustyGasTransport::operator=(const DustyGasTransport& right)
     Transport::operator=(right);
 
     m_mw = right.m_mw;
-    m_d = right.m_d;
+    m_dinv = right.m_dinv;
     m_x = right.m_x;
     m_dk = right.m_dk;
+    m_dk0 = right.m_dk0;
     m_temp = right.m_temp;
+    m_pres = right.m_pres;
     m_multidiff = right.m_multidiff;
+    m_hmat = right.m_hmat;
     m_spwork = right.m_spwork;
     m_spwork2 = right.m_spwork2;
+    m_spwork3 = right.m_spwork3;
     m_gradP = right.m_gradP;
     m_knudsen_ok = right.m_knudsen_ok;
     m_bulk_ok= right.m_bulk_ok;
+    m_hfactor_ok = right.m_hfactor_ok;
+    m_multidiff_ok = right.m_multidiff_ok;
+    m_nfactor = right.m_nfactor;
     m_porosity = right.m_porosity;
     m_tortuosity = right.m_tortuosity;
     m_pore_radius = right.m_pore_radius;
@@ -99,18 +114,24 @@ void DustyGasTransport::initialize(ThermoPhase* phase, Transport* gastr)
     m_mw = m_thermo->molecularWeights();
 
     m_multidiff.resize(m_nsp, m_nsp);
-    m_d.resize(m_nsp, m_nsp);
+    m_hmat.resize(m_nsp, m_nsp);
+    m_dinv.resize(m_nsp, m_nsp);
     m_dk.resize(m_nsp, 0.0);
+    m_dk0.resize(m_nsp, 0.0);
 
     m_x.resize(m_nsp, 0.0);
     m_thermo->getMoleFractions(m_x.data());
 
     // set flags all false
+    m_temp = -1.0;
     m_knudsen_ok = false;
     m_bulk_ok = false;
+    m_hfactor_ok = false;
+    m_multidiff_ok = false;
 
     m_spwork.resize(m_nsp);
     m_spwork2.resize(m_nsp);
+    m_spwork3.resize(m_nsp);
 }
 
 void DustyGasTransport::updateBinaryDiffCoeffs()
@@ -119,12 +140,13 @@ void DustyGasTransport::updateBinaryDiffCoeffs()
         return;
     }
 
-    // get the gaseous binary diffusion coefficients
-    m_gastran->getBinaryDiffCoeffs(m_nsp, m_d.ptrColumn(0));
-    doublereal por2tort = m_porosity / m_tortuosity;
+    // get the gaseous binary diffusion coefficients, and convert them to the
+    // reciprocals of the effective values at unit pressure
+    m_gastran->getBinaryDiffCoeffs(m_nsp, m_dinv.ptrColumn(0));
+    doublereal tort2por = m_tortuosity / (m_porosity * m_thermo->pressure());
     for (size_t n = 0; n < m_nsp; n++) {
         for (size_t m = 0; m < m_nsp; m++) {
-            m_d(n,m) *= por2tort;
+            m_dinv(m,n) = tort2por / m_dinv(m,n);
         }
     }
     m_bulk_ok = true;
@@ -132,37 +154,40 @@ void DustyGasTransport::updateBinaryDiffCoeffs()
 
 void DustyGasTransport::updateKnudsenDiffCoeffs()
 {
-    if (m_knudsen_ok) {
-        return;
+    if (!m_knudsen_ok) {
+        doublereal K_g = m_pore_radius * m_porosity / m_tortuosity;
+        const doublereal TwoThirds = 2.0/3.0;
+        for (size_t k = 0; k < m_nsp; k++) {
+            m_dk0[k] = TwoThirds * K_g * sqrt((8.0 * GasConstant)/
+                                              (Pi * m_mw[k]));
+        }
+        m_knudsen_ok = true;
     }
-    doublereal K_g = m_pore_radius * m_porosity / m_tortuosity;
-    const doublereal TwoThirds = 2.0/3.0;
+    doublereal sqrt_t = sqrt(m_temp);
     for (size_t k = 0; k < m_nsp; k++) {
-        m_dk[k] = TwoThirds * K_g * sqrt((8.0 * GasConstant * m_temp)/
-                                         (Pi * m_mw[k]));
+        m_dk[k] = m_dk0[k] * sqrt_t;
     }
-    m_knudsen_ok = true;
 }
 
 void DustyGasTransport::eval_H_matrix()
 {
     updateBinaryDiffCoeffs();
     updateKnudsenDiffCoeffs();
-    doublereal sum;
     for (size_t k = 0; k < m_nsp; k++) {
         // evaluate off-diagonal terms
+        doublereal xp = m_x[k] * m_pres;
         for (size_t j = 0; j < m_nsp; j++) {
-            m_multidiff(k,j) = -m_x[k]/m_d(k,j);
+            m_hmat(k,j) = -xp * m_dinv(k,j);
         }
 
         // evaluate diagonal term
-        sum = 0.0;
+        doublereal sum = 0.0;
         for (size_t j = 0; j < m_nsp; j++) {
             if (j != k) {
-                sum += m_x[j]/m_d(k,j);
+                sum += m_x[j] * m_dinv(k,j);
             }
         }
-        m_multidiff(k,k) = 1.0/m_dk[k] + sum;
+        m_hmat(k,k) = 1.0/m_dk[k] + m_pres * sum;
     }
 }
 
@@ -199,46 +224,91 @@ void DustyGasTransport::getMolarFluxes(const doublereal* const state1,
     doublereal gradp = (p2 - p1)/delta;
     doublereal tbar = 0.5*(t1 + t2);
     m_thermo->setState_TPX(tbar, pbar, cbar);
-    updateMultiDiffCoeffs();
-
-    // Multiply m_multidiff and gradc together and store the result in fluxes[]
-    multiply(m_multidiff, gradc, fluxes);
-    divide_each(cbar, cbar + m_nsp, m_dk.begin());
-
-    // if no permeability has been specified, use result for
-    // close-packed spheres
-    double b = 0.0;
-    if (m_perm < 0.0) {
-        double p = m_porosity;
-        double d = m_diam;
-        double t = m_tortuosity;
-        b = p*p*p*d*d/(72.0*t*(1.0-p)*(1.0-p));
+    updateHMatrixFactor();
+
+    // The right-hand side is the concentration gradient plus the Darcy term
+    if (gradp != 0.0) {
+        // if no permeability has been specified, use result for
+        // close-packed spheres
+        double b = 0.0;
+        if (m_perm < 0.0) {
+            double p = m_porosity;
+            double d = m_diam;
+            double t = m_tortuosity;
+            b = p*p*p*d*d/(72.0*t*(1.0-p)*(1.0-p));
+        } else {
+            b = m_perm;
+        }
+        b *= gradp / m_gastran->viscosity();
+        for (size_t k = 0; k < m_nsp; k++) {
+            fluxes[k] = -gradc[k] - b * cbar[k] / m_dk[k];
+        }
     } else {
-        b = m_perm;
+        for (size_t k = 0; k < m_nsp; k++) {
+            fluxes[k] = -gradc[k];
+        }
+    }
+
+    // Solve using the factored H matrix
+    int ierr = m_hmat.solve(fluxes);
+    if (ierr != 0) {
+        throw CanteraError("DustyGasTransport::getMolarFluxes",
+                           "solve returned ierr = {}", ierr);
     }
-    b *= gradp / m_gastran->viscosity();
-    scale(cbar, cbar + m_nsp, cbar, b);
+}
 
-    // Multiply m_multidiff with cbar and add it to fluxes
-    increment(m_multidiff, cbar, fluxes);
-    scale(fluxes, fluxes + m_nsp, fluxes, -1.0);
+void DustyGasTransport::getMolarFluxes(size_t npts,
+                                       const double* const states,
+                                       const double* const delta,
+                                       double* const fluxes)
+{
+    const size_t ld = m_nsp + 2;
+    for (size_t j = 0; j + 1 < npts; j++) {
+        getMolarFluxes(states + j*ld, states + (j+1)*ld, delta[j],
+                       fluxes + j*m_nsp);
+    }
 }
 
-void DustyGasTransport::updateMultiDiffCoeffs()
+void DustyGasTransport::updateHMatrixFactor()
 {
     // see if temperature has changed
     updateTransport_T();
 
-    // update the mole fractions
+    // see if the pressure or the mole fractions have changed
     updateTransport_C();
+    if (m_hfactor_ok) {
+        return;
+    }
     eval_H_matrix();
 
-    // invert H
-    int ierr = invert(m_multidiff);
+    int ierr = m_hmat.factor();
+    if (ierr != 0) {
+        throw CanteraError("DustyGasTransport::updateHMatrixFactor",
+                           "factor returned ierr = {}", ierr);
+    }
+    m_nfactor++;
+    m_hfactor_ok = true;
+    m_multidiff_ok = false;
+}
+
+void DustyGasTransport::updateMultiDiffCoeffs()
+{
+    updateHMatrixFactor();
+    if (m_multidiff_ok) {
+        return;
+    }
+
+    // invert H, using its factorization
+    m_multidiff.zero();
+    for (size_t k = 0; k < m_nsp; k++) {
+        m_multidiff(k,k) = 1.0;
+    }
+    int ierr = m_hmat.solve(m_multidiff.ptrColumn(0), m_nsp, m_nsp);
     if (ierr != 0) {
         throw CanteraError("DustyGasTransport::updateMultiDiffCoeffs",
-                           "invert returned ierr = {}", ierr);
+                           "solve returned ierr = {}", ierr);
     }
+    m_multidiff_ok = true;
 }
 
 void DustyGasTransport::getMultiDiffCoeffs(const size_t ld, doublereal* const d)
@@ -257,21 +327,26 @@ void DustyGasTransport::updateTransport_T()
         return;
     }
     m_temp = m_thermo->temperature();
-    m_knudsen_ok = false;
     m_bulk_ok = false;
+    m_hfactor_ok = false;
 }
 
 void DustyGasTransport::updateTransport_C()
 {
-    m_thermo->getMoleFractions(m_x.data());
+    doublereal* const x = m_spwork3.data();
+    m_thermo->getMoleFractions(x);
 
     // add an offset to avoid a pure species condition
     // (check - this may be unnecessary)
     for (size_t k = 0; k < m_nsp; k++) {
-        m_x[k] = std::max(Tiny, m_x[k]);
+        x[k] = std::max(Tiny, x[k]);
+    }
+    doublereal p = m_thermo->pressure();
+    if (p != m_pres || !std::equal(x, x + m_nsp, m_x.begin())) {
+        m_pres = p;
+        std::copy(x, x + m_nsp, m_x.begin());
+        m_hfactor_ok = false;
     }
-    // diffusion coeffs depend on Pressure
-    m_bulk_ok = false;
 }
 
 void DustyGasTransport::setPorosity(doublereal porosity)
@@ -279,6 +354,7 @@ void DustyGasTransport::setPorosity(doublereal porosity)
     m_porosity = porosity;
     m_knudsen_ok = false;
     m_bulk_ok = false;
+    m_hfactor_ok = false;
 }
 
 void DustyGasTransport::setTortuosity(doublereal tort)
@@ -286,12 +362,14 @@ void DustyGasTransport::setTortuosity(doublereal tort)
     m_tortuosity = tort;
     m_knudsen_ok = false;
     m_bulk_ok = false;
+    m_hfactor_ok = false;
 }
 
 void DustyGasTransport::setMeanPoreRadius(doublereal rbar)
 {
     m_pore_radius = rbar;
     m_knudsen_ok = false;
+    m_hfactor_ok = false;
 }
 
 void DustyGasTransport::setMeanParticleDiameter(doublereal dbar)
@@ -4,6 +4,8 @@
 #include "cantera/base/stringUtils.h"
 #include "cantera/numerics/polyfit.h"
 #include "cantera/transport/TransportData.h"
+#include <fstream>
+#include <cstdio>
 
 namespace Cantera
 {
@@ -12,6 +14,80 @@ namespace Cantera
 //! except in CK mode, where the degree is 6.
 #define COLL_INT_POLY_DEGREE 8
 
+//! version number of the format of the polynomial fit cache files
+static const uint64_t FitCacheVersion = 1;
+
+namespace {
+
+//! Update a 64-bit FNV-1a hash with the bytes of *data*
+void hashBytes(uint64_t& h, const void* data, size_t n)
+{
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < n; i++) {
+        h ^= p[i];
+        h *= 1099511628211ULL;
+    }
+}
+
+void hashValue(uint64_t& h, double x)
+{
+    hashBytes(h, &x, sizeof(x));
+}
+
+void hashValue(uint64_t& h, uint64_t x)
+{
+    hashBytes(h, &x, sizeof(x));
+}
+
+void hashValue(uint64_t& h, const std::string& s)
+{
+    hashValue(h, static_cast<uint64_t>(s.size()));
+    hashBytes(h, s.data(), s.size());
+}
+
+void writeValue(std::ostream& f, uint64_t x)
+{
+    f.write(reinterpret_cast<const char*>(&x), sizeof(x));
+}
+
+bool readValue(std::istream& f, uint64_t& x)
+{
+    f.read(reinterpret_cast<char*>(&x), sizeof(x));
+    return bool(f);
+}
+
+//! Write a list of coefficient vectors, preceded by their number and lengths
+void writeCoeffs(std::ostream& f, const std::vector<vector_fp>& c)
+{
+    writeValue(f, c.size());
+    for (size_t i = 0; i < c.size(); i++) {
+        writeValue(f, c[i].size());
+        f.write(reinterpret_cast<const char*>(c[i].data()),
+                c[i].size() * sizeof(double));
+    }
+}
+
+//! Read a list of coefficient vectors written by writeCoeffs(). Each vector
+//! must have a length of *len*.
+bool readCoeffs(std::istream& f, std::vector<vector_fp>& c, size_t len)
+{
+    uint64_t n, m;
+    if (!readValue(f, n) || n > 100000000) {
+        return false;
+    }
+    c.resize(n);
+    for (size_t i = 0; i < n; i++) {
+        if (!readValue(f, m) || m != len) {
+            return false;
+        }
+        c[i].resize(m);
+        f.read(reinterpret_cast<char*>(c[i].data()), m * sizeof(double));
+    }
+    return bool(f);
+}
+
+}
+
 GasTransport::GasTransport(ThermoPhase* thermo) :
     Transport(thermo),
     m_viscmix(0.0),
@@ -76,7 +152,12 @@ GasTransport& GasTransport::operator=(const GasTransport& right)
     m_t14 = right.m_t14;
     m_t32 = right.m_t32;
     m_diffcoeffs = right.m_diffcoeffs;
+    m_diffcoeffsPacked = right.m_diffcoeffsPacked;
+    m_bdiffPacked = right.m_bdiffPacked;
     m_bdiff = right.m_bdiff;
+    m_bdiffInv = right.m_bdiffInv;
+    m_xmw = right.m_xmw;
+    m_dwork = right.m_dwork;
     m_condcoeffs = right.m_condcoeffs;
     m_poly = right.m_poly;
     m_omega22_poly = right.m_omega22_poly;
@@ -95,6 +176,7 @@ GasTransport& GasTransport::operator=(const GasTransport& right)
     m_delta = right.m_delta;
     m_w_ac = right.m_w_ac;
     m_log_level = right.m_log_level;
+    m_fitCacheDir = right.m_fitCacheDir;
 
     return *this;
 }
@@ -154,21 +236,28 @@ doublereal GasTransport::viscosity()
 
 void GasTransport::updateViscosity_T()
 {
-    doublereal vratiokj, wratiojk, factor1;
     if (!m_spvisc_ok) {
         updateSpeciesViscosities();
     }
 
-    // see Eq. (9-5.15) of Reid, Prausnitz, and Poling
-    for (size_t j = 0; j < m_nsp; j++) {
-        for (size_t k = j; k < m_nsp; k++) {
-            vratiokj = m_visc[k]/m_visc[j];
-            wratiojk = m_mw[j]/m_mw[k];
+    // m_spwork holds 1/sqrt(visc), so that the loop below needs no divisions
+    for (size_t k = 0; k < m_nsp; k++) {
+        m_spwork[k] = 1.0 / m_sqvisc[k];
+    }
 
+    // see Eq. (9-5.15) of Reid, Prausnitz, and Poling. The factors that
+    // depend only on the molecular weights are precomputed in init().
+    for (size_t j = 0; j < m_nsp; j++) {
+        double isqj = m_spwork[j];
+        m_phi(j,j) = 4.0 * m_wratkj1(j,j);
+        for (size_t k = j + 1; k < m_nsp; k++) {
             // Note that m_wratjk(k,j) holds the square root of m_wratjk(j,k)!
-            factor1 = 1.0 + (m_sqvisc[k]/m_sqvisc[j]) * m_wratjk(k,j);
-            m_phi(k,j) = factor1*factor1 / (sqrt(8.0) * m_wratkj1(j,k));
-            m_phi(j,k) = m_phi(k,j)/(vratiokj * wratiojk);
+            double factor1 = 1.0 + m_sqvisc[k] * isqj * m_wratjk(k,j);
+            double phikj = factor1 * factor1 * m_wratkj1(j,k);
+            m_phi(k,j) = phikj;
+            // phi(j,k) = phi(k,j) * (visc[j]/visc[k]) * (mw[k]/mw[j])
+            m_phi(j,k) = phikj * m_visc[j] * m_spwork[k] * m_spwork[k]
+                         * m_wratkj1(k,j);
         }
     }
     m_viscwt_ok = true;
@@ -195,24 +284,47 @@ void GasTransport::updateSpeciesViscosities()
 void GasTransport::updateDiff_T()
 {
     update_T();
-    // evaluate binary diffusion coefficients at unit pressure
-    size_t ic = 0;
+    // evaluate binary diffusion coefficients at unit pressure for each species
+    // pair, using the coefficients packed by power of log(T)
+    size_t npairs = m_bdiffPacked.size();
+    double* const d = m_bdiffPacked.data();
+    const double* const c0 = m_diffcoeffsPacked.ptrColumn(0);
+    const double* const c1 = m_diffcoeffsPacked.ptrColumn(1);
+    const double* const c2 = m_diffcoeffsPacked.ptrColumn(2);
+    const double* const c3 = m_diffcoeffsPacked.ptrColumn(3);
+    const double p0 = m_polytempvec[0];
+    const double p1 = m_polytempvec[1];
+    const double p2 = m_polytempvec[2];
+    const double p3 = m_polytempvec[3];
     if (m_mode == CK_Mode) {
-        for (size_t i = 0; i < m_nsp; i++) {
-            for (size_t j = i; j < m_nsp; j++) {
-                m_bdiff(i,j) = exp(dot4(m_polytempvec, m_diffcoeffs[ic]));
-                m_bdiff(j,i) = m_bdiff(i,j);
-                ic++;
-            }
+        for (size_t ic = 0; ic < npairs; ic++) {
+            d[ic] = exp(c0[ic]*p0 + c1[ic]*p1 + c2[ic]*p2 + c3[ic]*p3);
         }
     } else {
-        for (size_t i = 0; i < m_nsp; i++) {
-            for (size_t j = i; j < m_nsp; j++) {
-                m_bdiff(i,j) = m_temp * m_sqrt_t*dot5(m_polytempvec,
-                                                      m_diffcoeffs[ic]);
-                m_bdiff(j,i) = m_bdiff(i,j);
-                ic++;
-            }
+        const double* const c4 = m_diffcoeffsPacked.ptrColumn(4);
+        const double p4 = m_polytempvec[4];
+        for (size_t ic = 0; ic < npairs; ic++) {
+            d[ic] = m_t32 * (c0[ic]*p0 + c1[ic]*p1 + c2[ic]*p2 + c3[ic]*p3 +
+                             c4[ic]*p4);
+        }
+    }
+    unpackBinaryDiffCoeffs();
+}
+
+void GasTransport::unpackBinaryDiffCoeffs()
+{
+    // unpack into the symmetric matrices of the binary diffusion coefficients
+    // and their reciprocals
+    const double* const d = m_bdiffPacked.data();
+    size_t ic = 0;
+    for (size_t i = 0; i < m_nsp; i++) {
+        m_bdiff(i,i) = d[ic++];
+        for (size_t j = i + 1; j < m_nsp; j++) {
+            m_bdiff(i,j) = d[ic];
+            m_bdiff(j,i) = d[ic];
+            m_bdiffInv(i,j) = 1.0 / d[ic];
+            m_bdiffInv(j,i) = m_bdiffInv(i,j);
+            ic++;
         }
     }
     m_bindiff_ok = true;
@@ -252,20 +364,16 @@ void GasTransport::getMixDiffCoeffs(doublereal* const d)
     if (m_nsp == 1) {
         d[0] = m_bdiff(0,0) / p;
     } else {
+        // d[k] = sum_{j != k} X_j / D_jk
+        m_bdiffInv.mult(m_molefracs.data(), d);
         for (size_t k = 0; k < m_nsp; k++) {
             sumxw += m_molefracs[k] * m_mw[k];
         }
         for (size_t k = 0; k < m_nsp; k++) {
-            double sum2 = 0.0;
-            for (size_t j = 0; j < m_nsp; j++) {
-                if (j != k) {
-                    sum2 += m_molefracs[j] / m_bdiff(j,k);
-                }
-            }
-            if (sum2 <= 0.0) {
+            if (d[k] <= 0.0) {
                 d[k] = m_bdiff(k,k) / p;
             } else {
-                d[k] = (sumxw - m_molefracs[k] * m_mw[k])/(p * mmw * sum2);
+                d[k] = (sumxw - m_molefracs[k] * m_mw[k])/(p * mmw * d[k]);
             }
         }
     }
@@ -285,17 +393,13 @@ void GasTransport::getMixDiffCoeffsMole(doublereal* const d)
     if (m_nsp == 1) {
         d[0] = m_bdiff(0,0) / p;
     } else {
+        // d[k] = sum_{j != k} X_j / D_jk
+        m_bdiffInv.mult(m_molefracs.data(), d);
         for (size_t k = 0; k < m_nsp; k++) {
-            double sum2 = 0.0;
-            for (size_t j = 0; j < m_nsp; j++) {
-                if (j != k) {
-                    sum2 += m_molefracs[j] / m_bdiff(j,k);
-                }
-            }
-            if (sum2 <= 0.0) {
+            if (d[k] <= 0.0) {
                 d[k] = m_bdiff(k,k) / p;
             } else {
-                d[k] = (1 - m_molefracs[k]) / (p * sum2);
+                d[k] = (1 - m_molefracs[k]) / (p * d[k]);
             }
         }
     }
@@ -317,18 +421,17 @@ void GasTransport::getMixDiffCoeffsMass(doublereal* const d)
     if (m_nsp == 1) {
         d[0] = m_bdiff(0,0) / p;
     } else {
+        // sum1[k] = sum_{i != k} X_i / D_ki and
+        // sum2[k] = sum_{i != k} X_i M_i / D_ki
+        for (size_t i = 0; i < m_nsp; i++) {
+            m_xmw[i] = m_molefracs[i] * m_mw[i];
+        }
+        m_bdiffInv.mult(m_molefracs.data(), d);
+        m_bdiffInv.mult(m_xmw.data(), m_dwork.data());
         for (size_t k=0; k<m_nsp; k++) {
-            double sum1 = 0.0;
-            double sum2 = 0.0;
-            for (size_t i=0; i<m_nsp; i++) {
-                if (i==k) {
-                    continue;
-                }
-                sum1 += m_molefracs[i] / m_bdiff(k,i);
-                sum2 += m_molefracs[i] * m_mw[i] / m_bdiff(k,i);
-            }
-            sum1 *= p;
-            sum2 *= p * m_molefracs[k] / (mmw - m_mw[k]*m_molefracs[k]);
+            double sum1 = p * d[k];
+            double sum2 = p * m_dwork[k] * m_molefracs[k] /
+                          (mmw - m_mw[k]*m_molefracs[k]);
             d[k] = 1.0 / (sum1 + sum2);
         }
     }
@@ -349,6 +452,9 @@ void GasTransport::init(thermo_t* thermo, int mode, int log_level)
     m_sqvisc.resize(m_nsp);
     m_phi.resize(m_nsp, m_nsp, 0.0);
     m_bdiff.resize(m_nsp, m_nsp);
+    m_bdiffInv.resize(m_nsp, m_nsp, 0.0);
+    m_xmw.resize(m_nsp);
+    m_dwork.resize(m_nsp);
 
     // make a local copy of the molecular weights
     m_mw = m_thermo->molecularWeights();
@@ -359,7 +465,10 @@ void GasTransport::init(thermo_t* thermo, int mode, int log_level)
         for (size_t k = j; k < m_nsp; k++) {
             m_wratjk(j,k) = sqrt(m_mw[j]/m_mw[k]);
             m_wratjk(k,j) = sqrt(m_wratjk(j,k));
-            m_wratkj1(j,k) = sqrt(1.0 + m_mw[k]/m_mw[j]);
+            m_wratkj1(j,k) = 1.0 / sqrt(8.0 * (1.0 + m_mw[k]/m_mw[j]));
+            if (k != j) {
+                m_wratkj1(k,j) = m_mw[k]/m_mw[j];
+            }
         }
     }
 
@@ -439,6 +548,21 @@ void GasTransport::setupMM()
         tstar_max = 99.9;
     }
 
+    // use previously generated fits if available
+    std::string cacheFile;
+    uint64_t key = 0;
+    if (!m_fitCacheDir.empty()) {
+        key = fitCacheKey();
+        cacheFile = m_fitCacheDir + "/transport-fits-" +
+                    fmt::format("{:016x}", key) + ".bin";
+        if (readFitCache(cacheFile, key)) {
+            debuglog("*** polynomial fits read from '" + cacheFile + "' ***\n",
+                     m_log_level);
+            packDiffCoeffs();
+            return;
+        }
+    }
+
     // initialize the collision integral calculator for the desired T* range
     debuglog("*** collision_integrals ***\n", m_log_level);
     MMCollisionInt integrals;
@@ -449,6 +573,134 @@ void GasTransport::setupMM()
     debuglog("*** property fits ***\n", m_log_level);
     fitProperties(integrals);
     debuglog("*** end of property fits ***\n", m_log_level);
+    packDiffCoeffs();
+
+    if (!cacheFile.empty()) {
+        writeFitCache(cacheFile, key);
+    }
+}
+
+void GasTransport::packDiffCoeffs()
+{
+    size_t npairs = m_diffcoeffs.size();
+    size_t ncoeffs = (m_mode == CK_Mode ? 4 : 5);
+    m_diffcoeffsPacked.resize(npairs, ncoeffs);
+    for (size_t ic = 0; ic < npairs; ic++) {
+        for (size_t n = 0; n < ncoeffs; n++) {
+            m_diffcoeffsPacked(ic, n) = m_diffcoeffs[ic][n];
+        }
+    }
+    m_bdiffPacked.resize(npairs);
+}
+
+uint64_t GasTransport::fitCacheKey()
+{
+    uint64_t h = 14695981039346656037ULL;
+    hashValue(h, FitCacheVersion);
+    hashValue(h, static_cast<uint64_t>(m_mode));
+    hashValue(h, static_cast<uint64_t>(m_nsp));
+    hashValue(h, m_thermo->minTemp());
+    hashValue(h, m_thermo->maxTemp());
+    for (size_t k = 0; k < m_nsp; k++) {
+        hashValue(h, m_thermo->speciesName(k));
+        hashValue(h, m_thermo->molecularWeight(k));
+        hashValue(h, m_crot[k]);
+        hashValue(h, m_sigma[k]);
+        hashValue(h, m_eps[k]);
+        hashValue(h, m_dipole(k,k));
+        hashValue(h, m_alpha[k]);
+        hashValue(h, m_zrot[k]);
+    }
+
+    // The conductivity fits depend on the species heat capacities at the
+    // temperatures used in fitProperties()
+    const size_t np = 50;
+    double dt = (m_thermo->maxTemp() - m_thermo->minTemp())/(np-1);
+    vector_fp cp_R(m_nsp);
+    for (size_t n = 0; n < np; n++) {
+        m_thermo->setTemperature(m_thermo->minTemp() + dt*n);
+        m_thermo->getCp_R_ref(cp_R.data());
+        for (size_t k = 0; k < m_nsp; k++) {
+            hashValue(h, cp_R[k]);
+        }
+    }
+    return h;
+}
+
+bool GasTransport::readFitCache(const std::string& fname, uint64_t key)
+{
+    std::ifstream f(fname, std::ios::binary);
+    uint64_t version, fkey, nsp;
+    if (!f || !readValue(f, version) || version != FitCacheVersion ||
+        !readValue(f, fkey) || fkey != key ||
+        !readValue(f, nsp) || nsp != m_nsp) {
+        return false;
+    }
+
+    std::vector<vector_int> poly(m_nsp, vector_int(m_nsp));
+    for (size_t i = 0; i < m_nsp; i++) {
+        f.read(reinterpret_cast<char*>(poly[i].data()), m_nsp * sizeof(int));
+    }
+    size_t ncoll = (m_mode == CK_Mode ? 7 : COLL_INT_POLY_DEGREE + 1);
+    size_t nprop = (m_mode == CK_Mode ? 4 : 5);
+    std::vector<vector_fp> om22, astar, bstar, cstar, visc, cond, diff;
+    if (!f || !readCoeffs(f, om22, ncoll) || !readCoeffs(f, astar, ncoll) ||
+        !readCoeffs(f, bstar, ncoll) || !readCoeffs(f, cstar, ncoll) ||
+        !readCoeffs(f, visc, nprop) || !readCoeffs(f, cond, nprop) ||
+        !readCoeffs(f, diff, nprop) || visc.size() != m_nsp ||
+        cond.size() != m_nsp || diff.size() != m_nsp*(m_nsp+1)/2) {
+        return false;
+    }
+    for (size_t i = 0; i < m_nsp; i++) {
+        for (size_t j = 0; j < m_nsp; j++) {
+            if (poly[i][j] < 0 || poly[i][j] >= static_cast<int>(astar.size())) {
+                return false;
+            }
+        }
+    }
+
+    m_poly.swap(poly);
+    m_omega22_poly.swap(om22);
+    m_astar_poly.swap(astar);
+    m_bstar_poly.swap(bstar);
+    m_cstar_poly.swap(cstar);
+    m_visccoeffs.swap(visc);
+    m_condcoeffs.swap(cond);
+    m_diffcoeffs.swap(diff);
+    return true;
+}
+
+void GasTransport::writeFitCache(const std::string& fname, uint64_t key)
+{
+    std::string tmpname = fname + fmt::format(".{}.tmp",
+                                              static_cast<const void*>(this));
+    {
+        std::ofstream f(tmpname, std::ios::binary);
+        writeValue(f, FitCacheVersion);
+        writeValue(f, key);
+        writeValue(f, m_nsp);
+        for (size_t i = 0; i < m_nsp; i++) {
+            f.write(reinterpret_cast<const char*>(m_poly[i].data()),
+                    m_nsp * sizeof(int));
+        }
+        writeCoeffs(f, m_omega22_poly);
+        writeCoeffs(f, m_astar_poly);
+        writeCoeffs(f, m_bstar_poly);
+        writeCoeffs(f, m_cstar_poly);
+        writeCoeffs(f, m_visccoeffs);
+        writeCoeffs(f, m_condcoeffs);
+        writeCoeffs(f, m_diffcoeffs);
+        if (!f) {
+            debuglog("could not write transport fit cache '" + fname + "'\n",
+                     m_log_level);
+            f.close();
+            std::remove(tmpname.c_str());
+            return;
+        }
+    }
+    if (std::rename(tmpname.c_str(), fname.c_str()) != 0) {
+        std::remove(tmpname.c_str());
+    }
 }
 
 void GasTransport::getTransportData()
@@ -778,6 +1030,7 @@ void GasTransport::fitProperties(MMCollisionInt& integrals)
             }
         }
     }
+
     if (m_log_level) {
         writelogf("Maximum binary diffusion coefficient absolute error:"
                  "  %12.6g\n", mxerr);
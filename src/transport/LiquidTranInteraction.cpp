@@ -41,7 +41,8 @@ public:
 
 LiquidTranInteraction::LiquidTranInteraction(TransportPropertyType tp_ind) :
     m_model(LTI_MODEL_NOTSET),
-    m_property(tp_ind)
+    m_property(tp_ind),
+    m_Ctemp(-1.0)
 {
 }
 
@@ -161,6 +162,8 @@ void LiquidTranInteraction::init(const XML_Node& compModelNode,
             m_Dij(jSpecies,iSpecies) = m_Dij(iSpecies,jSpecies);
         }
     }
+    m_Ctemp = -1.0;
+    m_work.resize(nsp);
 }
 
 LiquidTranInteraction::LiquidTranInteraction(const LiquidTranInteraction& right)
@@ -180,10 +183,59 @@ LiquidTranInteraction& LiquidTranInteraction::operator=(const LiquidTranInteract
         m_Hij = right.m_Hij;
         m_Sij = right.m_Sij;
         m_Dij = right.m_Dij;
+        m_Cij = right.m_Cij;
+        m_Ctemp = right.m_Ctemp;
+        m_work = right.m_work;
     }
     return *this;
 }
 
+doublereal LiquidTranInteraction::interactionSum(const doublereal* x)
+{
+    doublereal temp = m_thermo->temperature();
+    if (temp != m_Ctemp) {
+        updateInteractions_T(temp);
+        m_Ctemp = temp;
+    }
+    size_t nsp = m_thermo->nSpecies();
+    doublereal value = 0.0;
+    for (size_t i = 0; i < nsp; i++) {
+        // x_i * x_i^k
+        doublereal xik = x[i];
+        for (size_t k = 0; k < m_Cij.size(); k++) {
+            const doublereal* c = m_Cij[k].ptrColumn(i);
+            doublereal sum = 0.0;
+            for (size_t j = 0; j < nsp; j++) {
+                sum += c[j] * x[j];
+            }
+            value += xik * sum;
+            xik *= x[i];
+        }
+    }
+    return value;
+}
+
+void LiquidTranInteraction::updateInteractions_T(doublereal T)
+{
+    size_t nsp = m_thermo->nSpecies();
+    m_Cij.resize(std::max(m_Aij.size(), m_Bij.size()));
+    for (size_t k = 0; k < m_Cij.size(); k++) {
+        DenseMatrix& C = m_Cij[k];
+        C.resize(nsp, nsp, 0.0);
+        for (size_t i = 0; i < nsp; i++) {
+            for (size_t j = 0; j < nsp; j++) {
+                C(j,i) = 0.0;
+                if (k < m_Aij.size()) {
+                    C(j,i) += (*m_Aij[k])(i,j);
+                }
+                if (k < m_Bij.size()) {
+                    C(j,i) += (*m_Bij[k])(i,j) * T;
+                }
+            }
+        }
+    }
+}
+
 LTI_Solvent::LTI_Solvent(TransportPropertyType tp_ind) :
     LiquidTranInteraction(tp_ind)
 {
@@ -193,17 +245,12 @@ LTI_Solvent::LTI_Solvent(TransportPropertyType tp_ind) :
 doublereal LTI_Solvent::getMixTransProp(doublereal* speciesValues, doublereal* speciesWeight)
 {
     size_t nsp = m_thermo->nSpecies();
-    doublereal temp = m_thermo->temperature();
-    vector_fp molefracs(nsp);
-    m_thermo->getMoleFractions(&molefracs[0]);
+    m_work.resize(nsp);
+    m_thermo->getMoleFractions(m_work.data());
     doublereal value = 0.0;
 
     //if weightings are specified, use those
-    if (speciesWeight) {
-        for (size_t k = 0; k < nsp; k++) {
-            // should be: molefracs[k] = molefracs[k]*speciesWeight[k]; for consistency, but weight(solvent)=1?
-        }
-    } else {
+    if (!speciesWeight) {
         throw CanteraError("LTI_Solvent::getMixTransProp","You should be specifying the speciesWeight");
     }
 
@@ -215,43 +262,22 @@ doublereal LTI_Solvent::getMixTransProp(doublereal* speciesValues, doublereal* s
         } else {
             AssertTrace(speciesWeight[i] == 0.0);
         }
-        for (size_t j = 0; j < nsp; j++) {
-            for (size_t k = 0; k < m_Aij.size(); k++) {
-                value += molefracs[i]*molefracs[j]*(*m_Aij[k])(i,j)*pow(molefracs[i], (int) k);
-            }
-            for (size_t k = 0; k < m_Bij.size(); k++) {
-                value += molefracs[i]*molefracs[j]*(*m_Bij[k])(i,j)*temp*pow(molefracs[i], (int) k);
-            }
-        }
     }
-    return value;
+    return value + interactionSum(m_work.data());
 }
 
-doublereal LTI_Solvent::getMixTransProp(std::vector<LTPspecies*> LTPptrs)
+doublereal LTI_Solvent::getMixTransProp(const std::vector<LTPspecies*>& LTPptrs)
 {
     size_t nsp = m_thermo->nSpecies();
-    doublereal temp = m_thermo->temperature();
-    vector_fp molefracs(nsp);
-    m_thermo->getMoleFractions(&molefracs[0]);
+    m_work.resize(nsp);
+    m_thermo->getMoleFractions(m_work.data());
     doublereal value = 0.0;
 
-    for (size_t k = 0; k < nsp; k++) {
-        // should be:      molefracs[k] = molefracs[k]*LTPptrs[k]->getMixWeight(); for consistency, but weight(solvent)=1?
-    }
-
     for (size_t i = 0; i < nsp; i++) {
         //presume that the weighting is set to 1.0 for solvent and 0.0 for everything else.
         value += LTPptrs[i]->getSpeciesTransProp() * LTPptrs[i]->getMixWeight();
-        for (size_t j = 0; j < nsp; j++) {
-            for (size_t k = 0; k < m_Aij.size(); k++) {
-                value += molefracs[i]*molefracs[j]*(*m_Aij[k])(i,j)*pow(molefracs[i], (int) k);
-            }
-            for (size_t k = 0; k < m_Bij.size(); k++) {
-                value += molefracs[i]*molefracs[j]*(*m_Bij[k])(i,j)*temp*pow(molefracs[i], (int) k);
-            }
-        }
     }
-    return value;
+    return value + interactionSum(m_work.data());
 }
 
 void LTI_Solvent::getMatrixTransProp(DenseMatrix& mat, doublereal* speciesValues)
@@ -262,9 +288,9 @@ void LTI_Solvent::getMatrixTransProp(DenseMatrix& mat, doublereal* speciesValues
 doublereal LTI_MoleFracs::getMixTransProp(doublereal* speciesValues, doublereal* speciesWeight)
 {
     size_t nsp = m_thermo->nSpecies();
-    doublereal temp = m_thermo->temperature();
-    vector_fp molefracs(nsp);
-    m_thermo->getMoleFractions(&molefracs[0]);
+    m_work.resize(nsp);
+    doublereal* molefracs = m_work.data();
+    m_thermo->getMoleFractions(molefracs);
     doublereal value = 0;
 
     //if weightings are specified, use those
@@ -278,24 +304,16 @@ doublereal LTI_MoleFracs::getMixTransProp(doublereal* speciesValues, doublereal*
 
     for (size_t i = 0; i < nsp; i++) {
         value += speciesValues[i] * molefracs[i];
-        for (size_t j = 0; j < nsp; j++) {
-            for (size_t k = 0; k < m_Aij.size(); k++) {
-                value += molefracs[i]*molefracs[j]*(*m_Aij[k])(i,j)*pow(molefracs[i], (int) k);
-            }
-            for (size_t k = 0; k < m_Bij.size(); k++) {
-                value += molefracs[i]*molefracs[j]*(*m_Bij[k])(i,j)*temp*pow(molefracs[i], (int) k);
-            }
-        }
     }
-    return value;
+    return value + interactionSum(molefracs);
 }
 
-doublereal LTI_MoleFracs::getMixTransProp(std::vector<LTPspecies*> LTPptrs)
+doublereal LTI_MoleFracs::getMixTransProp(const std::vector<LTPspecies*>& LTPptrs)
 {
     size_t nsp = m_thermo->nSpecies();
-    doublereal temp = m_thermo->temperature();
-    vector_fp molefracs(nsp);
-    m_thermo->getMoleFractions(&molefracs[0]);
+    m_work.resize(nsp);
+    doublereal* molefracs = m_work.data();
+    m_thermo->getMoleFractions(molefracs);
     doublereal value = 0;
 
     for (size_t k = 0; k < nsp; k++) {
@@ -304,24 +322,16 @@ doublereal LTI_MoleFracs::getMixTransProp(std::vector<LTPspecies*> LTPptrs)
 
     for (size_t i = 0; i < nsp; i++) {
         value += LTPptrs[i]->getSpeciesTransProp() * molefracs[i];
-        for (size_t j = 0; j < nsp; j++) {
-            for (size_t k = 0; k < m_Aij.size(); k++) {
-                value += molefracs[i]*molefracs[j]*(*m_Aij[k])(i,j)*pow(molefracs[i], (int) k);
-            }
-            for (size_t k = 0; k < m_Bij.size(); k++) {
-                value += molefracs[i]*molefracs[j]*(*m_Bij[k])(i,j)*temp*pow(molefracs[i], (int) k);
-            }
-        }
     }
-    return value;
+    return value + interactionSum(molefracs);
 }
 
 doublereal LTI_MassFracs::getMixTransProp(doublereal* speciesValues, doublereal* speciesWeight)
 {
     size_t nsp = m_thermo->nSpecies();
-    doublereal temp = m_thermo->temperature();
-    vector_fp massfracs(nsp);
-    m_thermo->getMassFractions(&massfracs[0]);
+    m_work.resize(nsp);
+    doublereal* massfracs = m_work.data();
+    m_thermo->getMassFractions(massfracs);
     doublereal value = 0;
 
     //if weightings are specified, use those
@@ -335,25 +345,16 @@ doublereal LTI_MassFracs::getMixTransProp(doublereal* speciesValues, doublereal*
 
     for (size_t i = 0; i < nsp; i++) {
         value += speciesValues[i] * massfracs[i];
-        for (size_t j = 0; j < nsp; j++) {
-            for (size_t k = 0; k < m_Aij.size(); k++) {
-                value += massfracs[i]*massfracs[j]*(*m_Aij[k])(i,j)*pow(massfracs[i], (int) k);
-            }
-            for (size_t k = 0; k < m_Bij.size(); k++) {
-                value += massfracs[i]*massfracs[j]*(*m_Bij[k])(i,j)*temp*pow(massfracs[i], (int) k);
-            }
-        }
     }
-
-    return value;
+    return value + interactionSum(massfracs);
 }
 
-doublereal LTI_MassFracs::getMixTransProp(std::vector<LTPspecies*> LTPptrs)
+doublereal LTI_MassFracs::getMixTransProp(const std::vector<LTPspecies*>& LTPptrs)
 {
     size_t nsp = m_thermo->nSpecies();
-    doublereal temp = m_thermo->temperature();
-    vector_fp massfracs(nsp);
-    m_thermo->getMassFractions(&massfracs[0]);
+    m_work.resize(nsp);
+    doublereal* massfracs = m_work.data();
+    m_thermo->getMassFractions(massfracs);
     doublereal value = 0;
 
     for (size_t k = 0; k < nsp; k++) {
@@ -362,24 +363,16 @@ doublereal LTI_MassFracs::getMixTransProp(std::vector<LTPspecies*> LTPptrs)
 
     for (size_t i = 0; i < nsp; i++) {
         value += LTPptrs[i]->getSpeciesTransProp() * massfracs[i];
-        for (size_t j = 0; j < nsp; j++) {
-            for (size_t k = 0; k < m_Aij.size(); k++) {
-                value += massfracs[i]*massfracs[j]*(*m_Aij[k])(i,j)*pow(massfracs[i], (int) k);
-            }
-            for (size_t k = 0; k < m_Bij.size(); k++) {
-                value += massfracs[i]*massfracs[j]*(*m_Bij[k])(i,j)*temp*pow(massfracs[i], (int) k);
-            }
-        }
     }
-    return value;
+    return value + interactionSum(massfracs);
 }
 
 doublereal LTI_Log_MoleFracs::getMixTransProp(doublereal* speciesValues, doublereal* speciesWeight)
 {
     size_t nsp = m_thermo->nSpecies();
-    doublereal temp = m_thermo->temperature();
-    vector_fp molefracs(nsp);
-    m_thermo->getMoleFractions(&molefracs[0]);
+    m_work.resize(nsp);
+    doublereal* molefracs = m_work.data();
+    m_thermo->getMoleFractions(molefracs);
     doublereal value = 0;
 
     //if weightings are specified, use those
@@ -393,24 +386,16 @@ doublereal LTI_Log_MoleFracs::getMixTransProp(doublereal* speciesValues, doubler
 
     for (size_t i = 0; i < nsp; i++) {
         value += log(speciesValues[i]) * molefracs[i];
-        for (size_t j = 0; j < nsp; j++) {
-            for (size_t k = 0; k < m_Hij.size(); k++) {
-                value += molefracs[i]*molefracs[j]*(*m_Hij[k])(i,j)/temp*pow(molefracs[i], (int) k);
-            }
-            for (size_t k = 0; k < m_Sij.size(); k++) {
-                value -= molefracs[i]*molefracs[j]*(*m_Sij[k])(i,j)*pow(molefracs[i], (int) k);
-            }
-        }
     }
-    return exp(value);
+    return exp(value + interactionSum(molefracs));
 }
 
-doublereal LTI_Log_MoleFracs::getMixTransProp(std::vector<LTPspecies*> LTPptrs)
+doublereal LTI_Log_MoleFracs::getMixTransProp(const std::vector<LTPspecies*>& LTPptrs)
 {
     size_t nsp = m_thermo->nSpecies();
-    doublereal temp = m_thermo->temperature();
-    vector_fp molefracs(nsp);
-    m_thermo->getMoleFractions(&molefracs[0]);
+    m_work.resize(nsp);
+    doublereal* molefracs = m_work.data();
+    m_thermo->getMoleFractions(molefracs);
     doublereal value = 0;
 
     //if weightings are specified, use those
@@ -420,17 +405,29 @@ doublereal LTI_Log_MoleFracs::getMixTransProp(std::vector<LTPspecies*> LTPptrs)
 
     for (size_t i = 0; i < nsp; i++) {
         value += log(LTPptrs[i]->getSpeciesTransProp()) * molefracs[i];
-        for (size_t j = 0; j < nsp; j++) {
-            for (size_t k = 0; k < m_Hij.size(); k++) {
-                value += molefracs[i]*molefracs[j]*(*m_Hij[k])(i,j)/temp*pow(molefracs[i], (int) k);
-            }
-            for (size_t k = 0; k < m_Sij.size(); k++) {
-                value -= molefracs[i]*molefracs[j]*(*m_Sij[k])(i,j)*pow(molefracs[i], (int) k);
+    }
+    return exp(value + interactionSum(molefracs));
+}
+
+void LTI_Log_MoleFracs::updateInteractions_T(doublereal T)
+{
+    size_t nsp = m_thermo->nSpecies();
+    m_Cij.resize(std::max(m_Hij.size(), m_Sij.size()));
+    for (size_t k = 0; k < m_Cij.size(); k++) {
+        DenseMatrix& C = m_Cij[k];
+        C.resize(nsp, nsp, 0.0);
+        for (size_t i = 0; i < nsp; i++) {
+            for (size_t j = 0; j < nsp; j++) {
+                C(j,i) = 0.0;
+                if (k < m_Hij.size()) {
+                    C(j,i) += (*m_Hij[k])(i,j) / T;
+                }
+                if (k < m_Sij.size()) {
+                    C(j,i) -= (*m_Sij[k])(i,j);
+                }
             }
         }
     }
-    value = exp(value);
-    return value;
 }
 
 void LTI_Pairwise_Interaction::setParameters(LiquidTransportParams& trParam)
@@ -456,7 +453,7 @@ doublereal LTI_Pairwise_Interaction::getMixTransProp(doublereal* speciesValues,
     return value;
 }
 
-doublereal LTI_Pairwise_Interaction::getMixTransProp(std::vector<LTPspecies*> LTPptrs)
+doublereal LTI_Pairwise_Interaction::getMixTransProp(const std::vector<LTPspecies*>& LTPptrs)
 {
     size_t nsp = m_thermo->nSpecies();
     vector_fp molefracs(nsp);
@@ -532,7 +529,7 @@ doublereal LTI_StefanMaxwell_PPN::getMixTransProp(doublereal* speciesValues, dou
     return value;
 }
 
-doublereal LTI_StefanMaxwell_PPN::getMixTransProp(std::vector<LTPspecies*> LTPptrs)
+doublereal LTI_StefanMaxwell_PPN::getMixTransProp(const std::vector<LTPspecies*>& LTPptrs)
 {
     size_t nsp = m_thermo->nSpecies();
     vector_fp molefracs(nsp);
@@ -627,7 +624,7 @@ doublereal LTI_StokesEinstein::getMixTransProp(doublereal* speciesValues, double
     return value;
 }
 
-doublereal LTI_StokesEinstein::getMixTransProp(std::vector<LTPspecies*> LTPptrs)
+doublereal LTI_StokesEinstein::getMixTransProp(const std::vector<LTPspecies*>& LTPptrs)
 {
     size_t nsp = m_thermo->nSpecies();
     vector_fp molefracs(nsp);
@@ -672,9 +669,9 @@ void LTI_StokesEinstein::getMatrixTransProp(DenseMatrix& mat, doublereal* specie
 doublereal LTI_MoleFracs_ExpT::getMixTransProp(doublereal* speciesValues, doublereal* speciesWeight)
 {
     size_t nsp = m_thermo->nSpecies();
-    doublereal temp = m_thermo->temperature();
-    vector_fp molefracs(nsp);
-    m_thermo->getMoleFractions(&molefracs[0]);
+    m_work.resize(nsp);
+    doublereal* molefracs = m_work.data();
+    m_thermo->getMoleFractions(molefracs);
     doublereal value = 0;
 
     //if weightings are specified, use those
@@ -688,21 +685,16 @@ doublereal LTI_MoleFracs_ExpT::getMixTransProp(doublereal* speciesValues, double
 
     for (size_t i = 0; i < nsp; i++) {
         value += speciesValues[i] * molefracs[i];
-        for (size_t j = 0; j < nsp; j++) {
-            for (size_t k = 0; k < m_Aij.size(); k++) {
-                value += molefracs[i]*molefracs[j]*(*m_Aij[k])(i,j)*pow(molefracs[i], (int) k)*exp((*m_Bij[k])(i,j)*temp);
-            }
-        }
     }
-    return value;
+    return value + interactionSum(molefracs);
 }
 
-doublereal LTI_MoleFracs_ExpT::getMixTransProp(std::vector<LTPspecies*> LTPptrs)
+doublereal LTI_MoleFracs_ExpT::getMixTransProp(const std::vector<LTPspecies*>& LTPptrs)
 {
     size_t nsp = m_thermo->nSpecies();
-    doublereal temp = m_thermo->temperature();
-    vector_fp molefracs(nsp);
-    m_thermo->getMoleFractions(&molefracs[0]);
+    m_work.resize(nsp);
+    doublereal* molefracs = m_work.data();
+    m_thermo->getMoleFractions(molefracs);
     doublereal value = 0;
 
     for (size_t k = 0; k < nsp; k++) {
@@ -711,13 +703,26 @@ doublereal LTI_MoleFracs_ExpT::getMixTransProp(std::vector<LTPspecies*> LTPptrs)
 
     for (size_t i = 0; i < nsp; i++) {
         value += LTPptrs[i]->getSpeciesTransProp() * molefracs[i];
-        for (size_t j = 0; j < nsp; j++) {
-            for (size_t k = 0; k < m_Aij.size(); k++) {
-                value += molefracs[i]*molefracs[j]*(*m_Aij[k])(i,j)*pow(molefracs[i], (int) k)*exp((*m_Bij[k])(i,j)*temp);
+    }
+    return value + interactionSum(molefracs);
+}
+
+void LTI_MoleFracs_ExpT::updateInteractions_T(doublereal T)
+{
+    size_t nsp = m_thermo->nSpecies();
+    m_Cij.resize(m_Aij.size());
+    for (size_t k = 0; k < m_Cij.size(); k++) {
+        DenseMatrix& C = m_Cij[k];
+        C.resize(nsp, nsp, 0.0);
+        for (size_t i = 0; i < nsp; i++) {
+            for (size_t j = 0; j < nsp; j++) {
+                C(j,i) = (*m_Aij[k])(i,j);
+                if (k < m_Bij.size()) {
+                    C(j,i) *= exp((*m_Bij[k])(i,j) * T);
+                }
             }
         }
     }
-    return value;
 }
 
 } //namespace Cantera
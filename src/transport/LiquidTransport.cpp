@@ -21,6 +21,7 @@ LiquidTransport::LiquidTransport(thermo_t* thermo, int ndim) :
     concTot_(0.0),
     concTot_tran_(0.0),
     dens_(0.0),
+    m_velocityBasisA(VB_MASSAVG),
     m_temp(-1.0),
     m_press(-1.0),
     m_lambda(-1.0),
@@ -62,6 +63,7 @@ LiquidTransport::LiquidTransport(const LiquidTransport& right) :
     concTot_(0.0),
     concTot_tran_(0.0),
     dens_(0.0),
+    m_velocityBasisA(VB_MASSAVG),
     m_temp(-1.0),
     m_press(-1.0),
     m_lambda(-1.0),
@@ -140,6 +142,7 @@ LiquidTransport& LiquidTransport::operator=(const LiquidTransport& right)
     m_chargeSpecies = right.m_chargeSpecies;
     m_B = right.m_B;
     m_A = right.m_A;
+    m_velocityBasisA = right.m_velocityBasisA;
     m_temp = right.m_temp;
     m_press = right.m_press;
     m_flux = right.m_flux;
@@ -348,6 +351,8 @@ bool LiquidTransport::initLiquid(LiquidTransportParams& tr)
     m_Grad_mu.resize(m_nDim * m_nsp, 0.0);
     m_flux.resize(m_nsp, m_nDim, 0.0);
     m_Vdiff.resize(m_nsp, m_nDim, 0.0);
+    m_A.resize(m_nsp, m_nsp, 0.0);
+    m_B.resize(m_nsp, m_nDim, 0.0);
 
     // set all flags to false
     m_visc_mix_ok = false;
@@ -380,6 +385,7 @@ doublereal LiquidTransport::viscosity()
     }
     ////// LiquidTranInteraction method
     m_viscmix = m_viscMixModel->getMixTransProp(m_viscTempDep_Ns);
+    m_visc_mix_ok = true;
     return m_viscmix;
 }
 
@@ -401,6 +407,7 @@ doublereal LiquidTransport::ionConductivity()
     }
     ////// LiquidTranInteraction method
     m_ionCondmix = m_ionCondMixModel->getMixTransProp(m_ionCondTempDep_Ns);
+    m_ionCond_mix_ok = true;
     return m_ionCondmix;
 }
 
@@ -427,6 +434,7 @@ void LiquidTransport::mobilityRatio(doublereal* mobRat)
                 }
             }
         }
+        m_mobRat_mix_ok = true;
     }
     for (size_t k = 0; k < m_nsp2; k++) {
         mobRat[k] = m_mobRatMix[k];
@@ -454,6 +462,7 @@ void LiquidTransport::selfDiffusion(doublereal* const selfDiff)
         for (size_t k = 0; k < m_nsp; k++) {
             m_selfDiffMix[k] = m_selfDiffMixModel[k]->getMixTransProp(m_selfDiffTempDep_Ns[k]);
         }
+        m_selfDiff_mix_ok = true;
     }
     for (size_t k = 0; k < m_nsp; k++) {
         selfDiff[k] = m_selfDiffMix[k];
@@ -488,7 +497,7 @@ doublereal LiquidTransport::thermalConductivity()
     update_C();
     if (!m_lambda_mix_ok) {
         m_lambda = m_lambdaMixModel->getMixTransProp(m_lambdaTempDep_Ns);
-        m_cond_mix_ok = true;
+        m_lambda_mix_ok = true;
     }
     return m_lambda;
 }
@@ -905,14 +914,8 @@ void LiquidTransport::update_Grad_lnAC()
 
 void LiquidTransport::stefan_maxwell_solve()
 {
-    doublereal tmp;
-    m_B.resize(m_nsp, m_nDim, 0.0);
-    m_A.resize(m_nsp, m_nsp, 0.0);
-
     //! grab a local copy of the molecular weights
     const vector_fp& M = m_thermo->molecularWeights();
-    //! grad a local copy of the ion molar volume (inverse total ion concentration)
-    const doublereal vol = m_thermo->molarVolume();
 
     //! Update the temperature, concentrations and diffusion coefficients in the
     //! mixture.
@@ -924,7 +927,6 @@ void LiquidTransport::stefan_maxwell_solve()
 
     double T = m_thermo->temperature();
     update_Grad_lnAC();
-    m_thermo->getActivityCoefficients(m_actCoeff.data());
 
     /*
      *  Calculate the electrochemical potential gradient. This is the
@@ -973,11 +975,11 @@ void LiquidTransport::stefan_maxwell_solve()
 
     // Just for Note, m_A(i,j) refers to the ith row and jth column.
     // They are still fortran ordered, so that i varies fastest.
-    double condSum1;
-    const doublereal invRT = 1.0 / (GasConstant * T);
-    switch (m_nDim) {
-    case 1: // 1-D approximation
-        m_B(0,0) = 0.0;
+    //
+    // The matrix does not depend on the gradients, so it is only formed and
+    // factored when the temperature, the composition or the velocity basis
+    // have changed.
+    if (!m_diff_mix_ok || m_velocityBasis != m_velocityBasisA) {
         // equation for the reference velocity
         for (size_t j = 0; j < m_nsp; j++) {
             if (m_velocityBasis == VB_MOLEAVG) {
@@ -998,106 +1000,32 @@ void LiquidTransport::stefan_maxwell_solve()
             }
         }
         for (size_t i = 1; i < m_nsp; i++) {
-            m_B(i,0) = m_Grad_mu[i] * invRT;
             m_A(i,i) = 0.0;
             for (size_t j = 0; j < m_nsp; j++) {
                 if (j != i) {
-                    tmp = m_molefracs_tran[j] * m_bdiff(i,j);
+                    doublereal tmp = m_molefracs_tran[j] * m_bdiff(i,j);
                     m_A(i,i) -= tmp;
                     m_A(i,j) = tmp;
                 }
             }
         }
+        m_A.factor();
+        m_velocityBasisA = m_velocityBasis;
+        m_diff_mix_ok = true;
+    }
 
-        // invert and solve the system  Ax = b. Answer is in m_B
-        solve(m_A, m_B);
-        condSum1 = 0;
-        for (size_t i = 0; i < m_nsp; i++) {
-            condSum1 -= Faraday*m_chargeSpecies[i]*m_B(i,0)*m_molefracs_tran[i]/vol;
-        }
-        break;
-    case 2: // 2-D approximation
-        m_B(0,0) = 0.0;
-        m_B(0,1) = 0.0;
-        //equation for the reference velocity
-        for (size_t j = 0; j < m_nsp; j++) {
-            if (m_velocityBasis == VB_MOLEAVG) {
-                m_A(0,j) = m_molefracs_tran[j];
-            } else if (m_velocityBasis == VB_MASSAVG) {
-                m_A(0,j) = m_massfracs_tran[j];
-            } else if ((m_velocityBasis >= 0)
-                       && (m_velocityBasis < static_cast<int>(m_nsp))) {
-                // use species number m_velocityBasis as reference velocity
-                if (m_velocityBasis == static_cast<int>(j)) {
-                    m_A(0,j) = 1.0;
-                } else {
-                    m_A(0,j) = 0.0;
-                }
-            } else {
-                throw CanteraError("LiquidTransport::stefan_maxwell_solve",
-                                   "Unknown reference velocity provided.");
-            }
-        }
-        for (size_t i = 1; i < m_nsp; i++) {
-            m_B(i,0) = m_Grad_mu[i] * invRT;
-            m_B(i,1) = m_Grad_mu[m_nsp + i] * invRT;
-            m_A(i,i) = 0.0;
-            for (size_t j = 0; j < m_nsp; j++) {
-                if (j != i) {
-                    tmp = m_molefracs_tran[j] * m_bdiff(i,j);
-                    m_A(i,i) -= tmp;
-                    m_A(i,j) = tmp;
-                }
-            }
-        }
-
-        // invert and solve the system  Ax = b. Answer is in m_B
-        solve(m_A, m_B);
-        break;
-    case 3: // 3-D approximation
-        m_B(0,0) = 0.0;
-        m_B(0,1) = 0.0;
-        m_B(0,2) = 0.0;
-        // equation for the reference velocity
-        for (size_t j = 0; j < m_nsp; j++) {
-            if (m_velocityBasis == VB_MOLEAVG) {
-                m_A(0,j) = m_molefracs_tran[j];
-            } else if (m_velocityBasis == VB_MASSAVG) {
-                m_A(0,j) = m_massfracs_tran[j];
-            } else if ((m_velocityBasis >= 0)
-                       && (m_velocityBasis < static_cast<int>(m_nsp))) {
-                // use species number m_velocityBasis as reference velocity
-                if (m_velocityBasis == static_cast<int>(j)) {
-                    m_A(0,j) = 1.0;
-                } else {
-                    m_A(0,j) = 0.0;
-                }
-            } else {
-                throw CanteraError("LiquidTransport::stefan_maxwell_solve",
-                                   "Unknown reference velocity provided.");
-            }
-        }
+    // right-hand sides for each dimension
+    const doublereal invRT = 1.0 / (GasConstant * T);
+    for (size_t a = 0; a < m_nDim; a++) {
+        m_B(0,a) = 0.0;
         for (size_t i = 1; i < m_nsp; i++) {
-            m_B(i,0) = m_Grad_mu[i] * invRT;
-            m_B(i,1) = m_Grad_mu[m_nsp + i] * invRT;
-            m_B(i,2) = m_Grad_mu[2*m_nsp + i] * invRT;
-            m_A(i,i) = 0.0;
-            for (size_t j = 0; j < m_nsp; j++) {
-                if (j != i) {
-                    tmp = m_molefracs_tran[j] * m_bdiff(i,j);
-                    m_A(i,i) -= tmp;
-                    m_A(i,j) = tmp;
-                }
-            }
+            m_B(i,a) = m_Grad_mu[a*m_nsp + i] * invRT;
         }
-
-        // invert and solve the system  Ax = b. Answer is in m_B
-        solve(m_A, m_B);
-        break;
-    default:
-        throw CanteraError("routine", "not done");
     }
 
+    // solve the system  Ax = b using the factored matrix. Answer is in m_B
+    m_A.solve(m_B.ptrColumn(0), m_nDim, m_nsp);
+
     for (size_t a = 0; a < m_nDim; a++) {
         for (size_t j = 0; j < m_nsp; j++) {
             m_Vdiff(j,a) = m_B(j,a);
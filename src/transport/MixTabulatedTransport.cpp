@@ -0,0 +1,238 @@
+/**
+ *  @file MixTabulatedTransport.cpp
+ *  Mixture-averaged transport properties for ideal gas mixtures, using
+ *  tabulated species properties.
+ */
+
+#include "cantera/transport/MixTabulatedTransport.h"
+#include "cantera/thermo/ThermoPhase.h"
+
+using namespace std;
+
+namespace Cantera
+{
+MixTabulatedTransport::MixTabulatedTransport() :
+    m_tabTmin(0.0),
+    m_tabTmax(0.0),
+    m_tabDT(5.0),
+    m_phaseRange(true),
+    m_ntab(0),
+    m_rowSize(0)
+{
+}
+
+MixTabulatedTransport::MixTabulatedTransport(
+        const MixTabulatedTransport& right) :
+    MixTransport(right),
+    m_tabTmin(0.0),
+    m_tabTmax(0.0),
+    m_tabDT(5.0),
+    m_phaseRange(true),
+    m_ntab(0),
+    m_rowSize(0)
+{
+    *this = right;
+}
+
+MixTabulatedTransport& MixTabulatedTransport::operator=(
+        const MixTabulatedTransport& right)
+{
+    if (&right == this) {
+        return *this;
+    }
+    MixTransport::operator=(right);
+
+    m_tabTmin = right.m_tabTmin;
+    m_tabTmax = right.m_tabTmax;
+    m_tabDT = right.m_tabDT;
+    m_phaseRange = right.m_phaseRange;
+    m_ntab = right.m_ntab;
+    m_rowSize = right.m_rowSize;
+    m_table = right.m_table;
+
+    return *this;
+}
+
+Transport* MixTabulatedTransport::duplMyselfAsTransport() const
+{
+    return new MixTabulatedTransport(*this);
+}
+
+void MixTabulatedTransport::init(ThermoPhase* thermo, int mode, int log_level)
+{
+    MixTransport::init(thermo, mode, log_level);
+    if (m_phaseRange) {
+        m_tabTmin = m_thermo->minTemp();
+        m_tabTmax = m_thermo->maxTemp();
+    }
+    buildTable();
+}
+
+void MixTabulatedTransport::setTableRange(double Tmin, double Tmax, double dT)
+{
+    if (Tmin <= 0.0 || Tmax <= Tmin || dT <= 0.0) {
+        throw CanteraError("MixTabulatedTransport::setTableRange",
+            "Invalid table range: Tmin = {}, Tmax = {}, dT = {}",
+            Tmin, Tmax, dT);
+    }
+    m_tabTmin = Tmin;
+    m_tabTmax = Tmax;
+    m_tabDT = dT;
+    m_phaseRange = false;
+    if (m_thermo) {
+        buildTable();
+    }
+}
+
+void MixTabulatedTransport::buildTable()
+{
+    const size_t nb = BlockSize;
+    const size_t npairs = m_bdiffPacked.size();
+    m_ntab = std::max<size_t>(
+        static_cast<size_t>(ceil((m_tabTmax - m_tabTmin) / m_tabDT - 1e-8)) + 1,
+        2);
+    m_tabTmax = m_tabTmin + (m_ntab - 1) * m_tabDT;
+    m_rowSize = 2*m_nsp + npairs;
+    m_table.resize(m_ntab * m_rowSize);
+
+    // Evaluate the polynomial fits for blocks of temperatures, and divide out
+    // the powers of T which are not part of the fits
+    vector_fp T(nb), sqvisc(m_nsp*nb), cond(m_nsp*nb), bdiff(npairs*nb);
+    for (size_t i0 = 0; i0 < m_ntab; i0 += nb) {
+        size_t m = std::min(nb, m_ntab - i0);
+        for (size_t s = 0; s < m; s++) {
+            T[s] = m_tabTmin + (i0 + s) * m_tabDT;
+        }
+        MixTransport::getSpeciesBlock(m, T.data(), sqvisc.data(), cond.data(),
+                                      bdiff.data());
+        for (size_t s = 0; s < m; s++) {
+            double sqrt_t = sqrt(T[s]);
+            double t14 = sqrt(sqrt_t);
+            double t32 = T[s] * sqrt_t;
+            double* row = &m_table[(i0 + s) * m_rowSize];
+            for (size_t k = 0; k < m_nsp; k++) {
+                row[k] = sqvisc[k*nb+s] / t14;
+                row[m_nsp+k] = cond[k*nb+s] / sqrt_t;
+            }
+            for (size_t ic = 0; ic < npairs; ic++) {
+                row[2*m_nsp+ic] = bdiff[ic*nb+s] / t32;
+            }
+        }
+    }
+
+    // Values stored for the previous temperature may differ slightly from the
+    // interpolated values
+    m_temp = -1.0;
+}
+
+void MixTabulatedTransport::getSpeciesBlock(size_t m, const double* T,
+                                            double* sqvisc, double* cond,
+                                            double* bdiff)
+{
+    const size_t nb = BlockSize;
+    const size_t npairs = m_bdiffPacked.size();
+    size_t irow[BlockSize];
+    double f[BlockSize], t14[BlockSize], sqrt_t[BlockSize], t32[BlockSize];
+    bool outside = false;
+    for (size_t s = 0; s < m; s++) {
+        if (!findInterval(T[s], irow[s], f[s])) {
+            // filled in below
+            irow[s] = 0;
+            f[s] = 0.0;
+            outside = true;
+        }
+        irow[s] *= m_rowSize;
+        sqrt_t[s] = sqrt(T[s]);
+        t14[s] = sqrt(sqrt_t[s]);
+        t32[s] = T[s] * sqrt_t[s];
+    }
+
+    const double* tab = m_table.data();
+    for (size_t k = 0; k < m_nsp; k++) {
+        double* sq = sqvisc + k*nb;
+        double* lam = cond + k*nb;
+        for (size_t s = 0; s < m; s++) {
+            const double* r0 = tab + irow[s];
+            const double* r1 = r0 + m_rowSize;
+            sq[s] = t14[s] * (r0[k] + f[s] * (r1[k] - r0[k]));
+            lam[s] = sqrt_t[s] * (r0[m_nsp+k] + f[s] *
+                                  (r1[m_nsp+k] - r0[m_nsp+k]));
+        }
+    }
+    for (size_t ic = 0; ic < npairs; ic++) {
+        double* dij = bdiff + ic*nb;
+        size_t jc = 2*m_nsp + ic;
+        for (size_t s = 0; s < m; s++) {
+            const double* r0 = tab + irow[s];
+            const double* r1 = r0 + m_rowSize;
+            dij[s] = t32[s] * (r0[jc] + f[s] * (r1[jc] - r0[jc]));
+        }
+    }
+
+    if (outside) {
+        // states outside of the table are evaluated one at a time from the
+        // polynomial fits
+        for (size_t s = 0; s < m; s++) {
+            size_t i;
+            double fs;
+            if (!findInterval(T[s], i, fs)) {
+                MixTransport::getSpeciesBlock(1, T + s, sqvisc + s, cond + s,
+                                              bdiff + s);
+            }
+        }
+    }
+}
+
+void MixTabulatedTransport::updateSpeciesViscosities()
+{
+    update_T();
+    size_t i;
+    double f;
+    if (!findInterval(m_temp, i, f)) {
+        MixTransport::updateSpeciesViscosities();
+        return;
+    }
+    const double* r0 = &m_table[i*m_rowSize];
+    const double* r1 = r0 + m_rowSize;
+    for (size_t k = 0; k < m_nsp; k++) {
+        m_sqvisc[k] = m_t14 * (r0[k] + f * (r1[k] - r0[k]));
+        m_visc[k] = m_sqvisc[k] * m_sqvisc[k];
+    }
+    m_spvisc_ok = true;
+}
+
+void MixTabulatedTransport::updateCond_T()
+{
+    size_t i;
+    double f;
+    if (!findInterval(m_temp, i, f)) {
+        MixTransport::updateCond_T();
+        return;
+    }
+    const double* r0 = &m_table[i*m_rowSize + m_nsp];
+    const double* r1 = r0 + m_rowSize;
+    for (size_t k = 0; k < m_nsp; k++) {
+        m_cond[k] = m_sqrt_t * (r0[k] + f * (r1[k] - r0[k]));
+    }
+    m_spcond_ok = true;
+    m_condmix_ok = false;
+}
+
+void MixTabulatedTransport::updateDiff_T()
+{
+    update_T();
+    size_t i;
+    double f;
+    if (!findInterval(m_temp, i, f)) {
+        MixTransport::updateDiff_T();
+        return;
+    }
+    const double* r0 = &m_table[i*m_rowSize + 2*m_nsp];
+    const double* r1 = r0 + m_rowSize;
+    for (size_t ic = 0; ic < m_bdiffPacked.size(); ic++) {
+        m_bdiffPacked[ic] = m_t32 * (r0[ic] + f * (r1[ic] - r0[ic]));
+    }
+    unpackBinaryDiffCoeffs();
+}
+
+}
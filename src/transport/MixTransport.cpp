@@ -12,18 +12,18 @@ using namespace std;
 namespace Cantera
 {
 MixTransport::MixTransport() :
-    m_lambda(0.0),
     m_spcond_ok(false),
     m_condmix_ok(false),
+    m_lambda(0.0),
     m_debug(false)
 {
 }
 
 MixTransport::MixTransport(const MixTransport& right) :
     GasTransport(right),
-    m_lambda(0.0),
     m_spcond_ok(false),
     m_condmix_ok(false),
+    m_lambda(0.0),
     m_debug(false)
 {
     *this = right;
@@ -88,6 +88,225 @@ doublereal MixTransport::thermalConductivity()
     return m_lambda;
 }
 
+void MixTransport::getMixTransportProperties(size_t n, const double* T,
+                                             const double* P, const double* X,
+                                             double* visc, double* cond,
+                                             double* d)
+{
+    // The work arrays hold one value for each species (or species pair) and
+    // state of the block, with the state index varying fastest.
+    const size_t nb = BlockSize;
+    const size_t nsp = m_nsp;
+    const size_t npairs = m_bdiffPacked.size();
+    vector_fp mmw(nb), sumxw(nb), sum1(nb), sum2(nb);
+    vector_fp x(nsp*nb), vk(nsp*nb), sqvk(nsp*nb), isqvk(nsp*nb);
+    vector_fp condk(nsp*nb), den(nsp*nb), dsum(nsp*nb), dkk(nsp*nb);
+    vector_fp bdiff(npairs*nb);
+
+    for (size_t j0 = 0; j0 < n; j0 += nb) {
+        size_t m = std::min(nb, n - j0);
+
+        // mole fractions, computed in the same way as in update_C()
+        for (size_t s = 0; s < m; s++) {
+            if (T[j0+s] < 0.0) {
+                throw CanteraError("MixTransport::getMixTransportProperties",
+                                   "negative temperature {}", T[j0+s]);
+            }
+            const double* xs = X + (j0+s)*nsp;
+            double xsum = 0.0;
+            for (size_t k = 0; k < nsp; k++) {
+                xsum += xs[k];
+            }
+            mmw[s] = 0.0;
+            sumxw[s] = 0.0;
+            for (size_t k = 0; k < nsp; k++) {
+                double xk = xs[k] / xsum;
+                mmw[s] += xk * m_mw[k];
+                x[k*nb+s] = std::max(Tiny, xk);
+                sumxw[s] += x[k*nb+s] * m_mw[k];
+            }
+        }
+
+        // species properties and binary diffusion coefficients
+        getSpeciesBlock(m, T + j0, sqvk.data(), condk.data(), bdiff.data());
+
+        // thermal conductivity
+        for (size_t s = 0; s < m; s++) {
+            sum1[s] = 0.0;
+            sum2[s] = 0.0;
+        }
+        for (size_t k = 0; k < nsp; k++) {
+            const double* xk = &x[k*nb];
+            const double* lam = &condk[k*nb];
+            for (size_t s = 0; s < m; s++) {
+                sum1[s] += xk[s] * lam[s];
+                sum2[s] += xk[s] / lam[s];
+            }
+        }
+        for (size_t s = 0; s < m; s++) {
+            cond[j0+s] = 0.5*(sum1[s] + 1.0/sum2[s]);
+        }
+
+        // viscosity, using the Wilke mixing rule as in viscosity()
+        if (visc) {
+            for (size_t k = 0; k < nsp; k++) {
+                for (size_t s = 0; s < m; s++) {
+                    vk[k*nb+s] = sqvk[k*nb+s] * sqvk[k*nb+s];
+                    isqvk[k*nb+s] = 1.0 / sqvk[k*nb+s];
+                    den[k*nb+s] = 0.0;
+                }
+            }
+            // den[k] = sum_j phi(k,j) * X_j, see updateViscosity_T()
+            for (size_t j = 0; j < nsp; j++) {
+                for (size_t k = j; k < nsp; k++) {
+                    double wr = m_wratjk(k,j);
+                    double c = m_wratkj1(j,k);
+                    double wratiokj = m_wratkj1(k,j);
+                    const double* sqk = &sqvk[k*nb];
+                    const double* isqk = &isqvk[k*nb];
+                    const double* sqj = &sqvk[j*nb];
+                    const double* isqj = &isqvk[j*nb];
+                    const double* xj = &x[j*nb];
+                    const double* xk = &x[k*nb];
+                    double* denk = &den[k*nb];
+                    double* denj = &den[j*nb];
+                    if (k == j) {
+                        for (size_t s = 0; s < m; s++) {
+                            double f = 1.0 + sqk[s] * isqj[s] * wr;
+                            denk[s] += f * f * c * xj[s];
+                        }
+                    } else {
+                        for (size_t s = 0; s < m; s++) {
+                            double f = 1.0 + sqk[s] * isqj[s] * wr;
+                            double phikj = f * f * c;
+                            double r = sqj[s] * isqk[s];
+                            denk[s] += phikj * xj[s];
+                            denj[s] += phikj * r * r * wratiokj * xk[s];
+                        }
+                    }
+                }
+            }
+            for (size_t s = 0; s < m; s++) {
+                sum1[s] = 0.0;
+            }
+            for (size_t k = 0; k < nsp; k++) {
+                for (size_t s = 0; s < m; s++) {
+                    sum1[s] += x[k*nb+s] * vk[k*nb+s] / den[k*nb+s];
+                }
+            }
+            for (size_t s = 0; s < m; s++) {
+                visc[j0+s] = sum1[s];
+            }
+        }
+
+        // mixture-averaged diffusion coefficients, see getMixDiffCoeffs()
+        std::fill(dsum.begin(), dsum.end(), 0.0);
+        size_t ic = 0;
+        for (size_t i = 0; i < nsp; i++) {
+            for (size_t j = i; j < nsp; j++) {
+                // binary diffusion coefficients at unit pressure
+                const double* dij = &bdiff[ic*nb];
+                if (i == j) {
+                    std::copy(dij, dij + m, &dkk[i*nb]);
+                } else {
+                    const double* xi = &x[i*nb];
+                    const double* xj = &x[j*nb];
+                    double* sumi = &dsum[i*nb];
+                    double* sumj = &dsum[j*nb];
+                    for (size_t s = 0; s < m; s++) {
+                        double r = 1.0 / dij[s];
+                        sumi[s] += xj[s] * r;
+                        sumj[s] += xi[s] * r;
+                    }
+                }
+                ic++;
+            }
+        }
+        for (size_t s = 0; s < m; s++) {
+            double p = P[j0+s];
+            double* ds = d + (j0+s)*nsp;
+            for (size_t k = 0; k < nsp; k++) {
+                double sum = dsum[k*nb+s];
+                if (nsp == 1 || sum <= 0.0) {
+                    ds[k] = dkk[k*nb+s] / p;
+                } else {
+                    ds[k] = (sumxw[s] - x[k*nb+s] * m_mw[k]) /
+                            (p * mmw[s] * sum);
+                }
+            }
+        }
+    }
+}
+
+void MixTransport::getSpeciesBlock(size_t m, const double* T,
+                                   double* sqvisc, double* cond,
+                                   double* bdiff)
+{
+    // powers of log(T) and of T, computed in the same way as in update_T()
+    const size_t nb = BlockSize;
+    double logt[5*BlockSize], t14[BlockSize];
+    double sqrt_t[BlockSize], t32[BlockSize];
+    const double* p0 = &logt[0];
+    const double* p1 = &logt[nb];
+    const double* p2 = &logt[2*nb];
+    const double* p3 = &logt[3*nb];
+    const double* p4 = &logt[4*nb];
+    for (size_t s = 0; s < m; s++) {
+        double lt = log(T[s]);
+        logt[s] = 1.0;
+        logt[nb+s] = lt;
+        logt[2*nb+s] = lt*lt;
+        logt[3*nb+s] = lt*lt*lt;
+        logt[4*nb+s] = lt*lt*lt*lt;
+        sqrt_t[s] = sqrt(T[s]);
+        t14[s] = sqrt(sqrt_t[s]);
+        t32[s] = T[s] * sqrt_t[s];
+    }
+
+    for (size_t k = 0; k < m_nsp; k++) {
+        const double* cv = m_visccoeffs[k].data();
+        const double* cc = m_condcoeffs[k].data();
+        double* sq = sqvisc + k*nb;
+        double* lam = cond + k*nb;
+        if (m_mode == CK_Mode) {
+            for (size_t s = 0; s < m; s++) {
+                sq[s] = sqrt(exp(p0[s]*cv[0] + p1[s]*cv[1] + p2[s]*cv[2] +
+                                 p3[s]*cv[3]));
+                lam[s] = exp(p0[s]*cc[0] + p1[s]*cc[1] + p2[s]*cc[2] +
+                             p3[s]*cc[3]);
+            }
+        } else {
+            for (size_t s = 0; s < m; s++) {
+                sq[s] = t14[s] * (p0[s]*cv[0] + p1[s]*cv[1] + p2[s]*cv[2] +
+                                  p3[s]*cv[3] + p4[s]*cv[4]);
+                lam[s] = sqrt_t[s] * (p0[s]*cc[0] + p1[s]*cc[1] +
+                    p2[s]*cc[2] + p3[s]*cc[3] + p4[s]*cc[4]);
+            }
+        }
+    }
+
+    const double* c0 = m_diffcoeffsPacked.ptrColumn(0);
+    const double* c1 = m_diffcoeffsPacked.ptrColumn(1);
+    const double* c2 = m_diffcoeffsPacked.ptrColumn(2);
+    const double* c3 = m_diffcoeffsPacked.ptrColumn(3);
+    const double* c4 = (m_mode == CK_Mode) ? 0
+                       : m_diffcoeffsPacked.ptrColumn(4);
+    for (size_t ic = 0; ic < m_bdiffPacked.size(); ic++) {
+        double* dij = bdiff + ic*nb;
+        if (m_mode == CK_Mode) {
+            for (size_t s = 0; s < m; s++) {
+                dij[s] = exp(c0[ic]*p0[s] + c1[ic]*p1[s] + c2[ic]*p2[s] +
+                             c3[ic]*p3[s]);
+            }
+        } else {
+            for (size_t s = 0; s < m; s++) {
+                dij[s] = t32[s] * (c0[ic]*p0[s] + c1[ic]*p1[s] +
+                    c2[ic]*p2[s] + c3[ic]*p3[s] + c4[ic]*p4[s]);
+            }
+        }
+    }
+}
+
 void MixTransport::getThermalDiffCoeffs(doublereal* const dt)
 {
     for (size_t k = 0; k < m_nsp; k++) {
@@ -35,7 +35,11 @@ doublereal Frot(doublereal tr, doublereal sqtr)
 //////////////////// class MultiTransport methods //////////////
 
 MultiTransport::MultiTransport(thermo_t* thermo)
-    : GasTransport(thermo)
+    : GasTransport(thermo),
+      m_lmatrix_maxiter(0),
+      m_lmatrix_rtol(1.0e-10),
+      m_nlmatrix_factor(0),
+      m_lfactor_ok(false)
 {
 }
 
@@ -47,6 +51,10 @@ void MultiTransport::init(ThermoPhase* thermo, int mode, int log_level)
     m_Lmatrix.resize(3*m_nsp, 3*m_nsp);
     m_a.resize(3*m_nsp, 1.0);
     m_b.resize(3*m_nsp, 0.0);
+    m_Lred.resize(2*m_nsp, 2*m_nsp);
+    m_Lcoup.resize(m_nsp, m_nsp);
+    m_Ldiag.resize(m_nsp);
+    m_Lwork.resize(3*m_nsp);
     m_aa.resize(m_nsp, m_nsp, 0.0);
     m_molefracs_last.resize(m_nsp, -1.0);
     m_frot_298.resize(m_nsp);
@@ -61,6 +69,7 @@ void MultiTransport::init(ThermoPhase* thermo, int mode, int log_level)
     m_abc_ok = false;
     m_l0000_ok = false;
     m_lmatrix_soln_ok = false;
+    m_lfactor_ok = false;
     m_thermal_tlast = 0.0;
 
     // some work space
@@ -154,14 +163,114 @@ void MultiTransport::solveLMatrixEquation()
     eval_L0110();
     eval_L0101(m_molefracs.data());
 
-    // Solve it using GMRES or LU decomposition. The last solution in m_a should
-    // provide a good starting guess, so convergence should be fast.
-    m_a = m_b;
-    solve(m_Lmatrix, m_a.data());
+    // If enabled, refine the last solution in m_a using the previous
+    // factorization. This should converge quickly if the state has not
+    // changed much. Otherwise, factor the matrix for the current state.
+    if (m_lmatrix_maxiter == 0 || !m_lfactor_ok || !refineLMatrixSolution()) {
+        factorLMatrix();
+        m_a = m_b;
+        solveFactoredLMatrix(m_a.data());
+    }
     m_lmatrix_soln_ok = true;
     m_molefracs_last = m_molefracs;
-    // L matrix is overwritten with LU decomposition
-    m_l0000_ok = false;
+    // the L matrix itself is not overwritten by the factorization
+    m_l0000_ok = true;
+}
+
+void MultiTransport::factorLMatrix()
+{
+    // With C = L10,01 and the diagonal matrix D = L01,01, the equations for
+    // the first two blocks of unknowns become
+    //     [ L00,00  L00,10             ] [a_00]   [ b_00               ]
+    //     [ L10,00  L10,10 - C D^-1 C^T] [a_10] = [ b_10 - C D^-1 b_01 ]
+    // since L01,10 = C^T.
+    size_t n2 = 2*m_nsp;
+    for (size_t j = 0; j < n2; j++) {
+        const doublereal* col = m_Lmatrix.ptrColumn(j);
+        std::copy(col, col + n2, m_Lred.ptrColumn(j));
+    }
+    for (size_t k = 0; k < m_nsp; k++) {
+        m_Ldiag[k] = m_Lmatrix(k+n2, k+n2);
+        const doublereal* col = m_Lmatrix.ptrColumn(k+n2) + m_nsp;
+        std::copy(col, col + m_nsp, m_Lcoup.ptrColumn(k));
+    }
+    for (size_t k = 0; k < m_nsp; k++) {
+        // the columns of C for species without internal modes are zero
+        if (!hasInternalModes(k)) {
+            continue;
+        }
+        const doublereal* ck = m_Lcoup.ptrColumn(k);
+        for (size_t j = 0; j < m_nsp; j++) {
+            doublereal c = ck[j] / m_Ldiag[k];
+            doublereal* col = m_Lred.ptrColumn(j + m_nsp) + m_nsp;
+            for (size_t i = 0; i < m_nsp; i++) {
+                col[i] -= ck[i] * c;
+            }
+        }
+    }
+    int ierr = m_Lred.factor();
+    if (ierr != 0) {
+        throw CanteraError("MultiTransport::factorLMatrix",
+                           "factor returned ierr = {}", ierr);
+    }
+    m_lfactor_ok = true;
+    m_nlmatrix_factor++;
+}
+
+void MultiTransport::solveFactoredLMatrix(doublereal* x)
+{
+    size_t n2 = 2*m_nsp;
+    // eliminate the third block from the right-hand side
+    for (size_t k = 0; k < m_nsp; k++) {
+        doublereal c = x[k+n2] / m_Ldiag[k];
+        if (c != 0.0) {
+            const doublereal* ck = m_Lcoup.ptrColumn(k);
+            for (size_t i = 0; i < m_nsp; i++) {
+                x[i+m_nsp] -= ck[i] * c;
+            }
+        }
+    }
+    m_Lred.solve(x);
+    // back-substitute for the third block
+    for (size_t k = 0; k < m_nsp; k++) {
+        const doublereal* ck = m_Lcoup.ptrColumn(k);
+        doublereal sum = 0.0;
+        for (size_t i = 0; i < m_nsp; i++) {
+            sum += ck[i] * x[i+m_nsp];
+        }
+        x[k+n2] = (x[k+n2] - sum) / m_Ldiag[k];
+    }
+}
+
+bool MultiTransport::refineLMatrixSolution()
+{
+    size_t n3 = 3*m_nsp;
+    doublereal bmax = 0.0;
+    for (size_t i = 0; i < n3; i++) {
+        bmax = std::max(bmax, fabs(m_b[i]));
+    }
+    // The L matrix is singular, and the component of the solution in its
+    // null space does not affect the transport properties, so the
+    // convergence test is based on the residual rather than the correction.
+    for (size_t iter = 0; iter <= m_lmatrix_maxiter; iter++) {
+        // residual of the current L matrix equation
+        m_Lmatrix.mult(m_a.data(), m_Lwork.data());
+        doublereal rmax = 0.0;
+        for (size_t i = 0; i < n3; i++) {
+            m_Lwork[i] = m_b[i] - m_Lwork[i];
+            rmax = std::max(rmax, fabs(m_Lwork[i]));
+        }
+        if (rmax <= m_lmatrix_rtol * bmax) {
+            return true;
+        } else if (iter == m_lmatrix_maxiter || !(rmax < HUGE_VAL)) {
+            break;
+        }
+        solveFactoredLMatrix(m_Lwork.data());
+        for (size_t i = 0; i < n3; i++) {
+            m_a[i] += m_Lwork[i];
+        }
+    }
+    return false;
 }
 
 void MultiTransport::getSpeciesFluxes(size_t ndim, const doublereal* const grad_T,
@@ -110,6 +110,24 @@ void Transport::finalize()
     }
 }
 
+void Transport::getMixTransportProperties(size_t n, const double* T,
+                                          const double* P, const double* X,
+                                          double* visc, double* cond,
+                                          double* d)
+{
+    vector_fp state;
+    m_thermo->saveState(state);
+    for (size_t j = 0; j < n; j++) {
+        m_thermo->setState_TPX(T[j], P[j], X + j*m_nsp);
+        if (visc) {
+            visc[j] = viscosity();
+        }
+        cond[j] = thermalConductivity();
+        getMixDiffCoeffs(d + j*m_nsp);
+    }
+    m_thermo->restoreState(state);
+}
+
 void Transport::getSpeciesFluxes(size_t ndim, const doublereal* const grad_T,
                                  size_t ldx, const doublereal* const grad_X,
                                  size_t ldf, doublereal* const fluxes)
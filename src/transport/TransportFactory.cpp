@@ -3,6 +3,7 @@
 // known transport models
 #include "cantera/transport/MultiTransport.h"
 #include "cantera/transport/MixTransport.h"
+#include "cantera/transport/MixTabulatedTransport.h"
 #include "cantera/transport/SolidTransport.h"
 #include "cantera/transport/DustyGasTransport.h"
 #include "cantera/transport/SimpleTransport.h"
@@ -47,6 +48,7 @@ TransportFactory::TransportFactory()
     m_models["DustyGas"] = cDustyGasTransport;
     m_models["CK_Multi"] = CK_Multicomponent;
     m_models["CK_Mix"] = CK_MixtureAveraged;
+    m_models["Mix-tabulated"] = cMixtureTabulated;
     m_models["Liquid"] = cLiquidTransport;
     m_models["Simple"] = cSimpleTransport;
     m_models["User"] = cUserTransport;
@@ -56,6 +58,10 @@ TransportFactory::TransportFactory()
         m_modelNames[model.second] = model.first;
     }
 
+    if (getenv("CANTERA_TRANSPORT_CACHE") != 0) {
+        m_fitCacheDir = getenv("CANTERA_TRANSPORT_CACHE");
+    }
+
     m_tranPropMap["viscosity"] = TP_VISCOSITY;
     m_tranPropMap["ionConductivity"] = TP_IONCONDUCTIVITY;
     m_tranPropMap["mobilityRatio"] = TP_MOBILITYRATIO;
@@ -197,23 +203,27 @@ Transport* TransportFactory::newTransport(const std::string& transportModel,
         break;
     case cMulticomponent:
         tr = new MultiTransport;
-        tr->init(phase, 0, log_level);
+        initGasTransport(tr, phase, 0, log_level);
         break;
     case CK_Multicomponent:
         tr = new MultiTransport;
-        tr->init(phase, CK_Mode, log_level);
+        initGasTransport(tr, phase, CK_Mode, log_level);
         break;
     case cMixtureAveraged:
         tr = new MixTransport;
-        tr->init(phase, 0, log_level);
+        initGasTransport(tr, phase, 0, log_level);
         break;
     case CK_MixtureAveraged:
         tr = new MixTransport;
-        tr->init(phase, CK_Mode, log_level);
+        initGasTransport(tr, phase, CK_Mode, log_level);
+        break;
+    case cMixtureTabulated:
+        tr = new MixTabulatedTransport;
+        initGasTransport(tr, phase, 0, log_level);
         break;
     case cHighP:
         tr = new HighPressureGasTransport;
-        tr->init(phase, 0, log_level);
+        initGasTransport(tr, phase, 0, log_level);
         break;
     case cSolidTransport:
         tr = new SolidTransport;
@@ -223,7 +233,7 @@ Transport* TransportFactory::newTransport(const std::string& transportModel,
     case cDustyGasTransport:
         tr = new DustyGasTransport;
         gastr = new MultiTransport;
-        gastr->init(phase, 0, log_level);
+        initGasTransport(gastr, phase, 0, log_level);
         dtr = (DustyGasTransport*)tr;
         dtr->initialize(phase, gastr);
         break;
@@ -244,6 +254,18 @@ Transport* TransportFactory::newTransport(const std::string& transportModel,
     return tr;
 }
 
+void TransportFactory::initGasTransport(Transport* tr, thermo_t* thermo,
+                                        int mode, int log_level)
+{
+    GasTransport* gtr = dynamic_cast<GasTransport*>(tr);
+    if (!gtr) {
+        throw CanteraError("TransportFactory::initGasTransport",
+                           "Transport manager is not derived from GasTransport");
+    }
+    gtr->setFitCacheDirectory(m_fitCacheDir);
+    gtr->init(thermo, mode, log_level);
+}
+
 Transport* TransportFactory::newTransport(thermo_t* phase, int log_level)
 {
     std::string transportModel = "None";
@@ -3,6 +3,7 @@
 #include "cantera/thermo/ThermoFactory.h"
 #include "cantera/thermo/IdealGasPhase.h"
 #include "cantera/equil/MultiPhase.h"
+#include "cantera/equil/EquilCache.h"
 #include "cantera/base/global.h"
 #include "cantera/base/utilities.h"
 
@@ -295,6 +296,95 @@ TEST_F(PropertyPairs, ChemEquil_UV) { check_UV("element_potential"); }
 // TEST_F(PropertyPairs, MultiPhase_UV) { check_UV("gibbs"); } // not implemented
 TEST_F(PropertyPairs, VcsNonideal_UV) { check_UV("vcs"); }
 
+// Test for sequences of nearby equilibrium problems solved using the
+// EquilCache, which should give the same results as solving each problem
+// from scratch.
+class EquilCacheTest : public GriEquilibriumTest
+{
+public:
+    void setInlet(int i, int j) {
+        compositionMap comp;
+        comp["CH4"] = 0.05 + 0.01 * i;
+        comp["O2"] = 0.21;
+        comp["N2"] = 0.79;
+        gas.setState_TPX(300 + 20 * j, OneAtm, comp);
+    }
+};
+
+TEST_F(EquilCacheTest, HP)
+{
+    EquilCache cache;
+    for (int i = 0; i < 5; i++) {
+        for (int j = 0; j < 5; j++) {
+            setInlet(i, j);
+            gas.equilibrate("HP");
+            double T = gas.temperature();
+            vector_fp Xref(gas.nSpecies());
+            gas.getMoleFractions(&Xref[0]);
+
+            setInlet(i, j);
+            double h0 = gas.enthalpy_mass();
+            save_elemental_mole_fractions();
+            cache.equilibrate(gas, "HP");
+            EXPECT_NEAR(h0, gas.enthalpy_mass(), 1e-3);
+            EXPECT_NEAR(OneAtm, gas.pressure(), 1e-3);
+            EXPECT_NEAR(T, gas.temperature(), 1e-5);
+            for (size_t k = 0; k < gas.nSpecies(); k++) {
+                EXPECT_NEAR(Xref[k], gas.moleFraction(k), 1e-9);
+            }
+            check();
+        }
+    }
+    EXPECT_EQ(1, (int) cache.nColdStarts());
+    EXPECT_EQ(24, (int) cache.nWarmStarts());
+    EXPECT_EQ(25, (int) cache.nEntries());
+}
+
+TEST_F(EquilCacheTest, TP)
+{
+    EquilCache cache(4);
+    for (int j = 0; j < 6; j++) {
+        double T = 1500 + 100 * j;
+        gas.setState_TPX(T, OneAtm, "CH4:0.3, O2:0.3, N2:0.4");
+        save_elemental_mole_fractions();
+        cache.equilibrate(gas, "TP");
+        EXPECT_NEAR(T, gas.temperature(), 1e-9);
+        EXPECT_NEAR(OneAtm, gas.pressure(), 1e-3);
+        check();
+    }
+    EXPECT_EQ(4, (int) cache.nEntries());
+    EXPECT_EQ(5, (int) cache.nWarmStarts());
+}
+
+TEST_F(EquilCacheTest, Retrieve)
+{
+    EquilCache cache;
+    cache.setRetrieveTolerance(0.0, 1e-3);
+    for (int n = 0; n < 2; n++) {
+        for (int j = 0; j < 10; j++) {
+            setInlet(2, 0);
+            gas.setState_TP(300 + j, OneAtm);
+            double h0 = gas.enthalpy_mass();
+            cache.equilibrate(gas, "HP");
+            EXPECT_NEAR(h0, gas.enthalpy_mass(), 1e-3);
+            EXPECT_NEAR(OneAtm, gas.pressure(), 1e-3);
+        }
+    }
+    // The region of accuracy of the first solution grows to include the
+    // subsequent problems, which are then answered without solving.
+    EXPECT_EQ(1, (int) cache.nEntries());
+    EXPECT_EQ(10, (int) cache.nRetrieved());
+
+    setInlet(2, 0);
+    gas.setState_TP(305, OneAtm);
+    cache.equilibrate(gas, "HP");
+    double T = gas.temperature();
+    setInlet(2, 0);
+    gas.setState_TP(305, OneAtm);
+    gas.equilibrate("HP");
+    EXPECT_NEAR(T, gas.temperature(), 0.5);
+}
+
 int main(int argc, char** argv)
 {
     printf("Running main() from equil_gas.cpp\n");
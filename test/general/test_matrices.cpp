@@ -1,5 +1,7 @@
 #include "gtest/gtest.h"
 #include "cantera/numerics/BandMatrix.h"
+#include "cantera/numerics/BlockTridiagMatrix.h"
+#include "cantera/numerics/BlockDiagMatrix.h"
 
 using namespace Cantera;
 
@@ -103,3 +105,232 @@ TEST_F(BandMatrixTest, checkRowsColumns) {
     EXPECT_EQ((size_t) 0, i);
     EXPECT_DOUBLE_EQ(1, s);
 }
+
+class BlockTridiagMatrixTest : public testing::Test
+{
+public:
+    BlockTridiagMatrixTest()
+        : x{1, 2, 3, 4, 5, 6, 7, 8, 9}
+    {
+        // blocks of size 2, 3, 1, 3. The matrices have the same nonzero
+        // elements, stored in block tridiagonal and banded form.
+        A.resize({2, 3, 1, 3});
+        B.resize(9, 4, 4);
+        for (size_t i = 0; i < 9; i++) {
+            for (size_t j = 0; j < 9; j++) {
+                if (inBlocks(i, j)) {
+                    double v = 1.0 / (1.0 + i + 2*j) - 0.1 * ((i + j) % 3);
+                    if (i == j) {
+                        // The first element of each block is small to
+                        // require pivoting
+                        v = (i == 0 || i == 2 || i == 5 || i == 6) ? 1e-3 : 2.0;
+                    }
+                    A(i, j) = v;
+                    B(i, j) = v;
+                }
+            }
+        }
+    }
+
+    bool inBlocks(size_t i, size_t j) {
+        size_t starts[] = {0, 2, 5, 6, 9};
+        size_t bi = 0, bj = 0;
+        while (starts[bi+1] <= i) {
+            bi++;
+        }
+        while (starts[bj+1] <= j) {
+            bj++;
+        }
+        return bi <= bj + 1 && bj <= bi + 1;
+    }
+
+    BlockTridiagMatrix A;
+    BandMatrix B;
+    vector_fp x;
+};
+
+TEST_F(BlockTridiagMatrixTest, structure)
+{
+    EXPECT_EQ((size_t) 4, A.nBlocks());
+    EXPECT_EQ((size_t) 9, A.nRows());
+    EXPECT_EQ((size_t) 5, A.blockStart(2));
+    EXPECT_EQ((size_t) 3, A.blockSize(3));
+    // elements outside of the nonzero blocks
+    EXPECT_DOUBLE_EQ(0.0, A(0, 5));
+    EXPECT_DOUBLE_EQ(0.0, A(8, 4));
+    EXPECT_DOUBLE_EQ(B(4, 5), A(4, 5));
+    EXPECT_DOUBLE_EQ(B(6, 2), A(6, 2));
+}
+
+TEST_F(BlockTridiagMatrixTest, matrix_times_vector)
+{
+    vector_fp c(9), d(9);
+    A.mult(x.data(), c.data());
+    B.mult(x.data(), d.data());
+    for (size_t i = 0; i < 9; i++) {
+        EXPECT_NEAR(d[i], c[i], 1e-14);
+    }
+    A.leftMult(x.data(), c.data());
+    B.leftMult(x.data(), d.data());
+    for (size_t i = 0; i < 9; i++) {
+        EXPECT_NEAR(d[i], c[i], 1e-14);
+    }
+}
+
+TEST_F(BlockTridiagMatrixTest, solve_linear_system)
+{
+    vector_fp b(9), c(9);
+    A.mult(x.data(), b.data());
+    EXPECT_EQ(0, A.solve(b.data(), c.data()));
+    for (size_t i = 0; i < 9; i++) {
+        EXPECT_NEAR(x[i], c[i], 1e-10);
+    }
+
+    // multiple right hand sides, after changing the diagonal
+    for (size_t i = 0; i < 9; i++) {
+        A(i, i) += 1.0;
+    }
+    vector_fp b2(18);
+    A.mult(x.data(), b2.data());
+    for (size_t i = 0; i < 9; i++) {
+        b2[9+i] = 2*b2[i];
+    }
+    EXPECT_EQ(0, A.solve(b2.data(), 2));
+    for (size_t i = 0; i < 9; i++) {
+        EXPECT_NEAR(x[i], b2[i], 1e-10);
+        EXPECT_NEAR(2*x[i], b2[9+i], 1e-10);
+    }
+}
+
+TEST_F(BlockTridiagMatrixTest, singular_diagonal_block)
+{
+    // The first column of the first diagonal block is zero, so the pivot
+    // must be taken from the block below it
+    A(0, 0) = 0.0;
+    A(1, 0) = 0.0;
+    vector_fp b(9), c(9);
+    A.mult(x.data(), b.data());
+    EXPECT_EQ(0, A.solve(b.data(), c.data()));
+    for (size_t i = 0; i < 9; i++) {
+        EXPECT_NEAR(x[i], c[i], 1e-10);
+    }
+}
+
+TEST_F(BlockTridiagMatrixTest, singular)
+{
+    for (size_t j = 0; j < 9; j++) {
+        A(6, j) = 0.0;
+    }
+    vector_fp b(9, 1.0);
+    EXPECT_NE(0, A.solve(b.data()));
+}
+
+TEST_F(BlockTridiagMatrixTest, norms)
+{
+    EXPECT_NEAR(B.oneNorm(), A.oneNorm(), 1e-14);
+    double s1, s2;
+    EXPECT_EQ(B.checkRows(s1), A.checkRows(s2));
+    EXPECT_DOUBLE_EQ(s1, s2);
+    EXPECT_EQ(B.checkColumns(s1), A.checkColumns(s2));
+    EXPECT_DOUBLE_EQ(s1, s2);
+}
+
+class BlockDiagMatrixTest : public testing::Test
+{
+public:
+    BlockDiagMatrixTest()
+        : x{1, 2, 3, 4, 5, 6, 7, 8, 9}
+    {
+        // blocks of size 2, 3, 1, 3. The matrices have the same nonzero
+        // elements, stored in block diagonal and banded form.
+        A.resize({2, 3, 1, 3});
+        B.resize(9, 2, 2);
+        for (size_t i = 0; i < 9; i++) {
+            for (size_t j = 0; j < 9; j++) {
+                double v = 1.0 / (1.0 + i + 2*j) - 0.1 * ((i + j) % 3);
+                if (i == j) {
+                    v = (i == 0 || i == 2 || i == 6) ? 1e-3 : 2.0;
+                }
+                // Elements outside of the diagonal blocks are discarded
+                A(i, j) = v;
+                if (inBlocks(i, j)) {
+                    B(i, j) = v;
+                }
+            }
+        }
+    }
+
+    bool inBlocks(size_t i, size_t j) {
+        size_t starts[] = {0, 2, 5, 6, 9};
+        size_t bi = 0, bj = 0;
+        while (starts[bi+1] <= i) {
+            bi++;
+        }
+        while (starts[bj+1] <= j) {
+            bj++;
+        }
+        return bi == bj;
+    }
+
+    BlockDiagMatrix A;
+    BandMatrix B;
+    vector_fp x;
+};
+
+TEST_F(BlockDiagMatrixTest, structure)
+{
+    EXPECT_EQ((size_t) 4, A.nBlocks());
+    EXPECT_EQ((size_t) 9, A.nRows());
+    EXPECT_EQ((size_t) 5, A.blockStart(2));
+    EXPECT_EQ((size_t) 3, A.blockSize(3));
+    EXPECT_DOUBLE_EQ(0.0, A(0, 2));
+    EXPECT_DOUBLE_EQ(0.0, A(5, 4));
+    EXPECT_DOUBLE_EQ(B(3, 4), A(3, 4));
+    EXPECT_DOUBLE_EQ(B(8, 6), A(8, 6));
+}
+
+TEST_F(BlockDiagMatrixTest, matrix_times_vector)
+{
+    vector_fp c(9), d(9);
+    A.mult(x.data(), c.data());
+    B.mult(x.data(), d.data());
+    for (size_t i = 0; i < 9; i++) {
+        EXPECT_NEAR(d[i], c[i], 1e-14);
+    }
+    A.leftMult(x.data(), c.data());
+    B.leftMult(x.data(), d.data());
+    for (size_t i = 0; i < 9; i++) {
+        EXPECT_NEAR(d[i], c[i], 1e-14);
+    }
+}
+
+TEST_F(BlockDiagMatrixTest, solve_linear_system)
+{
+    vector_fp b(9), c(9);
+    A.mult(x.data(), b.data());
+    EXPECT_EQ(0, A.solve(b.data(), c.data()));
+    for (size_t i = 0; i < 9; i++) {
+        EXPECT_NEAR(x[i], c[i], 1e-10);
+    }
+    EXPECT_NEAR(B.oneNorm(), A.oneNorm(), 1e-14);
+}
+
+TEST_F(BlockDiagMatrixTest, regularize)
+{
+    // The block containing row 5 is a single zero element
+    A(5, 5) = 0.0;
+    vector_fp b(9, 1.0);
+    EXPECT_EQ(6, A.solve(b.data()));
+
+    A.setRegularize(true);
+    A(5, 5) = 0.0;
+    vector_fp c(9);
+    A.mult(x.data(), b.data());
+    EXPECT_EQ(0, A.solve(b.data(), c.data()));
+    for (size_t i = 0; i < 9; i++) {
+        if (i != 5) {
+            EXPECT_NEAR(x[i], c[i], 1e-10);
+        }
+    }
+    EXPECT_DOUBLE_EQ(0.0, c[5]);
+}
@@ -45,6 +45,36 @@ public:
         kin_ref.getRevRateConstants(&k_ref[0]);
         EXPECT_DOUBLE_EQ(k_ref[iRef], k[0]);
     }
+
+    //! Compare the derivatives of the net production rates with respect to
+    //! the species concentrations with finite difference approximations
+    void check_ddC() {
+        std::string X = "O:0.02 H2:0.2 O2:0.5 H:0.03 OH:0.05 H2O:0.1 HO2:0.01";
+        p.setState_TPX(1200, 5*OneAtm, X);
+        size_t nsp = p.nSpecies();
+        vector_fp ddC(nsp*nsp), C(nsp), wdot0(nsp), wdot1(nsp);
+        kin.getNetProductionRates_ddC(&ddC[0]);
+        kin.getNetProductionRates(&wdot0[0]);
+        p.getConcentrations(&C[0]);
+        double scale = 0.0;
+        for (size_t i = 0; i < nsp*nsp; i++) {
+            scale = std::max(scale, std::abs(ddC[i]));
+        }
+        ASSERT_GT(scale, 0.0);
+
+        for (size_t m = 0; m < nsp; m++) {
+            vector_fp C1 = C;
+            double dC = 1e-7 * C[m] + 1e-12;
+            C1[m] += dC;
+            p.setConcentrations(&C1[0]);
+            p.setTemperature(1200);
+            kin.getNetProductionRates(&wdot1[0]);
+            for (size_t k = 0; k < nsp; k++) {
+                EXPECT_NEAR((wdot1[k] - wdot0[k]) / dC, ddC[k + m*nsp],
+                            1e-5 * scale) << "k = " << k << ", m = " << m;
+            }
+        }
+    }
 };
 
 TEST_F(KineticsFromScratch, add_elementary_reaction)
@@ -127,6 +157,39 @@ TEST_F(KineticsFromScratch, add_falloff_reaction)
     check_rates(2);
 }
 
+TEST_F(KineticsFromScratch, net_production_rates_ddC)
+{
+    Composition reac = parseCompString("O:1 H2:1");
+    Composition prod = parseCompString("H:1 OH:1");
+    Arrhenius rate(3.87e1, 2.7, 6260.0 / GasConst_cal_mol_K);
+    kin.addReaction(make_shared<ElementaryReaction>(reac, prod, rate));
+
+    ThirdBody tbody;
+    tbody.efficiencies = parseCompString("AR:0.83 H2:2.4 H2O:15.4");
+    kin.addReaction(make_shared<ThreeBodyReaction>(
+        parseCompString("O:2"), parseCompString("O2:1"),
+        Arrhenius(1.2e11, -1.0, 0.0), tbody));
+
+    Arrhenius high_rate(7.4e10, -0.37, 0.0);
+    Arrhenius low_rate(2.3e12, -0.9, -1700.0 / GasConst_cal_mol_K);
+    vector_fp falloff_params { 0.7346, 94.0, 1756.0, 5182.0 };
+    tbody.efficiencies = parseCompString("AR:0.7 H2:2.0 H2O:6.0");
+    auto R = make_shared<FalloffReaction>(parseCompString("OH:2"),
+        parseCompString("H2O2:1"), low_rate, high_rate, tbody);
+    R->falloff = newFalloff(TROE_FALLOFF, falloff_params);
+    kin.addReaction(R);
+
+    auto R2 = make_shared<ElementaryReaction>(parseCompString("H:1 O2:1"),
+        parseCompString("HO2:1"), Arrhenius(4.7e9, 0.0, 0.0));
+    R2->reversible = false;
+    R2->allow_nonreactant_orders = true;
+    R2->orders["O2"] = 0.5;
+    R2->orders["OH"] = 1.5;
+    kin.addReaction(R2);
+    kin.finalize();
+    check_ddC();
+}
+
 TEST_F(KineticsFromScratch, add_plog_reaction)
 {
     // reaction 3:
@@ -0,0 +1,178 @@
+#include "gtest/gtest.h"
+#include "cantera/thermo/HMWSoln.h"
+
+namespace Cantera
+{
+
+//! WaterProps::ADebye() approximates the temperature derivative of the
+//! thermal expansion coefficient by a one-sided difference, which makes the
+//! second temperature derivative of A_Debye inaccurate. A central difference
+//! of the first derivative is used instead so that the second derivatives
+//! of ln(gamma) can be checked.
+class HMWSolnCentralA : public HMWSoln
+{
+public:
+    HMWSolnCentralA(const std::string& inputFile, const std::string& id)
+        : HMWSoln(inputFile, id) {}
+
+    virtual double d2A_DebyedT2_TP(double T=-1.0, double P=-1.0) const {
+        T = (T == -1.0) ? temperature() : T;
+        P = (P == -1.0) ? pressure() : P;
+        double dT = 1e-3;
+        return (dA_DebyedT_TP(T + dT, P) - dA_DebyedT_TP(T - dT, P)) / (2*dT);
+    }
+};
+
+class HMWSoln_Test : public testing::Test
+{
+public:
+    HMWSoln_Test() {
+        test_phase.reset(new HMWSolnCentralA("HMW-brine.xml", "brine"));
+        kk = test_phase->nSpecies();
+    }
+
+    //! Natural logarithms of the activity coefficients at (*T*, *P*) and the
+    //! current composition. The solvent value is on the mole fraction scale.
+    vector_fp lnGamma(double T, double P) {
+        test_phase->setState_TP(T, P);
+        vector_fp lng(kk);
+        test_phase->getMolalityActivityCoefficients(lng.data());
+        for (size_t k = 0; k < kk; k++) {
+            lng[k] = std::log(lng[k]);
+        }
+        return lng;
+    }
+
+    //! Derivatives of ln(gamma) with respect to T, computed from the
+    //! difference between the partial molar and standard state enthalpies
+    vector_fp dlnGammadT(double T, double P) {
+        test_phase->setState_TP(T, P);
+        vector_fp h(kk), h0(kk);
+        test_phase->getPartialMolarEnthalpies(h.data());
+        test_phase->getEnthalpy_RT(h0.data());
+        for (size_t k = 0; k < kk; k++) {
+            h[k] = (h0[k] * GasConstant * T - h[k]) / (GasConstant * T * T);
+        }
+        return h;
+    }
+
+    //! Second derivatives of ln(gamma) with respect to T, computed from the
+    //! difference between the partial molar and standard state heat
+    //! capacities
+    vector_fp d2lnGammadT2(double T, double P) {
+        vector_fp dlng = dlnGammadT(T, P);
+        vector_fp cp(kk), cp0(kk);
+        test_phase->getPartialMolarCp(cp.data());
+        test_phase->getCp_R(cp0.data());
+        for (size_t k = 0; k < kk; k++) {
+            cp[k] = (cp0[k] * GasConstant - cp[k]) / (GasConstant * T * T)
+                    - 2.0 * dlng[k] / T;
+        }
+        return cp;
+    }
+
+    //! Derivatives of ln(gamma) with respect to P, computed from the
+    //! difference between the partial molar and standard state volumes
+    vector_fp dlnGammadP(double T, double P) {
+        test_phase->setState_TP(T, P);
+        vector_fp v(kk), v0(kk);
+        test_phase->getPartialMolarVolumes(v.data());
+        test_phase->getStandardVolumes(v0.data());
+        for (size_t k = 0; k < kk; k++) {
+            v[k] = (v[k] - v0[k]) / (GasConstant * T);
+        }
+        return v;
+    }
+
+    //! Compare the properties of *test_phase*, which may depend on the
+    //! Pitzer coefficients stored for an earlier state, with those of a new
+    //! object set to the same state
+    void check_fresh_state() {
+        HMWSolnCentralA ref("HMW-brine.xml", "brine");
+        vector_fp X(kk);
+        test_phase->getMoleFractions(X.data());
+        ref.setState_TPX(test_phase->temperature(), test_phase->pressure(),
+                         X.data());
+
+        vector_fp ac_ref(kk), ac(kk);
+        ref.getMolalityActivityCoefficients(ac_ref.data());
+        test_phase->getMolalityActivityCoefficients(ac.data());
+        vector_fp h_ref(kk), h(kk), cp_ref(kk), cp(kk), v_ref(kk), v(kk);
+        ref.getPartialMolarEnthalpies(h_ref.data());
+        test_phase->getPartialMolarEnthalpies(h.data());
+        ref.getPartialMolarCp(cp_ref.data());
+        test_phase->getPartialMolarCp(cp.data());
+        ref.getPartialMolarVolumes(v_ref.data());
+        test_phase->getPartialMolarVolumes(v.data());
+        // The solvent standard state depends on the water density, which is
+        // found iteratively starting from the previous value, so the partial
+        // molar properties are only compared to that precision
+        for (size_t k = 0; k < kk; k++) {
+            EXPECT_NEAR(ac_ref[k], ac[k], 1e-12 * ac_ref[k]);
+            EXPECT_NEAR(h_ref[k], h[k], 1e-10 * std::abs(h_ref[k]));
+            EXPECT_NEAR(cp_ref[k], cp[k], 1e-10 * std::abs(cp_ref[k]));
+            EXPECT_NEAR(v_ref[k], v[k], 1e-10 * std::abs(v_ref[k]));
+        }
+        EXPECT_NEAR(ref.osmoticCoefficient(),
+                    test_phase->osmoticCoefficient(), 1e-12);
+    }
+
+protected:
+    std::unique_ptr<HMWSoln> test_phase;
+    size_t kk;
+};
+
+TEST_F(HMWSoln_Test, derivativesVsFiniteDifferences)
+{
+    double P = 5e6;
+    double dT = 0.01;
+    double dP = 1e5;
+    for (double T : {290.0, 310.0, 330.0}) {
+        vector_fp dlngdT = dlnGammadT(T, P);
+        vector_fp d2lngdT2 = d2lnGammadT2(T, P);
+        vector_fp dlngdP = dlnGammadP(T, P);
+
+        vector_fp lng_Tp = lnGamma(T + dT, P);
+        vector_fp lng_Tm = lnGamma(T - dT, P);
+        vector_fp dlng_Tp = dlnGammadT(T + dT, P);
+        vector_fp dlng_Tm = dlnGammadT(T - dT, P);
+        vector_fp lng_Pp = lnGamma(T, P + dP);
+        vector_fp lng_Pm = lnGamma(T, P - dP);
+        for (size_t k = 0; k < kk; k++) {
+            double fd = (lng_Tp[k] - lng_Tm[k]) / (2 * dT);
+            EXPECT_NEAR(fd, dlngdT[k], 1e-6 * std::abs(fd) + 1e-10)
+                << "species " << test_phase->speciesName(k) << " at " << T;
+            fd = (dlng_Tp[k] - dlng_Tm[k]) / (2 * dT);
+            EXPECT_NEAR(fd, d2lngdT2[k], 1e-5 * std::abs(fd) + 1e-10)
+                << "species " << test_phase->speciesName(k) << " at " << T;
+            fd = (lng_Pp[k] - lng_Pm[k]) / (2 * dP);
+            EXPECT_NEAR(fd, dlngdP[k], 1e-5 * std::abs(fd) + 1e-16)
+                << "species " << test_phase->speciesName(k) << " at " << T;
+        }
+    }
+}
+
+TEST_F(HMWSoln_Test, stateChanges)
+{
+    test_phase->setState_TP(300.0, 2e6);
+    check_fresh_state();
+
+    // temperature only
+    test_phase->setState_TP(320.0, 2e6);
+    check_fresh_state();
+
+    // pressure only, reusing the Pitzer coefficients for 320 K
+    test_phase->setState_TP(320.0, 8e6);
+    check_fresh_state();
+
+    // composition only
+    test_phase->setMolalitiesByName("Na+:1.0 K+:2.0 Cl-:1.5 Br-:1.5 "
+                                    "CO2(aq):0.8");
+    check_fresh_state();
+
+    // temperature and composition
+    test_phase->setState_TPM(295.0, 8e6, "Na+:3.0 Cl-:3.0 CO2(aq):0.1");
+    check_fresh_state();
+}
+
+} // namespace Cantera
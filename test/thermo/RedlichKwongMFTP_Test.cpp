@@ -0,0 +1,116 @@
+#include "gtest/gtest.h"
+#include "cantera/thermo/RedlichKwongMFTP.h"
+#include "cantera/thermo/ThermoFactory.h"
+
+namespace Cantera
+{
+
+class RedlichKwongMFTP_Test : public testing::Test
+{
+public:
+    RedlichKwongMFTP_Test() {
+        test_phase.reset(newPhase("co2-rk.xml", "carbondioxide"));
+        X1 = {0.9, 0.02, 0.01, 0.03, 0.01, 0.01, 0.02};
+        X2 = {0.5, 0.1, 0.05, 0.1, 0.15, 0.05, 0.05};
+    }
+
+    //! Compare the properties of *test_phase*, which depend on values cached
+    //! from earlier states, with those of a new object set to the same state
+    void check_state() {
+        std::unique_ptr<ThermoPhase> ref(newPhase("co2-rk.xml",
+                                                  "carbondioxide"));
+        size_t kk = ref->nSpecies();
+        vector_fp X(kk);
+        test_phase->getMoleFractions(X.data());
+        ref->setState_TPX(test_phase->temperature(), test_phase->pressure(),
+                          X.data());
+        EXPECT_NEAR(ref->density(), test_phase->density(),
+                    1e-10 * ref->density());
+        EXPECT_NEAR(ref->enthalpy_mass(), test_phase->enthalpy_mass(),
+                    1e-9 * std::abs(ref->enthalpy_mass()));
+        EXPECT_NEAR(ref->entropy_mass(), test_phase->entropy_mass(),
+                    1e-9 * std::abs(ref->entropy_mass()));
+        EXPECT_NEAR(ref->cp_mass(), test_phase->cp_mass(),
+                    1e-9 * ref->cp_mass());
+
+        vector_fp mu_ref(kk), mu(kk), v_ref(kk), v(kk);
+        ref->getChemPotentials(mu_ref.data());
+        test_phase->getChemPotentials(mu.data());
+        ref->getPartialMolarVolumes(v_ref.data());
+        test_phase->getPartialMolarVolumes(v.data());
+        for (size_t k = 0; k < kk; k++) {
+            EXPECT_NEAR(mu_ref[k], mu[k], 1e-9 * std::abs(mu_ref[k]));
+            EXPECT_NEAR(v_ref[k], v[k], 1e-9 * std::abs(v_ref[k]));
+        }
+    }
+
+protected:
+    std::unique_ptr<ThermoPhase> test_phase;
+    vector_fp X1, X2;
+};
+
+TEST_F(RedlichKwongMFTP_Test, cachedStates)
+{
+    test_phase->setState_TPX(350.0, 5e6, X1.data());
+    check_state();
+
+    // temperature only
+    test_phase->setState_TP(500.0, 5e6);
+    check_state();
+
+    // pressure only
+    test_phase->setState_TP(500.0, 2e7);
+    check_state();
+
+    // dense, liquid-like state
+    test_phase->setState_TP(290.0, 2e7);
+    check_state();
+
+    // composition only
+    test_phase->setState_TPX(290.0, 2e7, X2.data());
+    check_state();
+    test_phase->setMassFractions(X1.data());
+    test_phase->setState_TP(290.0, 2e7);
+    check_state();
+
+    // composition, temperature and pressure together
+    test_phase->setState_TPX(800.0, 1e6, X2.data());
+    check_state();
+}
+
+TEST_F(RedlichKwongMFTP_Test, getStateProperties)
+{
+    RedlichKwongMFTP* rk = dynamic_cast<RedlichKwongMFTP*>(test_phase.get());
+    ASSERT_TRUE(rk != 0);
+    size_t kk = rk->nSpecies();
+    const size_t N = 6;
+    double T[N] = {300, 300, 450, 600, 600, 290};
+    double P[N] = {1e5, 1e7, 1e7, 3e6, 3e6, 2e7};
+    vector_fp X(N * kk);
+    for (size_t n = 0; n < N; n++) {
+        const vector_fp& Xn = (n < 3) ? X1 : X2;
+        std::copy(Xn.begin(), Xn.end(), X.begin() + n * kk);
+    }
+
+    vector_fp rho(N), h(N), cp(N);
+    rk->getStateProperties(N, T, P, X.data(), rho.data(), h.data(), cp.data());
+    std::unique_ptr<ThermoPhase> ref(newPhase("co2-rk.xml", "carbondioxide"));
+    for (size_t n = 0; n < N; n++) {
+        ref->setState_TPX(T[n], P[n], &X[n * kk]);
+        EXPECT_NEAR(ref->density(), rho[n], 1e-10 * rho[n]);
+        EXPECT_NEAR(ref->enthalpy_mass(), h[n], 1e-9 * std::abs(h[n]));
+        EXPECT_NEAR(ref->cp_mass(), cp[n], 1e-9 * cp[n]);
+    }
+    // the phase is left in the last state
+    EXPECT_DOUBLE_EQ(T[N-1], rk->temperature());
+    check_state();
+
+    // use the current composition for all states
+    rk->getStateProperties(N, T, P, 0, rho.data());
+    for (size_t n = 0; n < N; n++) {
+        ref->setState_TPX(T[n], P[n], X2.data());
+        EXPECT_NEAR(ref->density(), rho[n], 1e-10 * rho[n]);
+    }
+}
+
+} // namespace Cantera
@@ -3,9 +3,16 @@
 #include "cantera/thermo/ThermoFactory.h"
 #include "cantera/thermo/NasaPoly2.h"
 #include "cantera/thermo/IdealGasPhase.h"
+#include "cantera/thermo/PureFluidPhase.h"
 #include "cantera/base/ctml.h"
 #include "cantera/base/stringUtils.h"
+#include <cstdio>
 #include <fstream>
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <unistd.h>
+#endif
 #include "thermo_data.h"
 
 namespace Cantera
@@ -93,6 +100,113 @@ TEST_F(ChemkinConversionTest, FailedConversion) {
     ASSERT_THROW(ck2cti("h2o2_missingThermo.inp"),
                  CanteraError);
 }
+
+TEST(PureFluidConstructor, Tabulated)
+{
+    std::unique_ptr<ThermoPhase> p1(newPhase("liquidvapor.cti", "water"));
+    XML_Node* phase = get_XML_File("liquidvapor.cti")->findID("water");
+    ASSERT_TRUE(phase != 0);
+    PureFluidPhase p2(true);
+    importPhase(*phase, &p2);
+
+    // The seeded and unseeded iterations stop at different points within the
+    // convergence tolerance on the specified properties (e.g. 1e-8 relative
+    // in h), so the temperatures differ slightly. The largest difference
+    // here is about 1.1e-6 K (8e-10 relative) for the HP state at 1263 K.
+    double rtol = 1e-8;
+    p1->setState_TP(300.0, OneAtm);
+    p2.setState_TP(300.0, OneAtm);
+    EXPECT_NEAR(p1->density(), p2.density(), 1e-6 * p1->density());
+    double s = p1->entropy_mass();
+    p1->setState_SP(s, 8e5);
+    p2.setState_SP(s, 8e5);
+    EXPECT_NEAR(p1->temperature(), p2.temperature(),
+                rtol * p1->temperature());
+    double h = p1->enthalpy_mass() + 2.5e6;
+    p1->setState_HP(h, 8e5);
+    p2.setState_HP(h, 8e5);
+    EXPECT_NEAR(p1->temperature(), p2.temperature(),
+                rtol * p1->temperature());
+    EXPECT_NEAR(p1->vaporFraction(), p2.vaporFraction(), 1e-8);
+    p1->setState_HP(h + 2e6, 8e5);
+    p2.setState_HP(h + 2e6, 8e5);
+    EXPECT_NEAR(p1->temperature(), p2.temperature(),
+                rtol * p1->temperature());
+    EXPECT_NEAR(p1->density(), p2.density(), 1e-6 * p1->density());
+    p1->setState_Psat(OneAtm, 0.5);
+    p2.setState_Psat(OneAtm, 0.5);
+    EXPECT_NEAR(p1->temperature(), p2.temperature(),
+                rtol * p1->temperature());
+    EXPECT_NEAR(p1->density(), p2.density(), 1e-6 * p1->density());
+}
+
+TEST(PureFluidConstructor, TabulatedUnwritableCache)
+{
+    // Failing to save the tables is not an error
+    std::unique_ptr<ThermoPhase> p1(newPhase("liquidvapor.cti", "water"));
+    XML_Node* phase = get_XML_File("liquidvapor.cti")->findID("water");
+    ASSERT_TRUE(phase != 0);
+    PureFluidPhase p2(true, "no-such-directory/water-tables.txt");
+    importPhase(*phase, &p2);
+
+    p1->setState_TP(400.0, 5 * OneAtm);
+    p2.setState_TP(400.0, 5 * OneAtm);
+    EXPECT_NEAR(p1->density(), p2.density(), 1e-6 * p1->density());
+    double h = p1->enthalpy_mass() + 2.5e6;
+    p1->setState_HP(h, 8e5);
+    p2.setState_HP(h, 8e5);
+    EXPECT_NEAR(p1->temperature(), p2.temperature(),
+                1e-8 * p1->temperature());
+    EXPECT_NEAR(p1->vaporFraction(), p2.vaporFraction(), 1e-8);
+}
+
+TEST(PureFluidConstructor, TabulatedCacheFile)
+{
+#ifdef _WIN32
+    std::string dir = std::tmpnam(nullptr);
+    ASSERT_EQ(_mkdir(dir.c_str()), 0);
+#else
+    char tmpl[] = "/tmp/cantera-test-XXXXXX";
+    ASSERT_TRUE(mkdtemp(tmpl) != 0);
+    std::string dir = tmpl;
+#endif
+    std::string cacheFile = dir + "/water-tables.txt";
+    XML_Node* phase = get_XML_File("liquidvapor.cti")->findID("water");
+    ASSERT_TRUE(phase != 0);
+
+    // The first phase builds the tables and writes them to the cache, which
+    // is read by the second
+    PureFluidPhase p1(true, cacheFile);
+    importPhase(*phase, &p1);
+    p1.setState_TP(400.0, 5 * OneAtm);
+    ASSERT_TRUE(std::ifstream(cacheFile).good());
+    PureFluidPhase p2(true, cacheFile);
+    importPhase(*phase, &p2);
+
+    p2.setState_TP(400.0, 5 * OneAtm);
+    EXPECT_DOUBLE_EQ(p1.density(), p2.density());
+    double s = p1.entropy_mass();
+    p1.setState_SP(s, 8e5);
+    p2.setState_SP(s, 8e5);
+    EXPECT_DOUBLE_EQ(p1.temperature(), p2.temperature());
+    double h = p1.enthalpy_mass() + 2e6;
+    p1.setState_HP(h, 8e5);
+    p2.setState_HP(h, 8e5);
+    EXPECT_DOUBLE_EQ(p1.temperature(), p2.temperature());
+    EXPECT_DOUBLE_EQ(p1.vaporFraction(), p2.vaporFraction());
+    p1.setState_Psat(OneAtm, 0.3);
+    p2.setState_Psat(OneAtm, 0.3);
+    EXPECT_DOUBLE_EQ(p1.temperature(), p2.temperature());
+    EXPECT_DOUBLE_EQ(p1.density(), p2.density());
+
+    // Only the cache file itself is left in the directory
+    EXPECT_EQ(std::remove(cacheFile.c_str()), 0);
+#ifdef _WIN32
+    EXPECT_EQ(_rmdir(dir.c_str()), 0);
+#else
+    EXPECT_EQ(rmdir(dir.c_str()), 0);
+#endif
+}
 #endif
 
 class ConstructFromScratch : public testing::Test
@@ -49,9 +49,15 @@ TEST_F(WaterPropsIAPWSphi_Test, check2) {
     EXPECT_NEAR(phiR_dt(), -1.332147204361e+00, 1e-11);
 }
 
-class WaterPropsIAPWS_Test : public testing::Test
+//! The parameter turns on the tabulated initial guess for the density, which
+//! should not change any of the results
+class WaterPropsIAPWS_Test : public testing::TestWithParam<bool>
 {
 public:
+    WaterPropsIAPWS_Test() {
+        water.setDensityTable(GetParam());
+    }
+
     double dPdT(double T, double P) {
         double rho = water.density(T, P);
         water.setState_TR(T, rho);
@@ -66,7 +72,7 @@ public:
 };
 
 // See values on p. 395 of Wagner & Pruss.
-TEST_F(WaterPropsIAPWS_Test, triple_point_liquid)
+TEST_P(WaterPropsIAPWS_Test, triple_point_liquid)
 {
     double T = 273.16;
     double pres = water.psat(T);
@@ -80,7 +86,7 @@ TEST_F(WaterPropsIAPWS_Test, triple_point_liquid)
     EXPECT_NEAR(water.cp(), 76022.8, 2e-1);
 }
 
-TEST_F(WaterPropsIAPWS_Test, triple_point_gas)
+TEST_P(WaterPropsIAPWS_Test, triple_point_gas)
 {
     double T = 273.16;
     double pres = water.psat(T);
@@ -93,7 +99,7 @@ TEST_F(WaterPropsIAPWS_Test, triple_point_gas)
     EXPECT_NEAR(water.cp(), 33947.1, 2e-1);
 }
 
-TEST_F(WaterPropsIAPWS_Test, normal_boiling_point)
+TEST_P(WaterPropsIAPWS_Test, normal_boiling_point)
 {
     double T = 373.124;
     double P = water.psat(T);
@@ -114,7 +120,7 @@ TEST_F(WaterPropsIAPWS_Test, normal_boiling_point)
     EXPECT_NEAR(water.isothermalCompressibility(), 1.004308000545e-05, 2e-17);
 }
 
-TEST_F(WaterPropsIAPWS_Test, saturation_pressure_estimate)
+TEST_P(WaterPropsIAPWS_Test, saturation_pressure_estimate)
 {
     vector_fp TT{273.15, 313.9999, 314.0001, 373.15, 647.25};
     vector_fp psat{611.212, 7722.3, 7675.46, 101007, 2.2093e+07};
@@ -125,19 +131,64 @@ TEST_F(WaterPropsIAPWS_Test, saturation_pressure_estimate)
     }
 }
 
-TEST_F(WaterPropsIAPWS_Test, expansion_coeffs)
+TEST_P(WaterPropsIAPWS_Test, expansion_coeffs)
 {
     vector_fp TT{300.0, 300.0, 700.0};
     vector_fp PP{10.0, 10.0e6, 10.0e6};
     vector_fp alpha{0.003333433139236, -0.02277763412159, 0.002346416555069};
     vector_fp beta{1.000020308917, 1265.572840683, 1.240519813089};
     vector_fp beta_num{1.0000203087, 1265.46651311, 1.240519294};
+    // The expected values come from the untabulated solve, which stops once
+    // the pressure matches to within 1e-8. Starting from the tabulated
+    // guess, the iteration ends closer to the exact root, which shifts these
+    // derivatives by a few parts in 1e9.
+    double rtol = GetParam() ? 5e-9 : 0.0;
     for (size_t i = 0; i < TT.size(); i++) {
         double rho = water.density(TT[i], PP[i], WATER_GAS);
         water.setState_TR(TT[i], rho);
-        EXPECT_NEAR(water.coeffThermExp(), alpha[i], 2e-14);
-        EXPECT_NEAR(water.coeffPresExp(), beta[i], beta[i] * 2e-12);
+        EXPECT_NEAR(water.coeffThermExp(), alpha[i], 2e-14 + rtol * fabs(alpha[i]));
+        EXPECT_NEAR(water.coeffPresExp(), beta[i], beta[i] * (2e-12 + rtol));
         EXPECT_NEAR(dPdT(TT[i], PP[i]) * 18.015268 / (8.314371E3 * rho),
-                    beta_num[i], 2e-10 * beta_num[i]);
+                    beta_num[i], (2e-10 + rtol) * beta_num[i]);
+    }
+}
+INSTANTIATE_TEST_CASE_P(DensityTable, WaterPropsIAPWS_Test, testing::Bool());
+
+TEST(WaterPropsIAPWS, density_table)
+{
+    WaterPropsIAPWS water, fast;
+    fast.setDensityTable(true);
+    vector_fp TT{274.0, 300.0, 373.124, 450.0, 600.0, 640.0, 650.0, 700.0, 1200.0};
+    vector_fp PP{700.0, 5.0e3, 101325.0, 1.0e6, 5.0e6, 2.5e7, 5.0e7, 9.0e7};
+    for (size_t i = 0; i < TT.size(); i++) {
+        for (size_t j = 0; j < PP.size(); j++) {
+            for (int phase : {-1, WATER_GAS, WATER_LIQUID}) {
+                double rho = water.density(TT[i], PP[j], phase);
+                EXPECT_NEAR(fast.density(TT[i], PP[j], phase), rho, 5e-8 * fabs(rho));
+            }
+        }
+    }
+
+    // Values at the normal boiling point are unaffected by the table
+    double T = 373.124;
+    double P = water.psat(T);
+    EXPECT_NEAR(fast.density(T, P, WATER_LIQUID), 958.368, 2e-3);
+    EXPECT_NEAR(fast.density(T, P, WATER_GAS), 0.597651, 2e-6);
+}
+
+TEST(WaterPropsIAPWS, density_guess)
+{
+    // An explicit guess selects the branch, also where it is metastable
+    WaterPropsIAPWS plain, fast;
+    fast.setDensityTable(true);
+    vector_fp TT{300.0, 400.0, 500.0, 550.0, 700.0};
+    vector_fp PP{1.0e5, 1.0e5, 1.0e6, 1.0e6, 2.0e7};
+    vector_fp guess{1000.0, 940.0, 5.0, 800.0, 100.0};
+    for (size_t i = 0; i < TT.size(); i++) {
+        double rho = plain.density(TT[i], PP[i], -1, guess[i]);
+        EXPECT_NEAR(fast.density(TT[i], PP[i], -1, guess[i]), rho,
+                    5e-8 * rho);
     }
+    // superheated liquid below the boiling point
+    EXPECT_GT(fast.density(400.0, 1.0e5, -1, 940.0), 900.0);
 }
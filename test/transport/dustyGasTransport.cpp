@@ -0,0 +1,187 @@
+#include "gtest/gtest.h"
+
+#include "cantera/transport/DustyGasTransport.h"
+#include "cantera/transport/TransportFactory.h"
+#include "cantera/thermo/ThermoFactory.h"
+
+using namespace Cantera;
+
+class DustyGasTransportTest : public testing::Test
+{
+public:
+    DustyGasTransportTest()
+        : porosity(0.2)
+        , tortuosity(0.3)
+        , poreRadius(1e-4)
+    {
+        thermo.reset(newPhase("h2o2-plus.xml", ""));
+        kk = thermo->nSpecies();
+        thermo->setState_TPX(500.0, OneAtm, "O2:2.0, H2:1.0, H2O:1.0, AR:0.02");
+        tran.reset(newTransport());
+    }
+
+    //! Create a new transport manager for the current medium properties
+    DustyGasTransport* newTransport() {
+        Transport* tr = newTransportMgr("DustyGas", thermo.get());
+        DustyGasTransport* dg = dynamic_cast<DustyGasTransport*>(tr);
+        dg->setPorosity(porosity);
+        dg->setTortuosity(tortuosity);
+        dg->setMeanPoreRadius(poreRadius);
+        dg->setMeanParticleDiameter(5e-4);
+        return dg;
+    }
+
+    //! Compare the multicomponent diffusion coefficients with those of a
+    //! new transport manager, which has nothing cached. The binary diffusion
+    //! coefficients are stored after scaling by the pressure at which they
+    //! were computed, so the values only agree to round-off.
+    void checkMultiDiffCoeffs() {
+        std::unique_ptr<DustyGasTransport> ref(newTransport());
+        vector_fp D(kk*kk), Dref(kk*kk);
+        tran->getMultiDiffCoeffs(kk, D.data());
+        ref->getMultiDiffCoeffs(kk, Dref.data());
+        for (size_t n = 0; n < kk*kk; n++) {
+            EXPECT_NEAR(Dref[n], D[n], 1e-12 * std::abs(Dref[n]));
+        }
+    }
+
+    //! Compare the fluxes between the states *s1* and *s2* with *ref*
+    void checkFluxes(const vector_fp& s1, const vector_fp& s2,
+                     const vector_fp& ref) {
+        vector_fp fluxes(kk);
+        tran->getMolarFluxes(s1.data(), s2.data(), 1e-4, fluxes.data());
+        double fmax = 0.0;
+        for (size_t k = 0; k < kk; k++) {
+            fmax = std::max(fmax, std::abs(ref[k]));
+        }
+        for (size_t k = 0; k < kk; k++) {
+            EXPECT_NEAR(ref[k], fluxes[k], 1e-10 * fmax);
+        }
+    }
+
+protected:
+    std::unique_ptr<ThermoPhase> thermo;
+    std::unique_ptr<DustyGasTransport> tran;
+    size_t kk;
+    double porosity;
+    double tortuosity;
+    double poreRadius;
+};
+
+TEST_F(DustyGasTransportTest, molarFluxes)
+{
+    // Reference values computed using the explicit inverse of the H matrix
+    std::vector<vector_fp> ref = {
+        {0.0047024834296548954, 1.9275231589848993e-22, 1.9327911383434875e-22,
+         0.0096063484478097205, 1.9346055146970629e-22, 1.9328357667480224e-22,
+         0.0048416335678168471, 1.934339602795229e-22, 1.9343366079646017e-22,
+         9.8065741517984321e-05},
+        {-0.41129277296385663, -1.6230240304466515e-20, -1.6225420220240747e-20,
+         -0.80984829582797913, -1.6229904102666555e-20, -1.6224994189812065e-20,
+         -0.39867998576479841, -1.6227521235070467e-20, -1.6227264618601273e-20,
+         -0.0060387306237443131},
+        {-0.20564638648192832, -8.1151201522332573e-21, -8.1127101101203733e-21,
+         -0.40492414791398956, -8.1149520513332773e-21, -8.1124970949060325e-21,
+         -0.1993399928823992, -8.1137606175352337e-21, -8.1136323093006367e-21,
+         -0.0030193653118721566},
+        {-0.16632822221620855, -6.5677064616431698e-21, -6.5663898705504629e-21,
+         -0.32744032346821056, -6.5672233081057424e-21, -6.566298022114023e-21,
+         -0.16117438322280794, -6.5667397293103722e-21, -6.5666861530741924e-21,
+         -0.0024366325168736448}
+    };
+
+    vector_fp s1(kk+2), s2(kk+2);
+    s1[0] = thermo->temperature();
+    s1[1] = thermo->density();
+    thermo->getMassFractions(&s1[2]);
+    thermo->setState_TPX(510.0, 1.001 * OneAtm,
+                         "O2:2.0, H2:1.03, H2O:0.97, AR:0.01");
+    s2[0] = thermo->temperature();
+    s2[1] = thermo->density();
+    thermo->getMassFractions(&s2[2]);
+
+    vector_fp D(kk*kk);
+    for (size_t i = 0; i < ref.size(); i++) {
+        if (i == 1) {
+            tran->setPorosity(0.4);
+        } else if (i == 2) {
+            tran->setTortuosity(0.6);
+        } else if (i == 3) {
+            tran->setMeanPoreRadius(2e-4);
+        }
+        size_t n = tran->nHMatrixFactorizations();
+        checkFluxes(s1, s2, ref[i]);
+        EXPECT_EQ(n + 1, tran->nHMatrixFactorizations());
+
+        // Neither repeating the calculation nor evaluating the Jacobian of
+        // the fluxes at the same state refactors the H matrix
+        checkFluxes(s1, s2, ref[i]);
+        tran->getMultiDiffCoeffs(kk, D.data());
+        EXPECT_EQ(n + 1, tran->nHMatrixFactorizations());
+    }
+}
+
+TEST_F(DustyGasTransportTest, stateChanges)
+{
+    vector_fp D(kk*kk);
+    size_t n = tran->nHMatrixFactorizations();
+    checkMultiDiffCoeffs();
+    EXPECT_EQ(++n, tran->nHMatrixFactorizations());
+    tran->getMultiDiffCoeffs(kk, D.data());
+    tran->getMultiDiffCoeffs(kk, D.data());
+    EXPECT_EQ(n, tran->nHMatrixFactorizations());
+
+    // temperature
+    thermo->setState_TP(600.0, OneAtm);
+    checkMultiDiffCoeffs();
+    EXPECT_EQ(++n, tran->nHMatrixFactorizations());
+    tran->getMultiDiffCoeffs(kk, D.data());
+    EXPECT_EQ(n, tran->nHMatrixFactorizations());
+
+    // pressure
+    thermo->setState_TP(600.0, 3 * OneAtm);
+    checkMultiDiffCoeffs();
+    EXPECT_EQ(++n, tran->nHMatrixFactorizations());
+    tran->getMultiDiffCoeffs(kk, D.data());
+    EXPECT_EQ(n, tran->nHMatrixFactorizations());
+
+    // composition
+    thermo->setMoleFractionsByName("O2:1.0, H2:2.0, H2O:0.5, N2:1.0");
+    checkMultiDiffCoeffs();
+    EXPECT_EQ(++n, tran->nHMatrixFactorizations());
+    tran->getMultiDiffCoeffs(kk, D.data());
+    EXPECT_EQ(n, tran->nHMatrixFactorizations());
+
+    // properties of the porous medium
+    porosity = 0.35;
+    tran->setPorosity(porosity);
+    checkMultiDiffCoeffs();
+    EXPECT_EQ(++n, tran->nHMatrixFactorizations());
+    tran->getMultiDiffCoeffs(kk, D.data());
+    EXPECT_EQ(n, tran->nHMatrixFactorizations());
+
+    tortuosity = 0.5;
+    tran->setTortuosity(tortuosity);
+    checkMultiDiffCoeffs();
+    EXPECT_EQ(++n, tran->nHMatrixFactorizations());
+    tran->getMultiDiffCoeffs(kk, D.data());
+    EXPECT_EQ(n, tran->nHMatrixFactorizations());
+
+    poreRadius = 3e-5;
+    tran->setMeanPoreRadius(poreRadius);
+    checkMultiDiffCoeffs();
+    EXPECT_EQ(++n, tran->nHMatrixFactorizations());
+    tran->getMultiDiffCoeffs(kk, D.data());
+    EXPECT_EQ(n, tran->nHMatrixFactorizations());
+
+    // Returning to the initial state
+    porosity = 0.2;
+    tortuosity = 0.3;
+    poreRadius = 1e-4;
+    tran->setPorosity(porosity);
+    tran->setTortuosity(tortuosity);
+    tran->setMeanPoreRadius(poreRadius);
+    thermo->setState_TPX(500.0, OneAtm, "O2:2.0, H2:1.0, H2O:1.0, AR:0.02");
+    checkMultiDiffCoeffs();
+    EXPECT_EQ(++n, tran->nHMatrixFactorizations());
+}
@@ -0,0 +1,112 @@
+#include "gtest/gtest.h"
+
+#include "cantera/transport/TransportBase.h"
+#include "cantera/transport/TransportFactory.h"
+#include "cantera/thermo/ThermoFactory.h"
+
+using namespace Cantera;
+
+//! Reference values for the ternary liquid in liquid-transport.xml
+struct LiquidTransportValues
+{
+    double viscosity;
+    double conductivity;
+    vector_fp speciesViscosities;
+    //! Binary diffusion coefficients for the pairs AB, AC and BC
+    vector_fp binaryDiffCoeffs;
+    vector_fp fluxes;
+    vector_fp mixDiffCoeffs;
+};
+
+class LiquidTransportTest : public testing::Test
+{
+public:
+    LiquidTransportTest() {
+        thermo.reset(newPhase("liquid-transport.xml", "liquid"));
+        tran.reset(newDefaultTransportMgr(thermo.get()));
+    }
+
+    //! Compare the properties computed at the current state with *ref*
+    void check(const LiquidTransportValues& ref) {
+        size_t kk = thermo->nSpecies();
+        double rtol = 1e-10;
+        EXPECT_NEAR(ref.viscosity, tran->viscosity(), rtol * ref.viscosity);
+        EXPECT_NEAR(ref.conductivity, tran->thermalConductivity(),
+                    rtol * ref.conductivity);
+
+        vector_fp visc(kk);
+        tran->getSpeciesViscosities(visc.data());
+        for (size_t k = 0; k < kk; k++) {
+            EXPECT_NEAR(ref.speciesViscosities[k], visc[k],
+                        rtol * ref.speciesViscosities[k]);
+        }
+
+        vector_fp D(kk*kk);
+        tran->getBinaryDiffCoeffs(kk, D.data());
+        size_t n = 0;
+        for (size_t i = 0; i < kk; i++) {
+            for (size_t j = i + 1; j < kk; j++) {
+                double Dij = ref.binaryDiffCoeffs[n++];
+                EXPECT_NEAR(Dij, D[i*kk+j], rtol * Dij);
+                EXPECT_NEAR(Dij, D[j*kk+i], rtol * Dij);
+            }
+        }
+
+        // The mixture diffusion coefficients depend on the gradients given
+        // to the most recent call to getSpeciesFluxes
+        double gradT = 100.0;
+        double gradX[] = {1.0, -0.6, -0.4};
+        vector_fp flux(kk), Dmix(kk);
+        tran->getSpeciesFluxes(1, &gradT, kk, gradX, kk, flux.data());
+        tran->getMixDiffCoeffs(Dmix.data());
+        for (size_t k = 0; k < kk; k++) {
+            EXPECT_NEAR(ref.fluxes[k], flux[k],
+                        rtol * std::abs(ref.fluxes[k]));
+            EXPECT_NEAR(ref.mixDiffCoeffs[k], Dmix[k],
+                        rtol * std::abs(ref.mixDiffCoeffs[k]));
+        }
+    }
+
+protected:
+    std::unique_ptr<ThermoPhase> thermo;
+    std::unique_ptr<Transport> tran;
+};
+
+TEST_F(LiquidTransportTest, stateChanges)
+{
+    LiquidTransportValues initial = {
+        0.005578582053739096, 0.1509,
+        {0.0066115307967904184, 0.0049422717236404521, 0.0038791851793629054},
+        {3.017469905432018e-10, 9.9247646657391663e-11, 2.4029999027868681e-10},
+        {-8.2856209830272311e-08, 8.6703670837513595e-08, -3.8474610072412766e-09},
+        {2.7889436299207269e-10, 2.5950860653390673e-10, -1.177887134806947e-11}
+    };
+    check(initial);
+
+    // Repeated evaluation at the same state uses the stored values
+    check(initial);
+
+    LiquidTransportValues hot = {
+        0.003362367228285229, 0.14755,
+        {0.0037288119810120163, 0.0031256574962697935, 0.0027510696638565336},
+        {3.7943340515179945e-10, 1.3994556555877807e-10, 2.8534693709049241e-10},
+        {-1.0706885816486197e-07, 1.0389014388170499e-07, 3.1787142831569875e-09},
+        {3.6039424269281266e-10, 3.1094861625724322e-10, 9.7315259396023384e-12}
+    };
+    thermo->setState_TP(350.0, 2e5);
+    check(hot);
+
+    LiquidTransportValues mixed = {
+        0.0029018595620155631, 0.13474,
+        {0.0037288119810120163, 0.0031256574962697935, 0.0027510696638565336},
+        {3.7943340515179945e-10, 1.3994556555877807e-10, 2.8534693709049241e-10},
+        {-4.4925657953105018e-08, 7.5472826869439703e-08, -3.0547168916334671e-08},
+        {2.0863335861170528e-10, 3.116588958145771e-10, -1.2902535051312338e-10}
+    };
+    thermo->setMoleFractionsByName("A:0.2, B:0.2, C:0.6");
+    check(mixed);
+
+    // Returning to the initial state
+    thermo->setState_TPX(300.0, OneAtm, "A:0.5, B:0.3, C:0.2");
+    check(initial);
+}
@@ -2,6 +2,7 @@
 
 #include "cantera/transport/TransportData.h"
 #include "cantera/transport/MixTransport.h"
+#include "cantera/transport/MixTabulatedTransport.h"
 #include "cantera/transport/MultiTransport.h"
 #include "cantera/transport/TransportFactory.h"
 #include "cantera/thermo/ThermoFactory.h"
@@ -12,8 +13,73 @@
 
 #include "../thermo/thermo_data.h"
 
+#include <cstdio>
+#include <fstream>
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <unistd.h>
+#endif
+
 using namespace Cantera;
 
+namespace {
+
+//! Exposes the key used to name the fit cache file
+class CacheTestTransport : public MixTransport
+{
+public:
+    std::string cacheFile(const std::string& dir) {
+        return dir + "/transport-fits-" +
+               fmt::format("{:016x}", fitCacheKey()) + ".bin";
+    }
+};
+
+//! A temporary directory which is removed, along with the listed files, when
+//! the test finishes
+class TempDirectory
+{
+public:
+    TempDirectory() {
+#ifdef _WIN32
+        m_path = std::tmpnam(nullptr);
+        _mkdir(m_path.c_str());
+#else
+        char tmpl[] = "/tmp/cantera-test-XXXXXX";
+        if (mkdtemp(tmpl)) {
+            m_path = tmpl;
+        }
+#endif
+    }
+    ~TempDirectory() {
+        for (const auto& f : m_files) {
+            std::remove(f.c_str());
+        }
+#ifdef _WIN32
+        _rmdir(m_path.c_str());
+#else
+        rmdir(m_path.c_str());
+#endif
+    }
+    const std::string& path() const {
+        return m_path;
+    }
+    void addFile(const std::string& fname) {
+        m_files.push_back(fname);
+    }
+
+private:
+    std::string m_path;
+    std::vector<std::string> m_files;
+};
+
+bool fileExists(const std::string& fname)
+{
+    return std::ifstream(fname).good();
+}
+
+}
+
 class TransportFromScratch : public testing::Test
 {
 public:
@@ -101,6 +167,39 @@ TEST_F(TransportFromScratch, mixDiffCoeffs)
     }
 }
 
+TEST_F(TransportFromScratch, mixDiffCoeffsFromBinary)
+{
+    MixTransport tr;
+    tr.init(test.get());
+    test->setState_TPX(1200, 2e5, "H2:0.5, O2:0.3, H2O:0.2");
+
+    size_t K = test->nSpecies();
+    Array2D bdiff(3,3);
+    vector_fp D(3), Dmole(3), Dmass(3);
+    tr.getBinaryDiffCoeffs(K, &bdiff(0,0));
+    tr.getMixDiffCoeffs(&D[0]);
+    tr.getMixDiffCoeffsMole(&Dmole[0]);
+    tr.getMixDiffCoeffsMass(&Dmass[0]);
+
+    const vector_fp& mw = test->molecularWeights();
+    vector_fp X(3);
+    test->getMoleFractions(&X[0]);
+    double mmw = test->meanMolecularWeight();
+    for (size_t k = 0; k < K; k++) {
+        double sum1 = 0.0, sum2 = 0.0;
+        for (size_t j = 0; j < K; j++) {
+            if (j != k) {
+                sum1 += X[j] / bdiff(j,k);
+                sum2 += X[j] * mw[j] / bdiff(j,k);
+            }
+        }
+        EXPECT_NEAR(D[k], (mmw - X[k] * mw[k]) / (mmw * sum1), 1e-14 * D[k]);
+        EXPECT_NEAR(Dmole[k], (1 - X[k]) / sum1, 1e-14 * Dmole[k]);
+        double Dm = 1.0 / (sum1 + sum2 * X[k] / (mmw - mw[k] * X[k]));
+        EXPECT_NEAR(Dmass[k], Dm, 1e-14 * Dmass[k]);
+    }
+}
+
 TEST_F(TransportFromScratch, viscosity)
 {
     Transport* trRef = newTransportMgr("Mix", ref.get());
@@ -130,6 +229,96 @@ TEST_F(TransportFromScratch, thermalConductivityMix)
     }
 }
 
+TEST_F(TransportFromScratch, mixTransportProperties)
+{
+    Transport* trRef = newTransportMgr("Mix", ref.get());
+    MixTransport trTest;
+    trTest.init(test.get());
+
+    // more states than are processed together in one block
+    size_t K = ref->nSpecies();
+    size_t n = 21;
+    vector_fp T(n), P(n), X(n*K), visc(n), cond(n), D(n*K);
+    for (size_t j = 0; j < n; j++) {
+        T[j] = 300 + 97*j;
+        P[j] = 1e5 + 2e4*j;
+        X[j*K] = 0.04 * j;
+        X[j*K+1] = (j % 3 == 0) ? 0.0 : 0.2;
+        X[j*K+2] = 1.0 - X[j*K] - X[j*K+1];
+    }
+    test->setState_TPX(400, 5e5, "H2:0.5, O2:0.3, H2O:0.2");
+    trTest.getMixTransportProperties(n, &T[0], &P[0], &X[0], &visc[0],
+                                     &cond[0], &D[0]);
+    EXPECT_DOUBLE_EQ(400, test->temperature());
+    EXPECT_DOUBLE_EQ(5e5, test->pressure());
+
+    vector_fp Dref(K);
+    for (size_t j = 0; j < n; j++) {
+        ref->setState_TPX(T[j], P[j], &X[j*K]);
+        EXPECT_NEAR(trRef->viscosity(), visc[j], 1e-12 * visc[j]);
+        EXPECT_NEAR(trRef->thermalConductivity(), cond[j], 1e-12 * cond[j]);
+        trRef->getMixDiffCoeffs(&Dref[0]);
+        for (size_t k = 0; k < K; k++) {
+            EXPECT_NEAR(Dref[k], D[j*K+k], 1e-12 * Dref[k])
+                << "j = " << j << ", k = " << k;
+        }
+    }
+}
+
+TEST_F(TransportFromScratch, mixTabulated)
+{
+    Transport* trRef = newTransportMgr("Mix", ref.get());
+    MixTabulatedTransport trTest;
+    trTest.init(test.get());
+    EXPECT_DOUBLE_EQ(200, trTest.tableMinTemp());
+    EXPECT_DOUBLE_EQ(3500, trTest.tableMaxTemp());
+
+    // includes states outside of the tabulated temperature range
+    size_t K = ref->nSpecies();
+    size_t n = 21;
+    vector_fp T(n), P(n), X(n*K), visc(n), cond(n), D(n*K);
+    for (size_t j = 0; j < n; j++) {
+        T[j] = 150 + 197*j;
+        P[j] = 1e5 + 2e4*j;
+        X[j*K] = 0.04 * j;
+        X[j*K+1] = (j % 3 == 0) ? 0.0 : 0.2;
+        X[j*K+2] = 1.0 - X[j*K] - X[j*K+1];
+    }
+    trTest.getMixTransportProperties(n, &T[0], &P[0], &X[0], &visc[0],
+                                     &cond[0], &D[0]);
+
+    vector_fp Dref(K), Dtest(K);
+    for (size_t j = 0; j < n; j++) {
+        ref->setState_TPX(T[j], P[j], &X[j*K]);
+        test->setState_TPX(T[j], P[j], &X[j*K]);
+        double tol = (T[j] < 200 || T[j] > 3500) ? 1e-12 : 2e-5;
+        double mu = trRef->viscosity();
+        double lambda = trRef->thermalConductivity();
+        EXPECT_NEAR(mu, trTest.viscosity(), tol * mu) << "T = " << T[j];
+        EXPECT_NEAR(mu, visc[j], tol * mu) << "T = " << T[j];
+        EXPECT_NEAR(lambda, trTest.thermalConductivity(), tol * lambda)
+            << "T = " << T[j];
+        EXPECT_NEAR(lambda, cond[j], tol * lambda) << "T = " << T[j];
+        trRef->getMixDiffCoeffs(&Dref[0]);
+        trTest.getMixDiffCoeffs(&Dtest[0]);
+        for (size_t k = 0; k < K; k++) {
+            EXPECT_NEAR(Dref[k], Dtest[k], tol * Dref[k])
+                << "T = " << T[j] << ", k = " << k;
+            EXPECT_NEAR(Dref[k], D[j*K+k], tol * Dref[k])
+                << "T = " << T[j] << ", k = " << k;
+        }
+    }
+
+    // A coarser table gives larger, but still bounded, errors
+    trTest.setTableRange(300, 2000, 50);
+    EXPECT_DOUBLE_EQ(2000, trTest.tableMaxTemp());
+    ref->setState_TPX(725, 2e5, "H2:0.5, O2:0.3, H2O:0.2");
+    test->setState_TPX(725, 2e5, "H2:0.5, O2:0.3, H2O:0.2");
+    EXPECT_NEAR(trRef->viscosity(), trTest.viscosity(),
+                1e-3 * trRef->viscosity());
+    EXPECT_THROW(trTest.setTableRange(300, 200, 10), CanteraError);
+}
+
 TEST_F(TransportFromScratch, multiDiffCoeffs)
 {
     Transport* trRef = newTransportMgr("Multi", ref.get());
@@ -166,6 +355,125 @@ TEST_F(TransportFromScratch, thermalConductivityMulti)
     }
 }
 
+TEST_F(TransportFromScratch, multiLMatrixReuse)
+{
+    MultiTransport tr1, tr2;
+    tr1.init(test.get());
+    tr2.init(test.get());
+    tr2.setLMatrixReuse(10);
+
+    size_t K = test->nSpecies();
+    vector_fp dt1(K), dt2(K);
+    size_t n = 20;
+    for (size_t i = 0; i < n; i++) {
+        double T = 400 + 5*i;
+        double X[] = {0.5 - 0.01*i, 0.3, 0.2 + 0.01*i};
+        test->setState_TPX(T, 5e5, X);
+        double lambda1 = tr1.thermalConductivity();
+        double lambda2 = tr2.thermalConductivity();
+        EXPECT_NEAR(lambda1, lambda2, 1e-9 * lambda1) << "i = " << i;
+        tr1.getThermalDiffCoeffs(&dt1[0]);
+        tr2.getThermalDiffCoeffs(&dt2[0]);
+        for (size_t k = 0; k < K; k++) {
+            EXPECT_NEAR(dt1[k], dt2[k], 1e-7 * std::abs(dt1[k]))
+                << "i = " << i << ", k = " << k;
+        }
+    }
+    EXPECT_EQ(n, tr1.nLMatrixFactorizations());
+    EXPECT_LT(tr2.nLMatrixFactorizations(), n);
+}
+
+TEST_F(TransportFromScratch, fitCache)
+{
+    TempDirectory dir;
+    ASSERT_FALSE(dir.path().empty());
+
+    // The first transport manager writes the cache file, which is read by
+    // the second
+    CacheTestTransport tr1;
+    MixTransport tr2, tr3;
+    tr1.setFitCacheDirectory(dir.path());
+    tr1.init(test.get());
+    std::string cacheFile = tr1.cacheFile(dir.path());
+    dir.addFile(cacheFile);
+    ASSERT_TRUE(fileExists(cacheFile));
+    tr2.setFitCacheDirectory(dir.path());
+    tr2.init(test.get());
+    tr3.init(test.get());
+
+    size_t K = test->nSpecies();
+    Array2D D1(K, K), D2(K, K), D3(K, K);
+    for (int i = 0; i < 5; i++) {
+        double T = 300 + 400*i;
+        test->setState_TPX(T, 5e5, "H2:0.5, O2:0.3, H2O:0.2");
+        EXPECT_DOUBLE_EQ(tr3.viscosity(), tr1.viscosity());
+        EXPECT_DOUBLE_EQ(tr3.viscosity(), tr2.viscosity());
+        EXPECT_DOUBLE_EQ(tr3.thermalConductivity(), tr2.thermalConductivity());
+        tr1.getBinaryDiffCoeffs(K, &D1(0,0));
+        tr2.getBinaryDiffCoeffs(K, &D2(0,0));
+        tr3.getBinaryDiffCoeffs(K, &D3(0,0));
+        for (size_t k = 0; k < K*K; k++) {
+            EXPECT_DOUBLE_EQ(D3.data()[k], D1.data()[k]);
+            EXPECT_DOUBLE_EQ(D3.data()[k], D2.data()[k]);
+        }
+    }
+
+    // A truncated or corrupted cache file is ignored, and the fits are
+    // regenerated
+    std::string contents;
+    {
+        std::ifstream f(cacheFile, std::ios::binary);
+        contents.assign(std::istreambuf_iterator<char>(f),
+                        std::istreambuf_iterator<char>());
+    }
+    ASSERT_GT(contents.size(), 100u);
+    std::string corrupted = contents;
+    for (size_t i = 0; i < 8; i++) {
+        corrupted[i] = ~corrupted[i];
+    }
+    for (const auto& bad : {contents.substr(0, contents.size() / 2),
+                            corrupted}) {
+        {
+            std::ofstream f(cacheFile, std::ios::binary | std::ios::trunc);
+            f.write(bad.data(), bad.size());
+        }
+        MixTransport tr6;
+        tr6.setFitCacheDirectory(dir.path());
+        tr6.init(test.get());
+        for (int i = 0; i < 3; i++) {
+            test->setState_TPX(300 + 600*i, 5e5, "H2:0.5, O2:0.3, H2O:0.2");
+            EXPECT_DOUBLE_EQ(tr3.viscosity(), tr6.viscosity());
+            EXPECT_DOUBLE_EQ(tr3.thermalConductivity(),
+                             tr6.thermalConductivity());
+            tr3.getBinaryDiffCoeffs(K, &D3(0,0));
+            tr6.getBinaryDiffCoeffs(K, &D1(0,0));
+            for (size_t k = 0; k < K*K; k++) {
+                EXPECT_DOUBLE_EQ(D3.data()[k], D1.data()[k]);
+            }
+        }
+
+        // The regenerated fits replace the bad file
+        std::ifstream f(cacheFile, std::ios::binary);
+        std::string rewritten((std::istreambuf_iterator<char>(f)),
+                              std::istreambuf_iterator<char>());
+        EXPECT_TRUE(rewritten == contents);
+    }
+
+    // Different transport parameters must not use the cached fits
+    tH2->setCustomaryUnits("linear", 3.1, 38.0, 0.0, 0.79, 280.0);
+    CacheTestTransport tr4;
+    MixTransport tr5;
+    tr4.setFitCacheDirectory(dir.path());
+    tr4.init(test.get());
+    dir.addFile(tr4.cacheFile(dir.path()));
+    EXPECT_NE(cacheFile, tr4.cacheFile(dir.path()));
+    tr5.init(test.get());
+    test->setState_TPX(400, 5e5, "H2:0.5, O2:0.3, H2O:0.2");
+    EXPECT_DOUBLE_EQ(tr5.viscosity(), tr4.viscosity());
+    EXPECT_GT(std::abs(tr5.viscosity() - tr3.viscosity()),
+              1e-3 * tr5.viscosity());
+}
+
 int main(int argc, char** argv)
 {
     printf("Running main() from transportFromScratch.cpp\n");